@@ -0,0 +1,95 @@
+#include <vector>
+#include <string>
+#include <random>
+#include "Benchmark.hpp"
+#include "array/GeneralArray/GeneralArray.hpp"
+#include "array/SparseMatrix/SparseMatrix.hpp"
+#include "array/String/String.hpp"
+
+// ================================
+// GeneralArray
+// ================================
+
+static void GeneralArrayPushBack(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    while (state.KeepRunning())
+    {
+        GeneralArray<int> a;
+        for (int i = 0; i < n; i++)
+            a.Push_back(i);
+        DoNotOptimize(a[n - 1]);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(GeneralArrayPushBack)->Range(1 << 10, 1 << 20);
+
+static void GeneralArraySort(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::mt19937 rng(1);
+    GeneralArray<int> input(1, {n}, 0);
+    for (int i = 0; i < n; i++)
+        input[i] = static_cast<int>(rng());
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        GeneralArray<int> a = input;
+        state.ResumeTiming();
+        a.Sort(true);
+        DoNotOptimize(a[0]);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(GeneralArraySort)->Range(1 << 10, 1 << 20);
+
+// ================================
+// SparseMatrix
+// ================================
+
+// An n x n matrix with about density * n * n random nonzero terms.
+static SparseMatrix randomMatrix(int n, double density, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> unit(0, 1);
+    SparseMatrix m(n, n, 0);
+    for (int r = 0; r < n; r++)
+        for (int c = 0; c < n; c++)
+            if (unit(rng) < density)
+                m.StoreNum(1 + unit(rng), r, c);
+    return m;
+}
+
+static void SparseMatrixMultiply(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    SparseMatrix a = randomMatrix(n, 0.1, 1);
+    SparseMatrix b = randomMatrix(n, 0.1, 2);
+    while (state.KeepRunning())
+    {
+        SparseMatrix c = a * b;
+        DoNotOptimize(c.get_terms());
+    }
+    state.SetItemsProcessed(state.Iterations() * a.get_terms());
+}
+MORTIS_BENCHMARK(SparseMatrixMultiply)->Range(8, 64, 2);
+
+// ================================
+// String
+// ================================
+
+// KMP search in a^(n-1) b for a^30 b, which only matches at the end of the text.
+static void StringFastFind(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::string text(n - 1, 'a');
+    text += 'b';
+    std::string pattern(30, 'a');
+    pattern += 'b';
+    String s(text.c_str());
+    String p(pattern.c_str());
+    while (state.KeepRunning())
+        DoNotOptimize(s.FastFind(p));
+    state.SetBytesProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(StringFastFind)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,472 @@
+#include "Benchmark.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <regex>
+#include <memory>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <ctime>
+#include <thread>
+#include "graph/Parallel/Parallel.hpp"
+
+// ================================
+// BenchmarkState
+// ================================
+
+BenchmarkState::BenchmarkState(const std::vector<long long>& args, long long maxIterations)
+    : args(args), maxIterations(maxIterations), iterations(0), started(false), paused(false),
+      wallStart(), wallSeconds(0), cpuStart(0), cpuSeconds(0), items(0), bytes(0), counters() {}
+
+bool BenchmarkState::KeepRunning()
+{
+    if (!started)
+    {
+        started = true;
+        wallStart = std::chrono::steady_clock::now();
+        cpuStart = std::clock();
+    }
+    else
+        iterations++;
+
+    if (iterations < maxIterations)
+        return true;
+    PauseTiming();
+    return false;
+}
+
+long long BenchmarkState::range(int i) const
+{
+    if (i < 0 || i >= static_cast<int>(args.size()))
+        throw std::out_of_range("Benchmark argument index out of range.");
+    return args[i];
+}
+
+long long BenchmarkState::Iterations() const
+{
+    return maxIterations;
+}
+
+void BenchmarkState::PauseTiming()
+{
+    if (paused)
+        return;
+    wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    cpuSeconds += static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    paused = true;
+}
+
+void BenchmarkState::ResumeTiming()
+{
+    if (!paused)
+        return;
+    wallStart = std::chrono::steady_clock::now();
+    cpuStart = std::clock();
+    paused = false;
+}
+
+void BenchmarkState::SetItemsProcessed(long long count)
+{
+    items = count;
+}
+
+void BenchmarkState::SetBytesProcessed(long long count)
+{
+    bytes = count;
+}
+
+double BenchmarkState::ElapsedSeconds() const
+{
+    return wallSeconds;
+}
+
+double BenchmarkState::CpuSeconds() const
+{
+    return cpuSeconds;
+}
+
+long long BenchmarkState::ItemsProcessed() const
+{
+    return items;
+}
+
+long long BenchmarkState::BytesProcessed() const
+{
+    return bytes;
+}
+
+// ================================
+// Registration
+// ================================
+
+static std::vector<std::unique_ptr<Benchmark>>& registry()
+{
+    static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+    return benchmarks;
+}
+
+Benchmark::Benchmark(const std::string& name, Function function) : name(name), function(function), argList() {}
+
+Benchmark* Benchmark::Arg(long long value)
+{
+    argList.push_back({value});
+    return this;
+}
+
+Benchmark* Benchmark::Args(const std::vector<long long>& values)
+{
+    argList.push_back(values);
+    return this;
+}
+
+Benchmark* Benchmark::Range(long long lo, long long hi, int multiplier)
+{
+    if (lo <= 0 || hi < lo || multiplier < 2)
+        throw std::invalid_argument("Invalid benchmark range.");
+    for (long long v = lo; v < hi; v *= multiplier)
+        argList.push_back({v});
+    argList.push_back({hi});
+    return this;
+}
+
+Benchmark* Benchmark::DenseRange(long long lo, long long hi, long long step)
+{
+    if (step <= 0 || hi < lo)
+        throw std::invalid_argument("Invalid benchmark range.");
+    for (long long v = lo; v <= hi; v += step)
+        argList.push_back({v});
+    return this;
+}
+
+const std::string& Benchmark::Name() const
+{
+    return name;
+}
+
+Benchmark::Function Benchmark::Body() const
+{
+    return function;
+}
+
+const std::vector<std::vector<long long>>& Benchmark::ArgList() const
+{
+    return argList;
+}
+
+Benchmark* Benchmark::Register(const char* name, Function function)
+{
+    registry().push_back(std::unique_ptr<Benchmark>(new Benchmark(name, function)));
+    return registry().back().get();
+}
+
+// ================================
+// Running and Reporting
+// ================================
+
+namespace
+{
+    struct Run
+    {
+        std::string name;           // "function/arg" or "function/arg_median" for aggregates.
+        std::string runName;        // Name without the aggregate suffix.
+        std::string aggregate;      // "", "mean", "median" or "stddev".
+        long long iterations;
+        double realTime;            // Nanoseconds per iteration.
+        double cpuTime;             // Process CPU nanoseconds per iteration.
+        double itemsPerSecond;      // 0 if not reported.
+        double bytesPerSecond;
+        std::map<std::string, double> counters;
+    };
+
+    struct Options
+    {
+        std::string filter = ".";
+        double minTime = 0.2;
+        int repetitions = 1;
+        std::string format = "console";
+        std::string out;
+        bool list = false;
+    };
+
+    std::string runName(const Benchmark& b, const std::vector<long long>& args)
+    {
+        std::string s = b.Name();
+        for (long long a : args)
+            s += "/" + std::to_string(a);
+        return s;
+    }
+
+    // One measured run of iterations iterations.
+    Run measure(const Benchmark& b, const std::vector<long long>& args, long long iterations)
+    {
+        BenchmarkState state(args, iterations);
+        b.Body()(state);
+
+        Run r;
+        r.name = r.runName = runName(b, args);
+        r.iterations = iterations;
+        double wall = state.ElapsedSeconds();
+        r.realTime = wall * 1e9 / iterations;
+        r.cpuTime = state.CpuSeconds() * 1e9 / iterations;
+        r.itemsPerSecond = (state.ItemsProcessed() > 0 && wall > 0) ? state.ItemsProcessed() / wall : 0;
+        r.bytesPerSecond = (state.BytesProcessed() > 0 && wall > 0) ? state.BytesProcessed() / wall : 0;
+        r.counters = state.counters;
+        return r;
+    }
+
+    // Grow the iteration count until one run takes at least minTime seconds.
+    Run runOnce(const Benchmark& b, const std::vector<long long>& args, double minTime)
+    {
+        long long iterations = 1;
+        while (true)
+        {
+            Run r = measure(b, args, iterations);
+            double seconds = r.realTime * iterations / 1e9;
+            if (seconds >= minTime || iterations >= 1000000000LL)
+                return r;
+            double factor = seconds > 0 ? minTime * 1.4 / seconds : 10.0;
+            factor = std::min(std::max(factor, 2.0), 10.0);
+            iterations = static_cast<long long>(std::ceil(iterations * factor));
+        }
+    }
+
+    Run aggregate(const std::vector<Run>& runs, const std::string& kind)
+    {
+        auto pick = [&](double Run::*field)
+        {
+            std::vector<double> v;
+            for (const Run& r : runs)
+                v.push_back(r.*field);
+            double mean = std::accumulate(v.begin(), v.end(), 0.0) / v.size();
+            if (kind == "mean")
+                return mean;
+            if (kind == "median")
+            {
+                std::sort(v.begin(), v.end());
+                size_t k = v.size() / 2;
+                return v.size() % 2 ? v[k] : (v[k - 1] + v[k]) / 2;
+            }
+            double sq = 0;
+            for (double x : v)
+                sq += (x - mean) * (x - mean);
+            return v.size() > 1 ? std::sqrt(sq / (v.size() - 1)) : 0.0;
+        };
+
+        Run a = runs.front();
+        a.aggregate = kind;
+        a.name = a.runName + "_" + kind;
+        a.realTime = pick(&Run::realTime);
+        a.cpuTime = pick(&Run::cpuTime);
+        a.itemsPerSecond = pick(&Run::itemsPerSecond);
+        a.bytesPerSecond = pick(&Run::bytesPerSecond);
+        a.counters.clear();
+        return a;
+    }
+
+    std::string formatTime(double ns)
+    {
+        std::ostringstream s;
+        s << std::fixed << std::setprecision(ns < 10 ? 2 : 0);
+        if (ns < 1e4)
+            s << ns << " ns";
+        else if (ns < 1e7)
+            s << ns / 1e3 << " us";
+        else
+            s << ns / 1e6 << " ms";
+        return s.str();
+    }
+
+    void printConsoleHeader(std::ostream& out)
+    {
+        out << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "Time"
+            << std::setw(14) << "CPU" << std::setw(12) << "Iterations" << "  UserCounters" << "\n";
+        out << std::string(110, '-') << "\n";
+    }
+
+    void printConsole(std::ostream& out, const Run& r)
+    {
+        out << std::left << std::setw(48) << r.name << std::right << std::setw(14) << formatTime(r.realTime)
+            << std::setw(14) << formatTime(r.cpuTime) << std::setw(12) << r.iterations;
+        if (r.itemsPerSecond > 0)
+            out << "  items_per_second=" << std::setprecision(4) << r.itemsPerSecond / 1e6 << "M/s";
+        if (r.bytesPerSecond > 0)
+            out << "  bytes_per_second=" << std::setprecision(4) << r.bytesPerSecond / 1048576 << "Mi/s";
+        for (const auto& [key, value] : r.counters)
+            out << "  " << key << "=" << value;
+        out << "\n" << std::flush;
+    }
+
+    std::string jsonString(const std::string& s)
+    {
+        std::string out = "\"";
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    void writeJson(std::ostream& out, const std::vector<Run>& runs)
+    {
+        char date[64];
+        std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof date, "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+        out << std::setprecision(17);
+        out << "{\n  \"context\": {\n";
+        out << "    \"date\": " << jsonString(date) << ",\n";
+        out << "    \"executable\": \"MORTIS_bench\",\n";
+        out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+        out << "    \"mortis_threads\": " << Parallel::ThreadCount() << ",\n";
+#ifdef NDEBUG
+        out << "    \"library_build_type\": \"release\"\n";
+#else
+        out << "    \"library_build_type\": \"debug\"\n";
+#endif
+        out << "  },\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            const Run& r = runs[i];
+            out << "    {\n";
+            out << "      \"name\": " << jsonString(r.name) << ",\n";
+            out << "      \"run_name\": " << jsonString(r.runName) << ",\n";
+            out << "      \"run_type\": " << (r.aggregate.empty() ? "\"iteration\"" : "\"aggregate\"") << ",\n";
+            if (!r.aggregate.empty())
+                out << "      \"aggregate_name\": " << jsonString(r.aggregate) << ",\n";
+            out << "      \"iterations\": " << r.iterations << ",\n";
+            out << "      \"real_time\": " << r.realTime << ",\n";
+            out << "      \"cpu_time\": " << r.cpuTime << ",\n";
+            out << "      \"time_unit\": \"ns\"";
+            if (r.itemsPerSecond > 0)
+                out << ",\n      \"items_per_second\": " << r.itemsPerSecond;
+            if (r.bytesPerSecond > 0)
+                out << ",\n      \"bytes_per_second\": " << r.bytesPerSecond;
+            for (const auto& [key, value] : r.counters)
+                out << ",\n      " << jsonString(key) << ": " << value;
+            out << "\n    }" << (i + 1 < runs.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+    }
+
+    bool parseOption(const std::string& arg, const char* name, std::string& value)
+    {
+        std::string prefix = std::string("--") + name + "=";
+        if (arg.compare(0, prefix.size(), prefix) != 0)
+            return false;
+        value = arg.substr(prefix.size());
+        return true;
+    }
+}
+
+int Benchmark::RunAll(int argc, char** argv)
+{
+    Options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i], value;
+        if (parseOption(arg, "benchmark_filter", value))
+            options.filter = value;
+        else if (parseOption(arg, "benchmark_min_time", value))
+            options.minTime = std::stod(value);
+        else if (parseOption(arg, "benchmark_repetitions", value))
+            options.repetitions = std::max(1, std::stoi(value));
+        else if (parseOption(arg, "benchmark_format", value))
+            options.format = value;
+        else if (parseOption(arg, "benchmark_out", value))
+            options.out = value;
+        else if (arg == "--benchmark_list_tests" || arg == "--benchmark_list_tests=true")
+            options.list = true;
+        else
+        {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return 2;
+        }
+    }
+    if (options.format != "console" && options.format != "json")
+    {
+        std::cerr << "Unknown format: " << options.format << "\n";
+        return 2;
+    }
+
+    std::regex filter(options.filter);
+    std::vector<std::pair<const Benchmark*, std::vector<long long>>> selected;
+    for (const auto& b : registry())
+    {
+        std::vector<std::vector<long long>> args = b->ArgList();
+        if (args.empty())
+            args.push_back({});
+        for (const auto& a : args)
+            if (std::regex_search(runName(*b, a), filter))
+                selected.push_back({b.get(), a});
+    }
+
+    if (options.list)
+    {
+        for (const auto& [b, a] : selected)
+            std::cout << runName(*b, a) << "\n";
+        return 0;
+    }
+
+    bool console = options.format == "console";
+    if (console)
+    {
+#ifndef NDEBUG
+        std::cout << "***WARNING*** MORTIS_bench was built without NDEBUG; timings may not be representative.\n";
+#endif
+        std::cout << "Running " << selected.size() << " benchmarks on " << Parallel::ThreadCount() << " thread(s)\n";
+        printConsoleHeader(std::cout);
+    }
+
+    std::vector<Run> report;
+    for (const auto& [b, a] : selected)
+    {
+        std::vector<Run> runs;
+        for (int rep = 0; rep < options.repetitions; rep++)
+        {
+            runs.push_back(runOnce(*b, a, options.minTime));
+            if (console)
+                printConsole(std::cout, runs.back());
+        }
+        report.insert(report.end(), runs.begin(), runs.end());
+        if (options.repetitions > 1)
+        {
+            for (const char* kind : {"mean", "median", "stddev"})
+            {
+                report.push_back(aggregate(runs, kind));
+                if (console)
+                    printConsole(std::cout, report.back());
+            }
+        }
+    }
+
+    if (!console)
+        writeJson(std::cout, report);
+    if (!options.out.empty())
+    {
+        std::ofstream file(options.out);
+        if (!file)
+        {
+            std::cerr << "Cannot open " << options.out << "\n";
+            return 1;
+        }
+        writeJson(file, report);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    try
+    {
+        return Benchmark::RunAll(argc, argv);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return 1;
+    }
+}
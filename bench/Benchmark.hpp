@@ -0,0 +1,121 @@
+#ifndef BENCHMARK
+#define BENCHMARK
+
+#include <vector>
+#include <string>
+#include <map>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @brief A small Google-Benchmark style harness for the MORTIS_bench target.
+ *
+ * A benchmark is a function taking a BenchmarkState. It prepares its input, then
+ * runs the timed loop
+ *
+ *     while (state.KeepRunning())
+ *         ...;
+ *
+ * and may report a throughput with SetItemsProcessed(). Benchmarks are registered
+ * at static initialization with MORTIS_BENCHMARK(function) and parameterized with
+ * Arg(), Range() or DenseRange(); every argument yields one run named
+ * "function/argument".
+ *
+ * The runner increases the iteration count until a run takes at least the minimum
+ * time, repeats it if asked, and reports the time per iteration on the console
+ * and, optionally, as JSON in the format written by Google Benchmark, so the
+ * output can be compared with bench/compare.py.
+ *
+ * Command line (Google Benchmark names):
+ *   --benchmark_filter=<regex>       run only the benchmarks whose name matches
+ *   --benchmark_min_time=<seconds>   minimum time per run (default 0.2)
+ *   --benchmark_repetitions=<n>      repeat every run and add mean/median/stddev
+ *   --benchmark_format=console|json  format written to stdout
+ *   --benchmark_out=<file>           also write JSON to a file
+ *   --benchmark_list_tests           print the benchmark names and exit
+ */
+
+class BenchmarkState
+{
+    private:
+        std::vector<long long> args;
+        long long maxIterations;
+        long long iterations;       // Completed iterations.
+        bool started;
+        bool paused;
+        std::chrono::steady_clock::time_point wallStart;
+        double wallSeconds;         // Accumulated timed wall-clock time.
+        std::clock_t cpuStart;
+        double cpuSeconds;          // Accumulated timed process CPU time.
+        long long items;
+        long long bytes;
+
+    public:
+        BenchmarkState(const std::vector<long long>& args, long long maxIterations);
+
+        bool KeepRunning();                     // True while iterations remain; starts and stops the timer.
+        long long range(int i = 0) const;       // Argument i of this run.
+        long long Iterations() const;           // Iterations requested for this run.
+
+        void PauseTiming();                     // Exclude the following work (e.g. rebuilding input) from the time.
+        void ResumeTiming();
+
+        void SetItemsProcessed(long long count);   // Items processed over all iterations, reported per second.
+        void SetBytesProcessed(long long count);   // Bytes processed over all iterations, reported per second.
+
+        std::map<std::string, double> counters;    // Extra values copied into the report.
+
+        double ElapsedSeconds() const;
+        double CpuSeconds() const;
+        long long ItemsProcessed() const;
+        long long BytesProcessed() const;
+};
+
+class Benchmark
+{
+    public:
+        using Function = void (*)(BenchmarkState&);
+
+    private:
+        std::string name;
+        Function function;
+        std::vector<std::vector<long long>> argList;    // One entry per run.
+
+    public:
+        Benchmark(const std::string& name, Function function);
+
+        Benchmark* Arg(long long value);                            // Add a run with one argument.
+        Benchmark* Args(const std::vector<long long>& values);      // Add a run with several arguments.
+        Benchmark* Range(long long lo, long long hi, int multiplier = 8);  // lo, lo*m, lo*m^2, ..., hi.
+        Benchmark* DenseRange(long long lo, long long hi, long long step = 1);
+
+        const std::string& Name() const;
+        Function Body() const;
+        const std::vector<std::vector<long long>>& ArgList() const;
+
+        // Register a benchmark; the returned object stays alive until exit.
+        static Benchmark* Register(const char* name, Function function);
+
+        // Parse the command line, run the selected benchmarks and report. Returns the exit code.
+        static int RunAll(int argc, char** argv);
+};
+
+// Keep the compiler from optimizing away a computed value.
+template <class T>
+inline void DoNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    volatile const T* sink = &value;
+    (void)sink;
+#endif
+}
+
+#define MORTIS_BENCHMARK_CONCAT2(a, b) a##b
+#define MORTIS_BENCHMARK_CONCAT(a, b) MORTIS_BENCHMARK_CONCAT2(a, b)
+#define MORTIS_BENCHMARK(function) \
+    static Benchmark* MORTIS_BENCHMARK_CONCAT(benchmark_, __LINE__) = Benchmark::Register(#function, function)
+
+#endif
@@ -0,0 +1,171 @@
+#include <vector>
+#include <random>
+#include <algorithm>
+#include "Benchmark.hpp"
+#include "hash/HashTable/HashTable.hpp"
+#include "tree/MaxHeap/MaxHeap.hpp"
+#include "tree/MinHeap/MinHeap.hpp"
+#include "tree/BinarySearchTree/BinarySearchTree.hpp"
+#include "tree/Set/Set.hpp"
+
+// n distinct keys in random order.
+static std::vector<int> shuffledKeys(int n, unsigned seed)
+{
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++)
+        keys[i] = i * 7 + 1;
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+    return keys;
+}
+
+// ================================
+// HashTable
+// ================================
+
+static void HashTableInsert(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 1);
+    while (state.KeepRunning())
+    {
+        HashTable<int> table(n);
+        for (int k : keys)
+            table.insert(k);
+        DoNotOptimize(table);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(HashTableInsert)->Range(1 << 8, 1 << 16);
+
+// Half of the lookups hit, half miss.
+static void HashTableLookup(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 1);
+    HashTable<int> table(n);
+    for (int k : keys)
+        table.insert(k);
+    while (state.KeepRunning())
+    {
+        int found = 0;
+        for (int k : keys)
+            found += table.search(k) + table.search(k + 1);
+        DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.Iterations() * 2 * n);
+}
+MORTIS_BENCHMARK(HashTableLookup)->Range(1 << 8, 1 << 16);
+
+// ================================
+// Heaps
+// ================================
+
+static void MaxHeapPushPop(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 2);
+    while (state.KeepRunning())
+    {
+        MaxHeap<int> heap(keys[0]);
+        for (int i = 1; i < n; i++)
+            heap.Push(keys[i]);
+        for (int i = 1; i < n; i++)
+            heap.Pop();
+        DoNotOptimize(heap);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(MaxHeapPushPop)->Range(32, 256, 2);
+
+static void MinHeapPushPop(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 2);
+    while (state.KeepRunning())
+    {
+        MinHeap<int> heap(keys[0]);
+        for (int i = 1; i < n; i++)
+            heap.Push(keys[i]);
+        for (int i = 1; i < n; i++)
+            heap.Pop();
+        DoNotOptimize(heap);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(MinHeapPushPop)->Range(32, 256, 2);
+
+// ================================
+// BinarySearchTree and Set
+// ================================
+
+static void BinarySearchTreeInsert(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 3);
+    while (state.KeepRunning())
+    {
+        BinarySearchTree<int> tree(keys[0]);
+        for (int i = 1; i < n; i++)
+            tree.Insert(keys[i]);
+        DoNotOptimize(tree);
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(BinarySearchTreeInsert)->Range(1 << 8, 1 << 16);
+
+static void BinarySearchTreeGet(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 3);
+    BinarySearchTree<int> tree(keys[0]);
+    for (int i = 1; i < n; i++)
+        tree.Insert(keys[i]);
+    while (state.KeepRunning())
+    {
+        for (int k : keys)
+        {
+            int* value = tree.Get(k);
+            DoNotOptimize(value);
+            delete value;
+        }
+    }
+    state.SetItemsProcessed(state.Iterations() * n);
+}
+MORTIS_BENCHMARK(BinarySearchTreeGet)->Range(1 << 8, 1 << 16);
+
+static void SetContains(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(n, 4);
+    Set<int> set;
+    for (int k : keys)
+        set.Insert(k);
+    while (state.KeepRunning())
+    {
+        int found = 0;
+        for (int k : keys)
+            found += set.Contains(k) + set.Contains(k + 1);
+        DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.Iterations() * 2 * n);
+}
+MORTIS_BENCHMARK(SetContains)->Range(1 << 8, 1 << 14);
+
+static void SetUnion(BenchmarkState& state)
+{
+    int n = static_cast<int>(state.range(0));
+    std::vector<int> keys = shuffledKeys(2 * n, 5);
+    Set<int> a, b;
+    for (int i = 0; i < n; i++)
+    {
+        a.Insert(keys[i]);
+        b.Insert(keys[n + i]);
+    }
+    while (state.KeepRunning())
+    {
+        Set<int> u = a.Union(b);
+        DoNotOptimize(u);
+    }
+    state.SetItemsProcessed(state.Iterations() * 2 * n);
+}
+MORTIS_BENCHMARK(SetUnion)->Range(1 << 8, 1 << 14);
@@ -0,0 +1,509 @@
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "Benchmark.hpp"
+#include "graph/Graph/Graph.hpp"
+#include "graph/MultiGraph/MultiGraph.hpp"
+#include "graph/GraphLoader/GraphLoader.hpp"
+#include "graph/GraphView/GraphView.hpp"
+#include "graph/GraphAnalytics/GraphAnalytics.hpp"
+#include "graph/GraphOrdering/GraphOrdering.hpp"
+#include "graph/GraphPartitioner/GraphPartitioner.hpp"
+#include "graph/FlowNetwork/FlowNetwork.hpp"
+#include "graph/UnionFind/UnionFind.hpp"
+#include "graph/ContractionHierarchy/ContractionHierarchy.hpp"
+
+// ================================
+// Generated Inputs
+// ================================
+
+/**
+ * @brief R-MAT graph with 2^scale vertices and edgeFactor * 2^scale edges.
+ *
+ * Every edge picks its quadrant recursively with the Graph500 probabilities
+ * (0.57, 0.19, 0.19, 0.05), which gives the skewed degree distribution of
+ * social and web graphs. Weights are integers in [1, 100].
+ */
+static EdgeArray rmat(int scale, int edgeFactor, unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> unit(0, 1);
+    EdgeArray edges;
+    edges.numNodes = 1 << scale;
+    long long m = static_cast<long long>(edgeFactor) << scale;
+    edges.source.reserve(m);
+    edges.target.reserve(m);
+    edges.weight.reserve(m);
+    for (long long i = 0; i < m; i++)
+    {
+        int u = 0, v = 0;
+        for (int bit = 0; bit < scale; bit++)
+        {
+            double p = unit(rng);
+            if (p >= 0.57 + 0.19 + 0.19)
+            {
+                u |= 1 << bit;
+                v |= 1 << bit;
+            }
+            else if (p >= 0.57 + 0.19)
+                u |= 1 << bit;
+            else if (p >= 0.57)
+                v |= 1 << bit;
+        }
+        edges.source.push_back(u);
+        edges.target.push_back(v);
+        edges.weight.push_back(static_cast<double>(1 + rng() % 100));
+    }
+    return edges;
+}
+
+// side x side grid with edges to the right and lower neighbor; integer weights in [1, 100].
+static EdgeArray grid(int side, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    EdgeArray edges;
+    edges.numNodes = side * side;
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++)
+        {
+            int u = r * side + c;
+            if (c + 1 < side)
+            {
+                edges.source.push_back(u);
+                edges.target.push_back(u + 1);
+                edges.weight.push_back(static_cast<double>(1 + rng() % 100));
+            }
+            if (r + 1 < side)
+            {
+                edges.source.push_back(u);
+                edges.target.push_back(u + side);
+                edges.weight.push_back(static_cast<double>(1 + rng() % 100));
+            }
+        }
+    return edges;
+}
+
+// Path of length vertices, the worst case for level-synchronous searches; weights in [1, 100].
+static EdgeArray path(int length, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    EdgeArray edges;
+    edges.numNodes = length;
+    for (int u = 0; u + 1 < length; u++)
+    {
+        edges.source.push_back(u);
+        edges.target.push_back(u + 1);
+        edges.weight.push_back(static_cast<double>(1 + rng() % 100));
+    }
+    return edges;
+}
+
+// Graph for a benchmark argument pair {kind, size}: kind 0 is R-MAT of scale size,
+// kind 1 a grid of side size, kind 2 a path of size vertices.
+static Graph input(long long kind, long long size)
+{
+    if (kind == 0)
+        return Graph::FromEdges(rmat(static_cast<int>(size), 16, 1));
+    if (kind == 2)
+        return Graph::FromEdges(path(static_cast<int>(size), 1));
+    return Graph::FromEdges(grid(static_cast<int>(size), 1));
+}
+
+// ================================
+// Construction and Traversal
+// ================================
+
+static void GraphFromEdges(BenchmarkState& state)
+{
+    EdgeArray edges = rmat(static_cast<int>(state.range(0)), 16, 1);
+    while (state.KeepRunning())
+    {
+        Graph g = Graph::FromEdges(edges);
+        DoNotOptimize(g);
+    }
+    state.SetItemsProcessed(state.Iterations() * edges.source.size());
+}
+MORTIS_BENCHMARK(GraphFromEdges)->DenseRange(12, 16, 2);
+
+// Cold start from a snapshot: mapping it and touching one neighborhood, against
+// rebuilding a mutable Graph from the same file.
+static void GraphSnapshotOpen(BenchmarkState& state)
+{
+    input(0, state.range(0)).Save("bench-graph.snapshot");
+    while (state.KeepRunning())
+    {
+        GraphView view("bench-graph.snapshot");
+        DoNotOptimize(view.OutArcs(0).size);
+    }
+    std::remove("bench-graph.snapshot");
+}
+MORTIS_BENCHMARK(GraphSnapshotOpen)->DenseRange(12, 16, 4);
+
+static void GraphSnapshotLoad(BenchmarkState& state)
+{
+    Graph g = input(0, state.range(0));
+    g.Save("bench-graph.snapshot");
+    while (state.KeepRunning())
+        DoNotOptimize(Graph::Load("bench-graph.snapshot"));
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+    std::remove("bench-graph.snapshot");
+}
+MORTIS_BENCHMARK(GraphSnapshotLoad)->DenseRange(12, 16, 4);
+
+static void GraphBFS(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    while (state.KeepRunning())
+        DoNotOptimize(g.BFS(0));
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphBFS)->Args({0, 12})->Args({0, 16})->Args({1, 64})->Args({1, 256})->Args({2, 1 << 18});
+
+static void GraphParallelBFS(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    while (state.KeepRunning())
+        DoNotOptimize(g.ParallelBFS(0));
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphParallelBFS)->Args({0, 12})->Args({0, 16})->Args({1, 64})->Args({1, 256})->Args({2, 1 << 18});
+
+// Arguments {sources, batched}: BFS from the first sources vertices of an R-MAT graph
+// of scale 14, one ParallelBFS per source (0) or one MultiSourceBFS (1).
+static void GraphMultiSourceBFS(BenchmarkState& state)
+{
+    Graph g = input(0, 14);
+    std::vector<int> sources;
+    for (int s = 0; s < state.range(0); s++)
+        sources.push_back(s);
+    while (state.KeepRunning())
+    {
+        if (state.range(1) == 0)
+            for (int s : sources)
+                DoNotOptimize(g.ParallelBFS(s));
+        else
+            DoNotOptimize(g.MultiSourceBFS(sources));
+    }
+    state.SetItemsProcessed(state.Iterations() * state.range(0) * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphMultiSourceBFS)->Args({64, 0})->Args({64, 1})->Args({256, 0})->Args({256, 1});
+
+// ================================
+// Shortest Paths
+// ================================
+
+// Arguments {kind, size, heap} with heap a HeapType value.
+static void GraphDijkstra(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    HeapType heap = static_cast<HeapType>(state.range(2));
+    while (state.KeepRunning())
+        DoNotOptimize(g.Dijkstra(0, heap));
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphDijkstra)
+    ->Args({0, 16, 0})->Args({0, 16, 1})->Args({0, 16, 2})->Args({0, 16, 3})
+    ->Args({1, 256, 0})->Args({1, 256, 1})->Args({1, 256, 2})->Args({1, 256, 3});
+
+static void GraphDeltaStepping(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    while (state.KeepRunning())
+        DoNotOptimize(g.DeltaStepping(0));
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphDeltaStepping)->Args({0, 16})->Args({1, 256});
+
+// One query between two vertices 64 rows and columns apart in the middle of a
+// 256 x 256 grid; the argument picks the search: 0 Dijkstra, 1 A* with the
+// Manhattan distance (admissible since every weight is at least 1),
+// 2 bidirectional Dijkstra, 3 bidirectional BFS. Reports the vertices visited.
+static void GraphPointToPoint(BenchmarkState& state)
+{
+    const int side = 256;
+    Graph g = Graph::FromEdges(grid(side, 1));
+    int s = 96 * side + 96, t = 160 * side + 160;
+    auto manhattan = [&](int v) { return static_cast<double>(std::abs(v / side - t / side) + std::abs(v % side - t % side)); };
+    PathResult last{};
+    while (state.KeepRunning())
+    {
+        switch (state.range(0))
+        {
+            case 0: last = g.AStar(s, t, [](int) { return 0.0; }); break;
+            case 1: last = g.AStar(s, t, manhattan); break;
+            case 2: last = g.BidirectionalDijkstra(s, t); break;
+            default: last = g.BidirectionalBFS(s, t); break;
+        }
+        DoNotOptimize(last);
+    }
+    state.counters["visited"] = last.visited;
+}
+MORTIS_BENCHMARK(GraphPointToPoint)->DenseRange(0, 3);
+
+static void ContractionHierarchyBuild(BenchmarkState& state)
+{
+    Graph g = Graph::FromEdges(grid(static_cast<int>(state.range(0)), 1));
+    while (state.KeepRunning())
+    {
+        ContractionHierarchy ch(g);
+        DoNotOptimize(ch);
+    }
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfNodes());
+}
+MORTIS_BENCHMARK(ContractionHierarchyBuild)->Arg(64)->Arg(128);
+
+// Random queries on a 256 x 256 grid: 0 Dijkstra(s, t), 1 ContractionHierarchy::Query.
+static void ContractionHierarchyQuery(BenchmarkState& state)
+{
+    const int side = 256;
+    Graph g = Graph::FromEdges(grid(side, 1));
+    ContractionHierarchy ch(g);
+    std::mt19937 rng(7);
+    while (state.KeepRunning())
+    {
+        int s = static_cast<int>(rng() % (side * side)), t = static_cast<int>(rng() % (side * side));
+        if (state.range(0) == 0)
+            DoNotOptimize(g.Dijkstra(s, t));
+        else
+            DoNotOptimize(ch.Query(s, t));
+    }
+    state.SetItemsProcessed(state.Iterations());
+}
+MORTIS_BENCHMARK(ContractionHierarchyQuery)->Arg(0)->Arg(1);
+
+static void GraphFloydWarshall(BenchmarkState& state)
+{
+    Graph g = input(0, state.range(0));
+    while (state.KeepRunning())
+        DoNotOptimize(g.FloydWarshall<double>());
+    long long n = g.NumberOfNodes();
+    state.SetItemsProcessed(state.Iterations() * n * n * n);
+}
+MORTIS_BENCHMARK(GraphFloydWarshall)->DenseRange(7, 9);
+
+// ================================
+// Spanning Trees
+// ================================
+
+// Arguments {scale, algorithm}: 0 Kruskal, 1 Prim, 2 Sollin, on an R-MAT graph.
+static void GraphMinimumSpanningTree(BenchmarkState& state)
+{
+    Graph g = input(0, state.range(0));
+    while (state.KeepRunning())
+    {
+        if (state.range(1) == 0)
+            DoNotOptimize(g.Kruskal());
+        else if (state.range(1) == 1)
+            DoNotOptimize(g.Prim());
+        else
+            DoNotOptimize(g.Sollin());
+    }
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphMinimumSpanningTree)->Args({16, 0})->Args({16, 1})->Args({16, 2});
+
+static void UnionFindUniteAll(BenchmarkState& state)
+{
+    EdgeArray edges = rmat(static_cast<int>(state.range(0)), 16, 1);
+    while (state.KeepRunning())
+    {
+        UnionFind uf(edges.numNodes);
+        DoNotOptimize(uf.UniteAll(edges.source, edges.target));
+    }
+    state.SetItemsProcessed(state.Iterations() * edges.source.size());
+}
+MORTIS_BENCHMARK(UnionFindUniteAll)->DenseRange(12, 16, 2);
+
+// ================================
+// Analytics
+// ================================
+
+static void GraphPageRank(BenchmarkState& state)
+{
+    Graph g = input(0, state.range(0));
+    PageRankMode mode = state.range(1) ? PageRankMode::PUSH : PageRankMode::PULL;
+    const CSRGraph& csr = g.Compressed();
+    while (state.KeepRunning())
+        DoNotOptimize(GraphAnalytics::PageRank(csr, 0.85, 1e-6, 100, mode));
+    state.SetItemsProcessed(state.Iterations() * csr.Targets().size());
+}
+MORTIS_BENCHMARK(GraphPageRank)->Args({14, 0})->Args({14, 1});
+
+static void GraphTriangleCount(BenchmarkState& state)
+{
+    Graph g = input(0, state.range(0));
+    const CSRGraph& csr = g.Compressed();
+    while (state.KeepRunning())
+        DoNotOptimize(GraphAnalytics::TriangleCount(csr));
+    state.SetItemsProcessed(state.Iterations() * csr.Targets().size());
+}
+MORTIS_BENCHMARK(GraphTriangleCount)->DenseRange(12, 16, 2);
+
+// Arguments {kind, size} as for GraphBFS.
+static void GraphConnectedComponents(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    const CSRGraph& csr = g.Compressed();
+    while (state.KeepRunning())
+        DoNotOptimize(GraphAnalytics::ConnectedComponents(csr));
+    state.SetItemsProcessed(state.Iterations() * csr.Targets().size());
+}
+MORTIS_BENCHMARK(GraphConnectedComponents)->Args({0, 16})->Args({1, 256});
+
+// Arguments {kind, size} as for GraphBFS.
+static void GraphBiconnected(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    while (state.KeepRunning())
+        DoNotOptimize(g.BiconnectedDecomposition());
+    state.SetItemsProcessed(state.Iterations() * g.Compressed().Targets().size());
+}
+MORTIS_BENCHMARK(GraphBiconnected)->Args({0, 14})->Args({1, 256});
+
+// Arguments {kind, strategy}: ten PageRank rounds on an R-MAT graph of scale 18 (kind 0)
+// or a grid of side 1024 (kind 1) whose nodes were shuffled, as left (0) or after
+// Reorder() with RCM (1), degree (2) or Gorder (3). Reordering itself is not timed.
+static void GraphReorder(BenchmarkState& state)
+{
+    Graph g = state.range(0) == 0 ? input(0, 18) : input(1, 1024);
+    std::vector<int> shuffled = g.Nodes();
+    std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(7));
+    g.Reorder(shuffled);
+    const OrderingStrategy strategies[] = {OrderingStrategy::REVERSE_CUTHILL_MCKEE, OrderingStrategy::DEGREE, OrderingStrategy::GORDER};
+    if (state.range(1) > 0)
+        g.Reorder(strategies[state.range(1) - 1]);
+    const CSRGraph& csr = g.Compressed();
+    while (state.KeepRunning())
+        DoNotOptimize(GraphAnalytics::PageRank(csr, 0.85, 1e-12, 10));
+    state.counters["gap"] = GraphOrdering::AverageGap(csr);
+    state.SetItemsProcessed(state.Iterations() * 10 * csr.Targets().size());
+}
+MORTIS_BENCHMARK(GraphReorder)->Args({0, 0})->Args({0, 1})->Args({0, 2})->Args({0, 3})
+    ->Args({1, 0})->Args({1, 1})->Args({1, 2})->Args({1, 3});
+
+// Arguments {kind, size, parts} as for GraphBFS plus the number of parts. The counters
+// give the fraction of edges cut and the communication volume per node.
+static void GraphPartition(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    PartitionResult result;
+    while (state.KeepRunning())
+    {
+        result = g.Partition(static_cast<int>(state.range(2)));
+        DoNotOptimize(result);
+    }
+    state.counters["cut"] = static_cast<double>(result.edgeCut) / g.NumberOfEdges();
+    state.counters["volume"] = static_cast<double>(result.communicationVolume) / g.NumberOfNodes();
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(GraphPartition)->Args({0, 16, 16})->Args({1, 512, 16})->Args({1, 512, 256});
+
+// Arguments {kind, size, algorithm} as for GraphBFS plus 0 for push-relabel or 1 for
+// Dinic. The arcs of the graph become directed edges with their weights as capacities;
+// the flow goes from node 0 to node 1 (two hubs) on R-MAT and corner to corner on grids.
+// The network is built once, as for repeated capacity queries.
+static void GraphMaxFlow(BenchmarkState& state)
+{
+    Graph g = input(state.range(0), state.range(1));
+    const CSRGraph& csr = g.Compressed();
+    int n = csr.NumberOfNodes();
+    std::vector<int> src(csr.Targets().size());
+    for (int u = 0; u < n; u++)
+        for (int i = csr.Offsets()[u]; i < csr.Offsets()[u + 1]; i++)
+            src[i] = u;
+    FlowNetwork network(n, src, csr.Targets(), csr.Weights());
+    int t = state.range(0) == 0 ? 1 : n - 1;
+    FlowAlgorithm algorithm = state.range(2) == 0 ? FlowAlgorithm::PUSH_RELABEL : FlowAlgorithm::DINIC;
+    FlowResult result;
+    while (state.KeepRunning())
+    {
+        result = network.MaxFlow(0, t, algorithm);
+        DoNotOptimize(result);
+    }
+    state.counters["flow"] = result.value;
+    state.SetItemsProcessed(state.Iterations() * src.size());
+}
+MORTIS_BENCHMARK(GraphMaxFlow)->Args({0, 16, 0})->Args({0, 16, 1})->Args({1, 512, 0})->Args({1, 512, 1});
+
+// ================================
+// MultiGraph
+// ================================
+
+// Degree and EdgeCount of every edge's endpoints plus isEulerian on an R-MAT
+// multigraph of the given scale (duplicate R-MAT edges become parallel edges).
+static void MultiGraphQueries(BenchmarkState& state)
+{
+    EdgeArray edges = rmat(static_cast<int>(state.range(0)), 8, 1);
+    MultiGraph g(1 << state.range(0));
+    for (size_t i = 0; i < edges.source.size(); i++)
+        g.AddEdge(edges.source[i], edges.target[i]);
+    while (state.KeepRunning())
+    {
+        long long sum = 0;
+        for (size_t i = 0; i < edges.source.size(); i++)
+            sum += g.Degree(edges.source[i]) + g.EdgeCount(edges.source[i], edges.target[i]);
+        DoNotOptimize(sum);
+        DoNotOptimize(g.isEulerian());
+    }
+    state.SetItemsProcessed(state.Iterations() * edges.source.size());
+}
+MORTIS_BENCHMARK(MultiGraphQueries)->Arg(10)->Arg(16);
+
+// Eulerian circuit of a union of random closed walks with 2^scale nodes and
+// 16 * 2^scale edges, directed (1) or undirected (0).
+static void MultiGraphEulerianCircuit(BenchmarkState& state)
+{
+    int n = 1 << state.range(0);
+    MultiGraph g(n, false, state.range(1) != 0);
+    std::mt19937 rng(3);
+    for (int walk = 0; walk < n / 64; walk++)
+    {
+        int first = rng() % n, at = first;
+        for (int step = 1; step < 1024; step++)
+        {
+            int next = rng() % n;
+            g.AddEdge(at, next);
+            at = next;
+        }
+        g.AddEdge(at, first);
+    }
+    while (state.KeepRunning())
+        DoNotOptimize(g.EulerianCircuit());
+    state.SetItemsProcessed(state.Iterations() * g.NumberOfEdges());
+}
+MORTIS_BENCHMARK(MultiGraphEulerianCircuit)->Args({16, 0})->Args({16, 1})->Args({18, 0});
+
+// Collapse of a weighted R-MAT multigraph of the given scale with edge factor 16
+// (R-MAT repeats many edges) into a simple Graph, summing parallel weights.
+static void MultiGraphCollapse(BenchmarkState& state)
+{
+    EdgeArray edges = rmat(static_cast<int>(state.range(0)), 16, 1);
+    MultiGraph g(1 << state.range(0), true);
+    for (size_t i = 0; i < edges.source.size(); i++)
+        g.AddEdge(edges.source[i], edges.target[i], edges.weight[i]);
+    while (state.KeepRunning())
+        DoNotOptimize(g.Collapse(EdgeAggregator::SUM));
+    state.SetItemsProcessed(state.Iterations() * edges.source.size());
+}
+MORTIS_BENCHMARK(MultiGraphCollapse)->Arg(12)->Arg(16);
+
+// Streaming ingestion of the edges of an R-MAT graph of the given scale with edge
+// factor 8, one per time unit, into a sliding window of the given number of time
+// units (0 keeps every edge).
+static void MultiGraphIngest(BenchmarkState& state)
+{
+    EdgeArray edges = rmat(static_cast<int>(state.range(0)), 8, 1);
+    while (state.KeepRunning())
+    {
+        MultiGraph g(1 << state.range(0), false, true);
+        if (state.range(1) > 0)
+            g.SetWindow(static_cast<double>(state.range(1)));
+        for (size_t i = 0; i < edges.source.size(); i++)
+            g.Ingest(edges.source[i], edges.target[i], static_cast<double>(i));
+        DoNotOptimize(g.Degree(0));
+    }
+    state.SetItemsProcessed(state.Iterations() * edges.source.size());
+}
+MORTIS_BENCHMARK(MultiGraphIngest)->Args({16, 0})->Args({16, 65536})->Args({20, 0})->Args({20, 1 << 20});
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Compare two MORTIS_bench JSON reports and flag performance regressions.
+
+Usage:
+    compare.py [--threshold 0.10] [--metric real_time|cpu_time] baseline.json current.json
+
+Runs are matched by name. If a report was written with --benchmark_repetitions,
+the median aggregate of each run is compared; otherwise the single run. The
+script prints the relative change of every benchmark present in both reports
+and exits with status 1 if any of them became slower by more than the
+threshold (a fraction: 0.10 means 10 %).
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path, metric):
+    """Map run name -> time in nanoseconds, preferring median aggregates."""
+    with open(path) as f:
+        report = json.load(f)
+    scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    single, median = {}, {}
+    for b in report.get("benchmarks", []):
+        name = b.get("run_name", b["name"])
+        value = b[metric] * scale[b.get("time_unit", "ns")]
+        if b.get("run_type") == "aggregate":
+            if b.get("aggregate_name") == "median":
+                median[name] = value
+        else:
+            single.setdefault(name, []).append(value)
+    times = {name: sorted(v)[len(v) // 2] for name, v in single.items()}
+    times.update(median)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare two MORTIS_bench JSON reports.")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10,
+                        help="relative slowdown reported as a regression (default 0.10)")
+    parser.add_argument("--metric", choices=["real_time", "cpu_time"], default="real_time")
+    args = parser.parse_args()
+
+    base = load(args.baseline, args.metric)
+    cur = load(args.current, args.metric)
+
+    regressions = 0
+    width = max([len(n) for n in cur] + [9])
+    print(f"{'Benchmark':<{width}}  {'Baseline':>12}  {'Current':>12}  {'Change':>8}")
+    for name in cur:
+        if name not in base:
+            print(f"{name:<{width}}  {'-':>12}  {cur[name]:>10.0f}ns  {'new':>8}")
+            continue
+        change = (cur[name] - base[name]) / base[name] if base[name] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{name:<{width}}  {base[name]:>10.0f}ns  {cur[name]:>10.0f}ns  {change:>+7.1%}{flag}")
+    for name in base:
+        if name not in cur:
+            print(f"{name:<{width}}  {base[name]:>10.0f}ns  {'-':>12}  {'missing':>8}")
+
+    if regressions:
+        print(f"\n{regressions} benchmark(s) slower than the baseline by more than {args.threshold:.0%}.")
+        return 1
+    print(f"\nNo regression above {args.threshold:.0%}.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
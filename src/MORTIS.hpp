@@ -67,11 +67,39 @@
 // Graph
 // ================================================================
 
+#include "./MORTIS/graph/Parallel/Parallel.hpp"
+#include "./MORTIS/graph/UnionFind/UnionFind.hpp"
+#include "./MORTIS/graph/EdgeStore/EdgeStore.hpp"
+#include "./MORTIS/graph/EdgeLog/EdgeLog.hpp"
+#include "./MORTIS/graph/CSRGraph/CSRGraph.hpp"
+#include "./MORTIS/graph/VertexQueue/VertexQueue.hpp"
+#include "./MORTIS/graph/GraphLoader/GraphLoader.hpp"
+#include "./MORTIS/graph/GraphView/GraphView.hpp"
+#include "./MORTIS/graph/DistanceMatrix/DistanceMatrix.hpp"
+#include "./MORTIS/graph/GraphAnalytics/GraphAnalytics.hpp"
+#include "./MORTIS/graph/GraphOrdering/GraphOrdering.hpp"
+#include "./MORTIS/graph/GraphPartitioner/GraphPartitioner.hpp"
+#include "./MORTIS/graph/FlowNetwork/FlowNetwork.hpp"
 #include "./MORTIS/graph/Graph/Graph.hpp"
 #include "./MORTIS/graph/MultiGraph/MultiGraph.hpp"
-
+#include "./MORTIS/graph/ContractionHierarchy/ContractionHierarchy.hpp"
+
+#include "./MORTIS/graph/Parallel/Parallel.cpp"
+#include "./MORTIS/graph/UnionFind/UnionFind.cpp"
+#include "./MORTIS/graph/EdgeStore/EdgeStore.cpp"
+#include "./MORTIS/graph/EdgeLog/EdgeLog.cpp"
+#include "./MORTIS/graph/CSRGraph/CSRGraph.cpp"
+#include "./MORTIS/graph/VertexQueue/VertexQueue.cpp"
+#include "./MORTIS/graph/GraphLoader/GraphLoader.cpp"
+#include "./MORTIS/graph/GraphView/GraphView.cpp"
+#include "./MORTIS/graph/DistanceMatrix/DistanceMatrix.cpp"
+#include "./MORTIS/graph/GraphAnalytics/GraphAnalytics.cpp"
+#include "./MORTIS/graph/GraphOrdering/GraphOrdering.cpp"
+#include "./MORTIS/graph/GraphPartitioner/GraphPartitioner.cpp"
+#include "./MORTIS/graph/FlowNetwork/FlowNetwork.cpp"
 #include "./MORTIS/graph/Graph/Graph.cpp"
 #include "./MORTIS/graph/MultiGraph/MultiGraph.cpp"
+#include "./MORTIS/graph/ContractionHierarchy/ContractionHierarchy.cpp"
 
 // ================================================================
 // Hash
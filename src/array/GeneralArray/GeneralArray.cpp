@@ -29,7 +29,7 @@ int GeneralArray<T>::computeLinearIndex(const Index& idx) const
 // =======================================================
 
 template <class T>
-GeneralArray<T>::GeneralArray(): dimension(0), totalSize(0), data(nullptr) {}
+GeneralArray<T>::GeneralArray(): dimension(0), totalSize(0), capacity(0), data(nullptr) {}
 
 template <class T>
 GeneralArray<T>::GeneralArray(int j, const RangeList& list, T initValue)
@@ -45,6 +45,7 @@ GeneralArray<T>::GeneralArray(int j, const RangeList& list, T initValue)
             throw std::invalid_argument("Dimension sizes must be positive");
         totalSize *= list[i];
     }
+    capacity = totalSize;
     data = new T[totalSize];
     for (int i = 0; i < totalSize; i++)
         data[i] = initValue;
@@ -56,6 +57,7 @@ GeneralArray<T>::GeneralArray(const GeneralArray<T>& other) // Copy constructor:
     dimension = other.dimension;
     dims = other.dims;
     totalSize = other.totalSize;
+    capacity = totalSize;
     data = new T[totalSize];
 
     for (int i = 0; i < totalSize; i++)
@@ -161,21 +163,26 @@ void GeneralArray<T>::Reverse()
 template <class T>
 void GeneralArray<T>::Push_back(const T& value) 
 {
-    // Allocate a new array of size totalSize + 1.
-    T* newData = new T[totalSize + 1];
-
-    // Copy existing elements.
-    for (int i = 0; i < totalSize; i++) 
+    // Grow the storage geometrically, so that n calls cost O(n) in total.
+    if (totalSize == capacity) 
     {
-        newData[i] = data[i];
+        int newCapacity = (capacity == 0) ? 4 : 2 * capacity;
+        T* newData = new T[newCapacity];
+
+        // Move existing elements.
+        for (int i = 0; i < totalSize; i++) 
+        {
+            newData[i] = std::move(data[i]);
+        }
+
+        // Free the old memory.
+        delete[] data;
+        data = newData;
+        capacity = newCapacity;
     }
 
     // Append the new value.
-    newData[totalSize] = value;
-
-    // Free the old memory.
-    delete[] data;
-    data = newData;
+    data[totalSize] = value;
     totalSize++;
 
     // Also update dims[0] if dims is not empty.
@@ -183,6 +190,23 @@ void GeneralArray<T>::Push_back(const T& value)
         dims[0] = totalSize;
 }
 
+// Reserve: grow the storage once so that the next Push_back calls do not reallocate.
+template <class T>
+void GeneralArray<T>::Reserve(int count) 
+{
+    if (count <= capacity)
+        return;
+
+    T* newData = new T[count];
+    for (int i = 0; i < totalSize; i++) 
+    {
+        newData[i] = std::move(data[i]);
+    }
+    delete[] data;
+    data = newData;
+    capacity = count;
+}
+
 // =======================================================
 // Operator overloading
 // =======================================================
@@ -196,6 +220,7 @@ GeneralArray<T>& GeneralArray<T>::operator=(const GeneralArray<T>& other)   // A
         dimension = other.dimension;
         dims = other.dims;
         totalSize = other.totalSize;
+        capacity = totalSize;
         data = new T[totalSize];
 
         for (int i = 0; i < totalSize; i++)
@@ -45,6 +45,7 @@ class GeneralArray
         RangeList dims;                       // Vector holding the size of each dimension
         T* data;                              // Pointer to the underlying flat array data
         int totalSize;                        // Total number of elements (product of dims)
+        int capacity;                         // Allocated slots in data (>= totalSize, grows geometrically in Push_back)
 
         // Helper function: convert a multi-dimensional index to a linear index (row-major order)
         int computeLinearIndex(const Index& idx) const;
@@ -67,7 +68,8 @@ class GeneralArray
         void Store(const Index& idx, T x);  // pdate the element at the given multi-dimensional index with value x
         void Sort(bool reverse = false, int sortDim = 1);   // sort the array based on parameters.
         void Reverse(); // 'reverse' true means ascending order; false means descending order (default false).
-        void Push_back(const T& value); // For 1D arrays only.
+        void Push_back(const T& value); // For 1D arrays only. Amortized O(1).
+        void Reserve(int count);        // Make room for at least count elements without changing the contents.
         
         // Operator overloading
         GeneralArray<T>& operator=(const GeneralArray<T>& other);   // deep copy assignment from another GeneralArray
@@ -0,0 +1,72 @@
+// CSRGraph-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 CSRGraph.cpp CSRGraph-test.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include "CSRGraph.hpp"
+
+using namespace std;
+
+// Print the out-arcs of every vertex as "u: v(w) v(w) ..."
+void PrintArcs(const CSRGraph& g)
+{
+    const vector<int>& offset = g.Offsets();
+    const vector<int>& target = g.Targets();
+    const vector<double>& weight = g.Weights();
+    for (int u = 0; u < g.NumberOfNodes(); u++)
+    {
+        cout << " " << u << ":";
+        for (int i = offset[u]; i < offset[u + 1]; i++)
+            cout << " " << target[i] << "(" << weight[i] << ")";
+        cout << endl;
+    }
+}
+
+int main()
+{
+    cout << "=== CSRGraph Test Program ===" << endl << endl;
+
+    // Edges {0,1,4} {0,2,1} {2,1,2} {1,3,5} {2,3,8}
+    vector<int> src = {0, 0, 2, 1, 2};
+    vector<int> dst = {1, 2, 1, 3, 3};
+    vector<double> w = {4, 1, 2, 5, 8};
+
+    // --- Undirected: every edge is stored in both directions ---
+    CSRGraph undirected(4, src, dst, w, false);
+    cout << "Undirected CSR (" << undirected.NumberOfArcs() << " arcs):" << endl;
+    PrintArcs(undirected);
+    assert(undirected.NumberOfArcs() == 10);
+    assert(undirected.OutDegree(2) == 3);
+    assert(undirected.InDegree(2) == 3);
+    assert(&undirected.Sources() == &undirected.Targets());
+
+    // --- Directed: out-arcs in CSR, in-arcs in CSC ---
+    CSRGraph directed(4, src, dst, w, true);
+    cout << endl << "Directed CSR (" << directed.NumberOfArcs() << " arcs):" << endl;
+    PrintArcs(directed);
+    assert(directed.NumberOfArcs() == 5);
+    assert(directed.OutDegree(3) == 0);
+    assert(directed.InDegree(3) == 2);
+
+    cout << "In-arcs of 1:";
+    const vector<int>& inOffset = directed.InOffsets();
+    for (int i = inOffset[1]; i < inOffset[2]; i++)
+        cout << " " << directed.Sources()[i] << "(" << directed.InWeights()[i] << ")";
+    cout << endl;
+
+    // --- Invalid input ---
+    try
+    {
+        CSRGraph bad(2, {0}, {5}, {1.0}, false);
+        assert(false);
+    }
+    catch (const std::out_of_range& ex)
+    {
+        cout << endl << "Caught expected exception: " << ex.what() << endl;
+    }
+
+    cout << endl << "=== End of CSRGraph Test Program ===" << endl;
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include "CSRGraph.hpp"
+#include <stdexcept>
+#include <utility>
+#include <limits>
+
+// ====================================
+// Constructors and Destructor
+// ====================================
+
+// Default constructor: an empty CSR.
+CSRGraph::CSRGraph()
+    : n(0), isDirected(false), offset(1, 0), target(), weight(),
+      inOffset(), source(), inWeight() {}
+
+// Build the CSR from an edge list with a counting sort on the tail index.
+// Arcs of one vertex are laid down in the order their edges appear in the input.
+CSRGraph::CSRGraph(int numNodes, const std::vector<int>& src, const std::vector<int>& dst,
+                   const std::vector<double>& w, bool directed)
+    : n(numNodes), isDirected(directed)
+{
+    if (numNodes < 0)
+        throw std::invalid_argument("Number of nodes must be non-negative.");
+    if (src.size() != dst.size() || src.size() != w.size())
+        throw std::invalid_argument("Edge arrays must have the same length.");
+
+    // Offsets are ints: every arc, two per undirected edge, must be addressable.
+    size_t m = src.size();
+    if (m > static_cast<size_t>(std::numeric_limits<int>::max()) / (directed ? 1 : 2))
+        throw std::length_error("Too many arcs for a CSRGraph.");
+    for (size_t i = 0; i < m; i++)
+        if (src[i] < 0 || src[i] >= n || dst[i] < 0 || dst[i] >= n)
+            throw std::out_of_range("Edge endpoint out of range.");
+
+    // Pass 1: count the out-arcs of every vertex.
+    offset.assign(n + 1, 0);
+    for (size_t i = 0; i < m; i++)
+    {
+        offset[src[i] + 1]++;
+        if (!directed)
+            offset[dst[i] + 1]++;
+    }
+    for (int u = 0; u < n; u++)
+        offset[u + 1] += offset[u];
+
+    // Pass 2: scatter the arcs. For an undirected edge {u, v}, u's list receives v
+    // and v's list receives u, exactly as the linked adjacency list does.
+    target.resize(offset[n]);
+    weight.resize(offset[n]);
+    std::vector<int> cursor(offset.begin(), offset.end() - 1);
+    for (size_t i = 0; i < m; i++)
+    {
+        int pos = cursor[src[i]]++;
+        target[pos] = dst[i];
+        weight[pos] = w[i];
+        if (!directed)
+        {
+            pos = cursor[dst[i]]++;
+            target[pos] = src[i];
+            weight[pos] = w[i];
+        }
+    }
+
+    if (!directed)
+        return;
+
+    // Directed graphs also get the transposed arrays (CSC), used whenever an
+    // algorithm needs to walk the in-arcs of a vertex.
+    inOffset.assign(n + 1, 0);
+    for (size_t i = 0; i < m; i++)
+        inOffset[dst[i] + 1]++;
+    for (int v = 0; v < n; v++)
+        inOffset[v + 1] += inOffset[v];
+
+    source.resize(m);
+    inWeight.resize(m);
+    cursor.assign(inOffset.begin(), inOffset.end() - 1);
+    for (size_t i = 0; i < m; i++)
+    {
+        int pos = cursor[dst[i]]++;
+        source[pos] = src[i];
+        inWeight[pos] = w[i];
+    }
+}
+
+// Adopt out-arc arrays built elsewhere (e.g. a relabeled copy); only the CSC is derived.
+CSRGraph::CSRGraph(std::vector<int> offsets, std::vector<int> targets, std::vector<double> weights, bool directed)
+    : n(static_cast<int>(offsets.size()) - 1), isDirected(directed), offset(std::move(offsets)),
+      target(std::move(targets)), weight(std::move(weights))
+{
+    if (n < 0 || offset[0] != 0)
+        throw std::invalid_argument("Offsets must start with 0.");
+    for (int u = 0; u < n; u++)
+        if (offset[u + 1] < offset[u])
+            throw std::invalid_argument("Offsets must be non-decreasing.");
+    if (static_cast<size_t>(offset[n]) != target.size() || target.size() != weight.size())
+        throw std::invalid_argument("Arc arrays must match the offsets.");
+    for (int v : target)
+        if (v < 0 || v >= n)
+            throw std::out_of_range("Arc head out of range.");
+
+    if (!directed)
+        return;
+
+    inOffset.assign(n + 1, 0);
+    for (int v : target)
+        inOffset[v + 1]++;
+    for (int v = 0; v < n; v++)
+        inOffset[v + 1] += inOffset[v];
+
+    source.resize(target.size());
+    inWeight.resize(target.size());
+    std::vector<int> cursor(inOffset.begin(), inOffset.end() - 1);
+    for (int u = 0; u < n; u++)
+        for (int i = offset[u]; i < offset[u + 1]; i++)
+        {
+            int pos = cursor[target[i]]++;
+            source[pos] = u;
+            inWeight[pos] = weight[i];
+        }
+}
+
+// Destructor: the vectors clean themselves up.
+CSRGraph::~CSRGraph() {}
+
+// ================================
+// Accessor Methods (Properties)
+// ================================
+
+int CSRGraph::NumberOfNodes() const
+{
+    return n;
+}
+
+int CSRGraph::NumberOfArcs() const
+{
+    return static_cast<int>(target.size());
+}
+
+bool CSRGraph::IsDirected() const
+{
+    return isDirected;
+}
+
+int CSRGraph::OutDegree(int u) const
+{
+    if (u < 0 || u >= n)
+        throw std::out_of_range("Invalid vertex index.");
+    return offset[u + 1] - offset[u];
+}
+
+int CSRGraph::InDegree(int v) const
+{
+    if (v < 0 || v >= n)
+        throw std::out_of_range("Invalid vertex index.");
+    const std::vector<int>& off = InOffsets();
+    return off[v + 1] - off[v];
+}
+
+// ================================
+// Raw Arrays
+// ================================
+
+const std::vector<int>& CSRGraph::Offsets() const
+{
+    return offset;
+}
+
+const std::vector<int>& CSRGraph::Targets() const
+{
+    return target;
+}
+
+const std::vector<double>& CSRGraph::Weights() const
+{
+    return weight;
+}
+
+// For undirected graphs the in-arcs are the out-arcs.
+const std::vector<int>& CSRGraph::InOffsets() const
+{
+    return isDirected ? inOffset : offset;
+}
+
+const std::vector<int>& CSRGraph::Sources() const
+{
+    return isDirected ? source : target;
+}
+
+const std::vector<double>& CSRGraph::InWeights() const
+{
+    return isDirected ? inWeight : weight;
+}
@@ -0,0 +1,110 @@
+#ifndef CSRGRAPH
+#define CSRGRAPH
+
+#include <vector>
+
+/**
+ * @brief Compressed sparse row (CSR) adjacency of a graph.
+ *
+ * Vertices are dense indices 0 .. n-1. The out-arcs of vertex u occupy the
+ * half-open range [Offsets()[u], Offsets()[u+1]) of Targets() and Weights(),
+ * so a whole neighborhood is one contiguous slice of memory.
+ *
+ * For directed graphs the transposed structure (CSC, i.e. the in-arcs of every
+ * vertex) is stored as well. For undirected graphs each edge {u, v, w} is stored
+ * as the two arcs u->v and v->u, and the in-arcs are simply the out-arcs.
+ *
+ * Arcs of one vertex keep the order in which their edges were supplied, so a
+ * traversal over a CSRGraph visits neighbors in the same order as the adjacency
+ * list it was built from.
+ */
+
+class CSRGraph
+{
+    private:
+        int n;                        // Number of vertices.
+        bool isDirected;              // If true, the in-arcs are stored separately.
+        std::vector<int> offset;      // Out-arc offsets, size n+1.
+        std::vector<int> target;      // Out-arc heads.
+        std::vector<double> weight;   // Out-arc weights.
+        std::vector<int> inOffset;    // In-arc offsets, size n+1 (directed graphs only).
+        std::vector<int> source;      // In-arc tails (directed graphs only).
+        std::vector<double> inWeight; // In-arc weights (directed graphs only).
+
+    public:
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        /**
+         * @brief Default constructor. Creates an empty CSR with no vertices.
+         */
+        CSRGraph();
+
+        /**
+         * @brief Build the CSR (and CSC for directed graphs) from an edge list.
+         *
+         * The three arrays describe edge i as {src[i], dst[i], w[i]}, where the
+         * endpoints are dense indices in [0, numNodes). Construction is a
+         * two-pass counting sort and runs in O(n + m).
+         *
+         * @param numNodes Number of vertices.
+         * @param src Tail index of every edge.
+         * @param dst Head index of every edge.
+         * @param w Weight of every edge.
+         * @param directed True if the edges are directed.
+         * @throws std::invalid_argument if numNodes is negative or the arrays differ in length.
+         * @throws std::out_of_range if an endpoint is not a vertex.
+         * @throws std::length_error if the arcs (2 per edge if undirected) exceed INT_MAX.
+         */
+        CSRGraph(int numNodes, const std::vector<int>& src, const std::vector<int>& dst,
+                 const std::vector<double>& w, bool directed);
+
+        /**
+         * @brief Adopt ready-made out-arc arrays.
+         *
+         * The arrays are taken as they are (for undirected graphs every edge must
+         * already appear as two arcs); only the in-arcs of a directed graph are
+         * computed, by a counting sort in O(n + m).
+         *
+         * @param offsets Out-arc offsets, size n+1, starting at 0 and non-decreasing.
+         * @param targets Out-arc heads, size offsets[n].
+         * @param weights Out-arc weights, same size as targets.
+         * @param directed True if the arcs are directed.
+         * @throws std::invalid_argument if the arrays do not fit together.
+         * @throws std::out_of_range if a head is not a vertex.
+         */
+        CSRGraph(std::vector<int> offsets, std::vector<int> targets, std::vector<double> weights, bool directed);
+
+        /**
+         * @brief Destructor.
+         */
+        ~CSRGraph();
+
+        // ==================================================
+        // Accessor Methods (Properties)
+        // ==================================================
+
+        int NumberOfNodes() const;      // Number of vertices.
+        int NumberOfArcs() const;       // Number of stored out-arcs (2m for undirected graphs).
+        bool IsDirected() const;        // True if in-arcs are stored separately.
+
+        int OutDegree(int u) const;     // Number of out-arcs of u.
+        int InDegree(int v) const;      // Number of in-arcs of v.
+
+        // ==================================================
+        // Raw Arrays
+        // ==================================================
+
+        // Out-arcs (CSR). Algorithms grab these once and index them directly.
+        const std::vector<int>& Offsets() const;
+        const std::vector<int>& Targets() const;
+        const std::vector<double>& Weights() const;
+
+        // In-arcs (CSC). For undirected graphs these alias the out-arcs.
+        const std::vector<int>& InOffsets() const;
+        const std::vector<int>& Sources() const;
+        const std::vector<double>& InWeights() const;
+};
+
+#endif
@@ -0,0 +1,196 @@
+// ContractionHierarchy-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread ContractionHierarchy.cpp ContractionHierarchy-test.cpp\
+    ../Graph/Graph.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../VertexQueue/VertexQueue.cpp\
+    ../Parallel/Parallel.cpp\
+    ../GraphLoader/GraphLoader.cpp\
+    ../DistanceMatrix/DistanceMatrix.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../GraphView/GraphView.cpp\
+    ../EdgeStore/EdgeStore.cpp\
+    ../GraphAnalytics/GraphAnalytics.cpp\
+    ../GraphOrdering/GraphOrdering.cpp\
+    ../GraphPartitioner/GraphPartitioner.cpp\
+    ../FlowNetwork/FlowNetwork.cpp\
+    ../../array/GeneralArray/GeneralArray.cpp\
+    ../../array/SparseMatrix/SparseMatrix.cpp\
+    ../../chain/Node/Node.cpp\
+    ../../chain/DoubleNode/DoubleNode.cpp\
+    ../../chain/ChainIterator/ChainIterator.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedSparseMatrix.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include "ContractionHierarchy.hpp"
+#include "../Parallel/Parallel.hpp"
+
+using namespace std;
+
+// Sum of the weights along a path, or -1 if some step is not an edge.
+static double pathLength(const map<pair<int, int>, double>& weight, const vector<int>& path)
+{
+    double length = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++)
+    {
+        auto it = weight.find({path[i], path[i + 1]});
+        if (it == weight.end())
+            return -1;
+        length += it->second;
+    }
+    return length;
+}
+
+// Random graph on n nodes with m edges and integer weights in [0, 20).
+static EdgeArray randomEdges(int n, int m)
+{
+    EdgeArray edges;
+    edges.numNodes = n;
+    for (int i = 0; i < m; i++)
+    {
+        edges.source.push_back(rand() % n);
+        edges.target.push_back(rand() % n);
+        edges.weight.push_back(rand() % 20);
+    }
+    return edges;
+}
+
+// Check every query from a few sources against Dijkstra on the graph itself.
+static void compare(const Graph& g, const ContractionHierarchy& ch, bool directed)
+{
+    const CSRGraph& csr = g.Compressed();
+    vector<int> nodes = g.Nodes();
+    map<pair<int, int>, double> weight;
+    for (int u = 0; u < csr.NumberOfNodes(); u++)
+        for (int i = csr.Offsets()[u]; i < csr.Offsets()[u + 1]; i++)
+        {
+            pair<int, int> key(nodes[u], nodes[csr.Targets()[i]]);
+            if (!weight.count(key) || csr.Weights()[i] < weight[key])
+                weight[key] = csr.Weights()[i];
+        }
+
+    for (int k = 0; k < 20; k++)
+    {
+        int s = nodes[rand() % nodes.size()];
+        ShortestPaths tree = g.Dijkstra(s);
+        for (size_t j = 0; j < nodes.size(); j++)
+        {
+            int t = nodes[j];
+            double expected = tree.distance[j];
+            assert(ch.Distance(s, t) == expected);
+            vector<int> path = ch.Query(s, t);
+            if (expected == numeric_limits<double>::infinity())
+            {
+                assert(path.empty());
+                continue;
+            }
+            assert(path.front() == s && path.back() == t);
+            assert(pathLength(weight, path) == expected);
+        }
+    }
+    cout << (directed ? "Directed" : "Undirected") << " graph of " << ch.NumberOfNodes() << " nodes: "
+         << ch.NumberOfShortcuts() << " shortcuts, all queries match Dijkstra." << endl;
+}
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // The textbook example: queries return the same paths as Dijkstra.
+    // ---------------------------------------------------------------
+    Graph g(10, true, false);
+    g.AddEdge(0, 1, 4);
+    g.AddEdge(0, 7, 8);
+    g.AddEdge(1, 2, 8);
+    g.AddEdge(1, 7, 11);
+    g.AddEdge(2, 3, 7);
+    g.AddEdge(2, 5, 4);
+    g.AddEdge(2, 8, 2);
+    g.AddEdge(3, 4, 9);
+    g.AddEdge(3, 5, 14);
+    g.AddEdge(5, 6, 2);
+    g.AddEdge(6, 7, 1);
+    g.AddEdge(6, 8, 6);
+    g.AddEdge(7, 8, 7);
+    g.AddEdge(7, 9, 2);
+    g.AddEdge(8, 9, 3);
+
+    ContractionHierarchy ch(g);
+    cout << "Ranks:";
+    for (int v : g.Nodes())
+        cout << " " << ch.Rank(v);
+    cout << endl;
+    cout << "Path from 0 to 4 (length " << ch.Distance(0, 4) << "):";
+    for (int v : ch.Query(0, 4))
+        cout << " " << v;
+    cout << endl;
+    cout << "Dijkstra path from 0 to 4:";
+    for (int v : g.Dijkstra(0, 4))
+        cout << " " << v;
+    cout << endl;
+    assert(ch.Query(3, 3) == vector<int>{3});
+
+    try
+    {
+        ch.Query(0, 42);
+    }
+    catch (const out_of_range& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    // ---------------------------------------------------------------
+    // Random graphs, contracted on several threads.
+    // ---------------------------------------------------------------
+    srand(3);
+    Parallel::SetThreadCount(4);
+    Graph sparse = Graph::FromEdges(randomEdges(1000, 1500));
+    compare(sparse, ContractionHierarchy(sparse), false);
+    Graph directed = Graph::FromEdges(randomEdges(600, 1800), true);
+    ContractionHierarchy directedCH(directed);
+    compare(directed, directedCH, true);
+    Parallel::SetThreadCount(0);
+
+    // ---------------------------------------------------------------
+    // Save and load.
+    // ---------------------------------------------------------------
+    directedCH.Save("contractionhierarchy-test.ch");
+    ContractionHierarchy loaded = ContractionHierarchy::Load("contractionhierarchy-test.ch");
+    assert(loaded.NumberOfNodes() == directedCH.NumberOfNodes() && loaded.IsDirected());
+    assert(loaded.NumberOfArcs() == directedCH.NumberOfArcs() && loaded.NumberOfShortcuts() == directedCH.NumberOfShortcuts());
+    compare(directed, loaded, true);
+
+    {
+        ofstream out("contractionhierarchy-test.ch", ios::binary);
+        out << "not a hierarchy";
+    }
+    try
+    {
+        ContractionHierarchy::Load("contractionhierarchy-test.ch");
+    }
+    catch (const runtime_error& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    remove("contractionhierarchy-test.ch");
+
+    // Negative weights are rejected.
+    Graph negative(3, true, true);
+    negative.AddEdge(0, 1, -1);
+    try
+    {
+        ContractionHierarchy bad(negative);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,724 @@
+#include "ContractionHierarchy.hpp"
+#include "../Parallel/Parallel.hpp"
+#include "../VertexQueue/VertexQueue.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+
+static const double INF = std::numeric_limits<double>::infinity();
+static const char HIERARCHY_MAGIC[8] = {'M', 'O', 'R', 'T', 'I', 'S', 'C', 'H'};
+static const std::uint32_t HIERARCHY_BYTE_ORDER = 0x01020304;
+
+// Fixed-size header at the start of a hierarchy file.
+struct HierarchyHeader
+{
+    char magic[8];              // "MORTISCH".
+    std::uint32_t version;
+    std::uint32_t byteOrder;    // 0x01020304 as written by the producing machine.
+    std::uint32_t directed;
+    std::uint32_t reserved;
+    std::uint64_t numNodes;
+    std::uint64_t numUp;        // Number of upward arcs.
+    std::uint64_t numDown;      // Number of downward arcs.
+};
+
+// =======================================================
+// Contraction
+// =======================================================
+
+namespace
+{
+    // An arc of the remaining graph; middle is the bypassed vertex of a shortcut, or -1.
+    struct Arc
+    {
+        int head;
+        double weight;
+        int middle;
+    };
+
+    struct Shortcut
+    {
+        int from;
+        int to;
+        double weight;
+        int middle;
+    };
+
+    // Out-arcs and in-arcs of the vertices not contracted yet.
+    struct Overlay
+    {
+        std::vector<std::vector<Arc>> out;
+        std::vector<std::vector<Arc>> in;
+
+        // Add from -> to, or lower the weight of an existing arc.
+        void add(int from, int to, double weight, int middle)
+        {
+            for (Arc& a : out[from])
+                if (a.head == to)
+                {
+                    if (weight < a.weight)
+                    {
+                        a.weight = weight;
+                        a.middle = middle;
+                        for (Arc& b : in[to])
+                            if (b.head == from)
+                            {
+                                b.weight = weight;
+                                b.middle = middle;
+                            }
+                    }
+                    return;
+                }
+            out[from].push_back({to, weight, middle});
+            in[to].push_back({from, weight, middle});
+        }
+
+        static void erase(std::vector<Arc>& arcs, int head)
+        {
+            for (size_t i = 0; i < arcs.size(); i++)
+                if (arcs[i].head == head)
+                {
+                    arcs[i] = arcs.back();
+                    arcs.pop_back();
+                    return;
+                }
+        }
+    };
+
+    // Scratch space of one thread's witness searches; reset after every search.
+    struct Witness
+    {
+        std::vector<double> dist;
+        std::vector<char> target;   // 1 for the heads whose distance is wanted.
+        std::vector<int> touched;
+        DaryHeap<2> pq;
+
+        explicit Witness(int n) : dist(n, INF), target(n, 0), touched(), pq(n)
+        {
+        }
+
+        /**
+         * Dijkstra from u over the remaining graph, skipping vertex v and every
+         * blocked vertex, until every target is settled, the queue minimum exceeds
+         * bound or limit vertices were settled. u itself never counts as a target.
+         * dist then holds upper bounds of the distances.
+         */
+        void run(const Overlay& g, int u, int v, const std::vector<char>& blocked, double bound, int targets, int limit)
+        {
+            dist[u] = 0.0;
+            touched.push_back(u);
+            pq.Push(u, 0.0);
+            for (int settled = 0; !pq.IsEmpty() && settled < limit && targets > 0; settled++)
+            {
+                std::pair<double, int> top = pq.Pop();
+                if (top.first > bound)
+                    break;
+                if (target[top.second] && top.second != u)
+                    targets--;
+                for (const Arc& a : g.out[top.second])
+                {
+                    if (a.head == v || blocked[a.head])
+                        continue;
+                    double nd = top.first + a.weight;
+                    if (nd < dist[a.head])
+                    {
+                        if (dist[a.head] == INF)
+                            touched.push_back(a.head);
+                        dist[a.head] = nd;
+                        pq.Push(a.head, nd);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Cheap variant for priority estimates: only paths of at most two arcs
+         * from u, skipping v and the blocked vertices, are considered.
+         */
+        void runTwoHops(const Overlay& g, int u, int v, const std::vector<char>& blocked)
+        {
+            for (const Arc& a : g.out[u])
+            {
+                if (a.head == v || blocked[a.head])
+                    continue;
+                relax(a.head, a.weight);
+                for (const Arc& b : g.out[a.head])
+                    if (target[b.head] && b.head != v)
+                        relax(b.head, a.weight + b.weight);
+            }
+        }
+
+        void relax(int x, double d)
+        {
+            if (d < dist[x])
+            {
+                if (dist[x] == INF)
+                    touched.push_back(x);
+                dist[x] = d;
+            }
+        }
+
+        void reset()
+        {
+            for (int x : touched)
+                dist[x] = INF;
+            touched.clear();
+            pq.Clear();
+        }
+    };
+
+    /**
+     * Shortcuts needed to contract v: one for every pair u -> v -> x (u != x)
+     * without a witness path that avoids v and the blocked vertices. Witness
+     * searches settle at most WITNESS_LIMIT vertices, or only look two arcs
+     * ahead if estimate is set. Appends the shortcuts to result if it is not
+     * null and returns how many there are.
+     */
+    int findShortcuts(const Overlay& g, int v, const std::vector<char>& blocked, Witness& ws, bool estimate,
+                      std::vector<Shortcut>* result)
+    {
+        int count = 0;
+        for (const Arc& a : g.out[v])
+            ws.target[a.head] = 1;
+        for (const Arc& in : g.in[v])
+        {
+            int u = in.head;
+            double bound = -1.0;
+            for (const Arc& out : g.out[v])
+                if (out.head != u)
+                    bound = std::max(bound, in.weight + out.weight);
+            if (bound < 0)
+                continue;   // v only leads back to u.
+
+            if (estimate)
+                ws.runTwoHops(g, u, v, blocked);
+            else
+                ws.run(g, u, v, blocked, bound, static_cast<int>(g.out[v].size()) - ws.target[u],
+                       ContractionHierarchy::WITNESS_LIMIT);
+            for (const Arc& out : g.out[v])
+            {
+                if (out.head == u)
+                    continue;
+                double through = in.weight + out.weight;
+                if (ws.dist[out.head] > through)
+                {
+                    count++;
+                    if (result != nullptr)
+                        result->push_back({u, out.head, through, v});
+                }
+            }
+            ws.reset();
+        }
+        for (const Arc& a : g.out[v])
+            ws.target[a.head] = 0;
+        return count;
+    }
+}
+
+// =======================================================
+// Constructors and Destructor
+// =======================================================
+
+ContractionHierarchy::ContractionHierarchy() : n(0), isDirected(false), shortcuts(0)
+{
+}
+
+ContractionHierarchy::ContractionHierarchy(const Graph& g) : n(g.NumberOfNodes()), isDirected(g.Compressed().IsDirected()), shortcuts(0),
+    nodes(g.Nodes()), rank(g.NumberOfNodes(), -1)
+{
+    for (int i = 0; i < n; i++)
+        nodeIndex[nodes[i]] = i;
+
+    // Remaining graph, starting with the original edges. A Graph has no parallel
+    // edges, and self-loops never lie on a shortest path.
+    const CSRGraph& csr = g.Compressed();
+    const std::vector<int>& offset = csr.Offsets();
+    const std::vector<int>& target = csr.Targets();
+    const std::vector<double>& weight = csr.Weights();
+    Overlay overlay;
+    overlay.out.resize(n);
+    overlay.in.resize(n);
+    for (int u = 0; u < n; u++)
+        for (int i = offset[u]; i < offset[u + 1]; i++)
+        {
+            if (weight[i] < 0)
+                throw std::invalid_argument("Contraction hierarchies require non-negative edge weights.");
+            if (target[i] == u)
+                continue;
+            overlay.out[u].push_back({target[i], weight[i], -1});
+            overlay.in[target[i]].push_back({u, weight[i], -1});
+        }
+
+    // Priority: edge difference plus contracted neighbors; ties are broken by a hash
+    // of the position so that equal priorities do not contract along a path in order.
+    std::vector<int> contractedNeighbors(n, 0);
+    std::vector<long long> priority(n, 0);
+    std::vector<char> blocked(n, 0);
+    auto key = [&](int v) { return std::make_pair(priority[v], static_cast<unsigned>(v) * 2654435761u); };
+
+    int workers = Parallel::ThreadCount();
+    std::vector<Witness> scratch;
+    scratch.reserve(workers);
+    for (int w = 0; w < workers; w++)
+        scratch.emplace_back(n);
+
+    auto updatePriorities = [&](const std::vector<int>& list)
+    {
+        Parallel::ForBlocks(0, list.size(), [&](size_t lo, size_t hi, int block)
+        {
+            for (size_t k = lo; k < hi; k++)
+            {
+                int v = list[k];
+                int added = findShortcuts(overlay, v, blocked, scratch[block], true, nullptr);
+                int removed = static_cast<int>(overlay.in[v].size() + overlay.out[v].size());
+                priority[v] = 2LL * added - removed + contractedNeighbors[v];
+            }
+        }, 64);
+    };
+
+    std::vector<int> alive(n);
+    for (int v = 0; v < n; v++)
+        alive[v] = v;
+    updatePriorities(alive);
+
+    std::vector<std::vector<Arc>> up(n), down(n);
+    std::vector<char> selected(n, 0), dirty(n, 0);
+    int nextRank = 0;
+    while (!alive.empty())
+    {
+        // Independent set: vertices whose key is smaller than that of every remaining
+        // vertex within two hops, so that no two of them share a neighbor.
+        Parallel::For(0, alive.size(), [&](size_t k)
+        {
+            int v = alive[k];
+            bool minimum = true;
+            for (const std::vector<Arc>* arcs : {&overlay.out[v], &overlay.in[v]})
+                for (const Arc& a : *arcs)
+                {
+                    if (!minimum || key(a.head) < key(v))
+                    {
+                        minimum = false;
+                        break;
+                    }
+                    for (const std::vector<Arc>* second : {&overlay.out[a.head], &overlay.in[a.head]})
+                        for (const Arc& b : *second)
+                            if (b.head != v && key(b.head) < key(v))
+                                minimum = false;
+                }
+            selected[v] = minimum;
+        }, 1024);
+
+        std::vector<int> batch, rest;
+        for (int v : alive)
+            (selected[v] ? batch : rest).push_back(v);
+        for (int v : batch)
+            blocked[v] = 1;
+
+        // Witness searches of the whole batch in parallel; they avoid every batch vertex.
+        std::vector<std::vector<Shortcut>> added(batch.size());
+        Parallel::ForBlocks(0, batch.size(), [&](size_t lo, size_t hi, int block)
+        {
+            for (size_t k = lo; k < hi; k++)
+                findShortcuts(overlay, batch[k], blocked, scratch[block], false, &added[k]);
+        }, 16);
+
+        // Contract: the remaining arcs of a batch vertex all lead to higher ranks.
+        std::vector<int> touched;
+        for (int v : batch)
+        {
+            rank[v] = nextRank++;
+            up[v].swap(overlay.out[v]);
+            down[v].swap(overlay.in[v]);
+            for (const Arc& a : up[v])
+                Overlay::erase(overlay.in[a.head], v);
+            for (const Arc& a : down[v])
+                Overlay::erase(overlay.out[a.head], v);
+            for (const std::vector<Arc>* arcs : {&up[v], &down[v]})
+                for (const Arc& a : *arcs)
+                {
+                    if (!dirty[a.head])
+                    {
+                        dirty[a.head] = 1;
+                        touched.push_back(a.head);
+                    }
+                }
+        }
+        for (int v : touched)
+            contractedNeighbors[v]++;
+        for (const std::vector<Shortcut>& list : added)
+            for (const Shortcut& s : list)
+                overlay.add(s.from, s.to, s.weight, s.middle);
+        for (int v : batch)
+            blocked[v] = 0;
+        for (int v : touched)
+            dirty[v] = 0;
+
+        alive.swap(rest);
+        updatePriorities(touched);
+    }
+
+    // Flatten both arc lists into CSR arrays.
+    auto flatten = [&](const std::vector<std::vector<Arc>>& lists, std::vector<int>& off, std::vector<int>& head,
+                       std::vector<int>& middle, std::vector<double>& w)
+    {
+        off.assign(n + 1, 0);
+        for (int v = 0; v < n; v++)
+            off[v + 1] = off[v] + static_cast<int>(lists[v].size());
+        head.resize(off[n]);
+        middle.resize(off[n]);
+        w.resize(off[n]);
+        for (int v = 0; v < n; v++)
+            for (size_t k = 0; k < lists[v].size(); k++)
+            {
+                head[off[v] + k] = lists[v][k].head;
+                middle[off[v] + k] = lists[v][k].middle;
+                w[off[v] + k] = lists[v][k].weight;
+                if (lists[v][k].middle != -1)
+                    shortcuts++;
+            }
+    };
+    flatten(up, upOffset, upHead, upMiddle, upWeight);
+    flatten(down, downOffset, downHead, downMiddle, downWeight);
+}
+
+ContractionHierarchy::~ContractionHierarchy()
+{
+    // The arrays free themselves.
+}
+
+// =======================================================
+// Accessor Methods (Properties)
+// =======================================================
+
+int ContractionHierarchy::indexOf(int node) const
+{
+    auto it = nodeIndex.find(node);
+    if (it == nodeIndex.end())
+        return -1;
+    return it->second;
+}
+
+int ContractionHierarchy::NumberOfNodes() const
+{
+    return n;
+}
+
+int ContractionHierarchy::NumberOfShortcuts() const
+{
+    return shortcuts;
+}
+
+int ContractionHierarchy::NumberOfArcs() const
+{
+    return static_cast<int>(upHead.size() + downHead.size());
+}
+
+bool ContractionHierarchy::IsDirected() const
+{
+    return isDirected;
+}
+
+int ContractionHierarchy::Rank(int node) const
+{
+    int v = indexOf(node);
+    if (v == -1)
+        throw std::out_of_range("Invalid node identifier.");
+    return rank[v];
+}
+
+// =======================================================
+// Queries
+// =======================================================
+
+namespace
+{
+    // Per-thread query state, sized for the largest hierarchy queried so far.
+    // Only the entries a query touched are reset, so a query costs O(search space).
+    struct QueryScratch
+    {
+        int capacity = 0;
+        std::vector<double> dist[2];
+        std::vector<int> parent[2];     // Previous vertex of each side's search tree.
+        std::vector<int> arc[2];        // Arc used to reach a vertex (index into up or down).
+        std::vector<int> touched;
+        DaryHeap<2> pq[2] = {DaryHeap<2>(0), DaryHeap<2>(0)};
+
+        void reserve(int n)
+        {
+            if (n <= capacity)
+                return;
+            capacity = n;
+            for (int side = 0; side < 2; side++)
+            {
+                dist[side].assign(n, INF);
+                parent[side].assign(n, -1);
+                arc[side].assign(n, -1);
+                pq[side] = DaryHeap<2>(n);
+            }
+        }
+    };
+
+    thread_local QueryScratch queryScratch;
+}
+
+double ContractionHierarchy::search(int s, int t, std::vector<int>* path) const
+{
+    if (s == t)
+    {
+        if (path != nullptr)
+            path->assign(1, s);
+        return 0.0;
+    }
+
+    QueryScratch& q = queryScratch;
+    q.reserve(n);
+    const std::vector<int>* offset[2] = {&upOffset, &downOffset};
+    const std::vector<int>* head[2] = {&upHead, &downHead};
+    const std::vector<double>* weight[2] = {&upWeight, &downWeight};
+    // Arcs into a vertex from higher ranks, for stall-on-demand.
+    const std::vector<int>* stallOffset[2] = {&downOffset, &upOffset};
+    const std::vector<int>* stallHead[2] = {&downHead, &upHead};
+    const std::vector<double>* stallWeight[2] = {&downWeight, &upWeight};
+
+    q.dist[0][s] = 0.0;
+    q.dist[1][t] = 0.0;
+    q.parent[0][s] = -1;
+    q.parent[1][t] = -1;
+    q.touched.push_back(s);
+    q.touched.push_back(t);
+    q.pq[0].Push(s, 0.0);
+    q.pq[1].Push(t, 0.0);
+
+    double best = INF;
+    int meet = -1;
+    while (true)
+    {
+        // Advance the side with the smaller minimum; a side is done once its minimum reaches best.
+        int side = -1;
+        for (int k = 0; k < 2; k++)
+            if (!q.pq[k].IsEmpty() && q.pq[k].Top().first < best && (side == -1 || q.pq[k].Top().first < q.pq[side].Top().first))
+                side = k;
+        if (side == -1)
+            break;
+
+        std::pair<double, int> top = q.pq[side].Pop();
+        int u = top.second;
+        std::vector<double>& d = q.dist[side];
+        const std::vector<double>& other = q.dist[1 - side];
+        if (top.first + other[u] < best)
+        {
+            best = top.first + other[u];
+            meet = u;
+        }
+
+        // Stall-on-demand: if a higher vertex already reaches u more cheaply, u's
+        // tentative distance is not a shortest one and its arcs need not be relaxed.
+        const std::vector<int>& soff = *stallOffset[side];
+        const std::vector<int>& shead = *stallHead[side];
+        const std::vector<double>& sw = *stallWeight[side];
+        bool stalled = false;
+        for (int i = soff[u]; i < soff[u + 1] && !stalled; i++)
+            stalled = d[shead[i]] + sw[i] < top.first;
+        if (stalled)
+            continue;
+
+        const std::vector<int>& off = *offset[side];
+        const std::vector<int>& hd = *head[side];
+        const std::vector<double>& w = *weight[side];
+        for (int i = off[u]; i < off[u + 1]; i++)
+        {
+            int v = hd[i];
+            double nd = top.first + w[i];
+            if (nd < d[v])
+            {
+                if (d[v] == INF && other[v] == INF)
+                    q.touched.push_back(v);
+                d[v] = nd;
+                q.parent[side][v] = u;
+                q.arc[side][v] = i;
+                q.pq[side].Push(v, nd);
+            }
+        }
+    }
+
+    if (path != nullptr)
+    {
+        path->clear();
+        if (meet != -1)
+        {
+            // Up from s to meet, then down from meet to t, unpacking every shortcut.
+            std::vector<int> chain;
+            for (int v = meet; v != -1; v = q.parent[0][v])
+                chain.push_back(v);
+            std::reverse(chain.begin(), chain.end());
+            path->push_back(s);
+            for (size_t k = 1; k < chain.size(); k++)
+                unpack(chain[k - 1], chain[k], upMiddle[q.arc[0][chain[k]]], *path);
+            for (int v = meet; v != t; v = q.parent[1][v])
+                unpack(v, q.parent[1][v], downMiddle[q.arc[1][v]], *path);
+        }
+    }
+
+    for (int v : q.touched)
+        q.dist[0][v] = q.dist[1][v] = INF;
+    q.touched.clear();
+    q.pq[0].Clear();
+    q.pq[1].Clear();
+    return best;
+}
+
+void ContractionHierarchy::unpack(int a, int b, int middle, std::vector<int>& path) const
+{
+    // Each entry is an arc {from, to, middle}; the first half of a shortcut is on top.
+    std::vector<std::pair<std::pair<int, int>, int>> stack;
+    stack.push_back({{a, b}, middle});
+    while (!stack.empty())
+    {
+        int from = stack.back().first.first;
+        int to = stack.back().first.second;
+        int mid = stack.back().second;
+        stack.pop_back();
+        if (mid == -1)
+        {
+            path.push_back(to);
+            continue;
+        }
+        // from -> mid is stored at mid among the downward arcs, mid -> to among the upward ones.
+        int first = -1, second = -1;
+        for (int i = downOffset[mid]; i < downOffset[mid + 1] && first == -1; i++)
+            if (downHead[i] == from)
+                first = downMiddle[i];
+        for (int i = upOffset[mid]; i < upOffset[mid + 1] && second == -1; i++)
+            if (upHead[i] == to)
+                second = upMiddle[i];
+        stack.push_back({{mid, to}, second});
+        stack.push_back({{from, mid}, first});
+    }
+}
+
+std::vector<int> ContractionHierarchy::Query(int source, int destination) const
+{
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+
+    std::vector<int> path;
+    search(s, t, &path);
+    for (int& v : path)
+        v = nodes[v];
+    return path;
+}
+
+double ContractionHierarchy::Distance(int source, int destination) const
+{
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+    return search(s, t, nullptr);
+}
+
+// =======================================================
+// Serialization
+// =======================================================
+
+void ContractionHierarchy::Save(const std::string& path) const
+{
+    HierarchyHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, HIERARCHY_MAGIC, sizeof(HIERARCHY_MAGIC));
+    header.version = VERSION;
+    header.byteOrder = HIERARCHY_BYTE_ORDER;
+    header.directed = isDirected ? 1 : 0;
+    header.numNodes = n;
+    header.numUp = upHead.size();
+    header.numDown = downHead.size();
+
+    // Write a temporary file and rename it over path, so readers never see a partial file.
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("Cannot open file for writing: " + temporary);
+        auto put = [&](const void* bytes, size_t length)
+        {
+            out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(length));
+        };
+        put(&header, sizeof(header));
+        put(nodes.data(), 4 * nodes.size());
+        put(rank.data(), 4 * rank.size());
+        put(upOffset.data(), 4 * upOffset.size());
+        put(upHead.data(), 4 * upHead.size());
+        put(upMiddle.data(), 4 * upMiddle.size());
+        put(upWeight.data(), 8 * upWeight.size());
+        put(downOffset.data(), 4 * downOffset.size());
+        put(downHead.data(), 4 * downHead.size());
+        put(downMiddle.data(), 4 * downMiddle.size());
+        put(downWeight.data(), 8 * downWeight.size());
+        if (!out.flush())
+        {
+            out.close();
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Cannot write file: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Cannot replace file: " + path);
+    }
+}
+
+ContractionHierarchy ContractionHierarchy::Load(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        throw std::runtime_error("Cannot open file: " + path);
+
+    HierarchyHeader header;
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, HIERARCHY_MAGIC, sizeof(HIERARCHY_MAGIC)) != 0)
+        throw std::runtime_error("Not a contraction hierarchy: " + path);
+    if (header.byteOrder != HIERARCHY_BYTE_ORDER)
+        throw std::runtime_error("Contraction hierarchy has a different byte order: " + path);
+    if (header.version != VERSION)
+        throw std::runtime_error("Unsupported contraction hierarchy version " + std::to_string(header.version) + ": " + path);
+    if (header.numNodes > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+        header.numUp > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) ||
+        header.numDown > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Corrupt or truncated contraction hierarchy: " + path);
+
+    ContractionHierarchy ch;
+    ch.n = static_cast<int>(header.numNodes);
+    ch.isDirected = header.directed != 0;
+    auto get = [&](auto& data, std::uint64_t count)
+    {
+        data.resize(count);
+        if (!in.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(count * sizeof(data[0]))))
+            throw std::runtime_error("Corrupt or truncated contraction hierarchy: " + path);
+    };
+    get(ch.nodes, header.numNodes);
+    get(ch.rank, header.numNodes);
+    get(ch.upOffset, header.numNodes + 1);
+    get(ch.upHead, header.numUp);
+    get(ch.upMiddle, header.numUp);
+    get(ch.upWeight, header.numUp);
+    get(ch.downOffset, header.numNodes + 1);
+    get(ch.downHead, header.numDown);
+    get(ch.downMiddle, header.numDown);
+    get(ch.downWeight, header.numDown);
+    if (ch.upOffset[ch.n] != static_cast<int>(header.numUp) || ch.downOffset[ch.n] != static_cast<int>(header.numDown))
+        throw std::runtime_error("Corrupt or truncated contraction hierarchy: " + path);
+
+    for (int i = 0; i < ch.n; i++)
+        ch.nodeIndex[ch.nodes[i]] = i;
+    for (int middle : ch.upMiddle)
+        ch.shortcuts += middle != -1;
+    for (int middle : ch.downMiddle)
+        ch.shortcuts += middle != -1;
+    return ch;
+}
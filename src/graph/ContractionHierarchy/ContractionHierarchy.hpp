@@ -0,0 +1,143 @@
+#ifndef CONTRACTIONHIERARCHY
+#define CONTRACTIONHIERARCHY
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <unordered_map>
+
+#include "../Graph/Graph.hpp"
+
+/**
+ * @brief Contraction hierarchy for fast repeated point-to-point shortest paths.
+ *
+ * Preprocessing contracts the vertices one after another in order of importance:
+ * a contracted vertex v is removed from the remaining graph, and for every pair
+ * of arcs u -> v -> x a shortcut u -> x is added unless a witness search finds a
+ * path from u to x of at most the same length that avoids v. The rank of a
+ * vertex is its position in that order. Afterwards every shortest path can be
+ * written as a sequence of arcs that first only go up in rank and then only go
+ * down, so a query is a bidirectional Dijkstra in which both searches only
+ * follow arcs towards higher ranks and settle a few hundred vertices even on
+ * large road-like graphs.
+ *
+ * The order is chosen greedily by edge difference (shortcuts added minus arcs
+ * removed) plus the number of already contracted neighbors. In every round the
+ * vertices whose priority is smaller than that of all vertices within two hops
+ * form an independent set; their witness searches, which avoid the whole set,
+ * and the new priorities of their neighbors are computed on all threads (see
+ * Parallel), and the set is contracted at once.
+ *
+ * Every shortcut remembers the vertex it bypasses, so Query() unpacks the
+ * search result into the path of original edges, with the same shape that
+ * Graph::Dijkstra(source, destination) returns.
+ *
+ * The hierarchy is a snapshot of the graph: later changes to the graph are
+ * not reflected. Queries only read the hierarchy and may run concurrently.
+ */
+
+class ContractionHierarchy
+{
+    private:
+        int n;                                      // Number of vertices.
+        bool isDirected;
+        int shortcuts;                              // Number of shortcut arcs added.
+        std::vector<int> nodes;                     // Node identifier per position.
+        std::unordered_map<int, int> nodeIndex;     // Node identifier -> position.
+        std::vector<int> rank;                      // Contraction order per position.
+
+        // Arcs towards higher ranks in CSR form. up holds u -> v at u; down holds
+        // v -> u at u, i.e. the arcs the backward search follows. middle is the
+        // vertex a shortcut bypasses, -1 for original edges.
+        std::vector<int> upOffset, upHead, upMiddle;
+        std::vector<double> upWeight;
+        std::vector<int> downOffset, downHead, downMiddle;
+        std::vector<double> downWeight;
+
+        ContractionHierarchy();
+
+        // Position of a node identifier, or -1.
+        int indexOf(int node) const;
+
+        // Bidirectional upward search between positions. Returns the distance and,
+        // if path is not null, stores the positions along an unpacked shortest path.
+        double search(int s, int t, std::vector<int>* path) const;
+
+        // Append the original vertices of the arc a -> b with the given middle, without a.
+        void unpack(int a, int b, int middle, std::vector<int>& path) const;
+
+    public:
+        static const std::uint32_t VERSION = 1;     // File format version written by Save().
+        static const int WITNESS_LIMIT = 500;       // Vertices a witness search settles at most.
+
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        /**
+         * @brief Build the hierarchy of a graph.
+         *
+         * @param g The graph; directed or undirected, weighted or not.
+         * @throws std::invalid_argument if an edge weight is negative.
+         */
+        explicit ContractionHierarchy(const Graph& g);
+
+        ~ContractionHierarchy();
+
+        // ==================================================
+        // Accessor Methods (Properties)
+        // ==================================================
+
+        int NumberOfNodes() const;
+        int NumberOfShortcuts() const;              // Shortcut arcs added by the contraction.
+        int NumberOfArcs() const;                   // Upward plus downward arcs, shortcuts included.
+        bool IsDirected() const;
+        int Rank(int node) const;                   // Contraction rank of a node; throws std::out_of_range.
+
+        // ==================================================
+        // Queries
+        // ==================================================
+
+        /**
+         * @brief Shortest path between two nodes.
+         *
+         * @param source The source node identifier.
+         * @param destination The destination node identifier.
+         * @return The node IDs along a shortest path, from source to destination (empty if unreachable).
+         * @throws std::out_of_range if a node does not exist.
+         */
+        std::vector<int> Query(int source, int destination) const;
+
+        /**
+         * @brief Shortest-path distance between two nodes, without unpacking the path.
+         *
+         * @return The distance, infinity if destination is unreachable.
+         * @throws std::out_of_range if a node does not exist.
+         */
+        double Distance(int source, int destination) const;
+
+        // ==================================================
+        // Serialization
+        // ==================================================
+
+        /**
+         * @brief Write the hierarchy to a binary file.
+         *
+         * The file starts with the magic "MORTISCH", the format version and a byte
+         * order mark, followed by the node table, the ranks and both arc arrays.
+         * It is written next to path and renamed over it when complete.
+         *
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void Save(const std::string& path) const;
+
+        /**
+         * @brief Read a hierarchy written by Save().
+         *
+         * @throws std::runtime_error if the file cannot be read, is not a hierarchy,
+         *         has another version or byte order, or is truncated.
+         */
+        static ContractionHierarchy Load(const std::string& path);
+};
+
+#endif
@@ -0,0 +1,90 @@
+// DistanceMatrix-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread DistanceMatrix.cpp DistanceMatrix-test.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../Parallel/Parallel.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdlib>
+#include "DistanceMatrix.hpp"
+
+using namespace std;
+
+int main()
+{
+    // A small directed graph with one negative (but no negative cycle) edge.
+    //   0 -> 1 (4), 0 -> 2 (1), 2 -> 1 (-2), 1 -> 3 (1), 3 -> 4 (7)
+    vector<int> nodes = {10, 11, 12, 13, 14};
+    CSRGraph g(5, {0, 0, 2, 1, 3}, {1, 2, 1, 3, 4}, {4, 1, -2, 1, 7}, true);
+
+    DistanceMatrix<double> d(g, nodes);
+    DistanceMatrix<float> f(g, nodes);
+    DistanceMatrix<int> i(g, nodes);
+
+    cout << "Distance matrix (double):" << endl;
+    for (int u : nodes)
+    {
+        for (int v : nodes)
+        {
+            if (d.Reachable(u, v))
+                cout << d.Distance(u, v) << "\t";
+            else
+                cout << "inf\t";
+        }
+        cout << endl;
+    }
+
+    cout << "Path 10 -> 14:";
+    for (int node : d.Path(10, 14))
+        cout << " " << node;
+    cout << endl;
+    cout << "Predecessor of 11 on 10 -> 11: " << d.Predecessor(10, 11) << endl;
+    assert(f.Distance(10, 14) == 7.0f && i.Distance(10, 14) == 7);
+    assert(i.Path(10, 14) == d.Path(10, 14));
+    assert(!i.Reachable(14, 10) && i.Distance(14, 10) == DistanceMatrix<int>::Infinity());
+
+    // Negative cycle.
+    CSRGraph cycle(3, {0, 1, 2}, {1, 2, 0}, {1, 1, -3}, true);
+    try
+    {
+        DistanceMatrix<double> bad(cycle, {0, 1, 2});
+    }
+    catch (const runtime_error& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    // A larger random graph spanning several tiles: check the triangle inequality
+    // and that every reconstructed path has the reported length.
+    const int n = 150;
+    vector<int> src, dst, ids(n);
+    vector<double> w;
+    srand(42);
+    for (int k = 0; k < n; k++)
+        ids[k] = k;
+    for (int k = 0; k < 6 * n; k++)
+    {
+        src.push_back(rand() % n);
+        dst.push_back(rand() % n);
+        w.push_back(1 + rand() % 20);
+    }
+    CSRGraph big(n, src, dst, w, true);
+    DistanceMatrix<int> all(big, ids);
+    for (int u = 0; u < n; u++)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            if (!all.Reachable(u, v))
+                continue;
+            vector<int> path = all.Path(u, v);
+            int length = 0;
+            for (size_t k = 1; k < path.size(); k++)
+                length += all.Distance(path[k - 1], path[k]);
+            assert(length == all.Distance(u, v));
+        }
+    }
+    cout << "Random graph with " << n << " nodes: paths consistent" << endl;
+    return 0;
+}
@@ -0,0 +1,229 @@
+#include "DistanceMatrix.hpp"
+#include "../Parallel/Parallel.hpp"
+#include <stdexcept>
+#include <limits>
+#include <cmath>
+#include <type_traits>
+#include <algorithm>
+
+// ====================================
+// Constructors and Destructor
+// ====================================
+
+template <class T>
+DistanceMatrix<T>::DistanceMatrix() : n(0), stride(0), nodes(), index(), dist(), pred() {}
+
+template <class T>
+DistanceMatrix<T>::DistanceMatrix(const CSRGraph& g, const std::vector<int>& nodeIds)
+    : n(g.NumberOfNodes()), stride(0), nodes(nodeIds), index(), dist(), pred()
+{
+    if (static_cast<int>(nodeIds.size()) != n)
+        throw std::invalid_argument("One node identifier per vertex is required.");
+    index.reserve(n);
+    for (int i = 0; i < n; i++)
+        index[nodes[i]] = i;
+
+    stride = (n + TILE - 1) / TILE * TILE;
+    const T INF = Infinity();
+    dist.assign(static_cast<size_t>(stride) * stride, INF);
+    pred.assign(static_cast<size_t>(stride) * stride, -1);
+
+    // Diagonal 0, then the lightest arc of every pair.
+    for (int i = 0; i < stride; i++)
+        dist[static_cast<size_t>(i) * stride + i] = 0;
+
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+    for (int u = 0; u < n; u++)
+    {
+        for (int a = offset[u]; a < offset[u + 1]; a++)
+        {
+            double w = weight[a];
+            if (std::is_integral<T>::value && w != std::floor(w))
+                throw std::invalid_argument("Integer distance matrices require integer edge weights.");
+            int v = target[a];
+            if (u == v)
+            {
+                if (w < 0)
+                    throw std::runtime_error("Graph contains a negative weight cycle");
+                continue;
+            }
+            T tw = static_cast<T>(w);
+            size_t at = static_cast<size_t>(u) * stride + v;
+            if (tw < dist[at])
+            {
+                dist[at] = tw;
+                pred[at] = u;
+            }
+        }
+    }
+
+    run();
+
+    for (int i = 0; i < n; i++)
+        if (dist[static_cast<size_t>(i) * stride + i] < 0)
+            throw std::runtime_error("Graph contains a negative weight cycle");
+}
+
+template <class T>
+DistanceMatrix<T>::~DistanceMatrix() {}
+
+// ====================================
+// Blocked Floyd–Warshall
+// ====================================
+
+// Min-plus update of one row segment through intermediate vertex k:
+// di[j] = min(di[j], dik + dk[j]), carrying the predecessor along. All loads
+// happen up front and both results are selected, so the loop has no branches
+// and vectorizes. An infinite dk[j] never counts as a path (this matters for
+// negative weights, and for int where INF + w is just a large number).
+template <class T>
+static inline void minPlusRow(T* di, int* pi, const T* dk, const int* pk, T dik, T INF, int len)
+{
+    for (int j = 0; j < len; j++)
+    {
+        T cur = di[j], dkj = dk[j];
+        int pc = pi[j], pn = pk[j];
+        T nd = dik + dkj;
+        bool better = (nd < cur) && (dkj != INF);
+        di[j] = better ? nd : cur;
+        pi[j] = better ? pn : pc;
+    }
+}
+
+// C(ci, cj) = min(C(ci, cj), C(ci, k) + C(k, cj)) for every k in tile k0, in order.
+// Row k itself is skipped: with dist[k][k] = 0 it cannot change.
+template <class T>
+void DistanceMatrix<T>::relaxTile(int ci, int cj, int k0)
+{
+    const T INF = Infinity();
+    const size_t s = stride;
+    const int i0 = ci * TILE, j0 = cj * TILE, kb = k0 * TILE;
+
+    for (int k = kb; k < kb + TILE; k++)
+    {
+        const T* dk = &dist[k * s + j0];
+        const int* pk = &pred[k * s + j0];
+        for (int i = i0; i < i0 + TILE; i++)
+        {
+            T dik = dist[i * s + k];
+            if (i == k || dik == INF)
+                continue;
+            minPlusRow(&dist[i * s + j0], &pred[i * s + j0], dk, pk, dik, INF, TILE);
+        }
+    }
+}
+
+template <class T>
+void DistanceMatrix<T>::run()
+{
+    const int tiles = stride / TILE;
+    for (int k = 0; k < tiles; k++)
+    {
+        // Phase 1: the diagonal tile depends only on itself.
+        relaxTile(k, k, k);
+
+        // Phase 2: the tiles in row k and column k depend on the diagonal tile only.
+        Parallel::For(0, 2 * static_cast<size_t>(tiles), [&](size_t t)
+        {
+            int other = static_cast<int>(t / 2);
+            if (other == k)
+                return;
+            if (t % 2 == 0)
+                relaxTile(k, other, k);
+            else
+                relaxTile(other, k, k);
+        }, 2);
+
+        // Phase 3: every other tile depends on its row-k and column-k tiles.
+        Parallel::For(0, static_cast<size_t>(tiles) * tiles, [&](size_t t)
+        {
+            int i = static_cast<int>(t / tiles), j = static_cast<int>(t % tiles);
+            if (i != k && j != k)
+                relaxTile(i, j, k);
+        }, 4);
+    }
+}
+
+// ================================
+// Accessor Methods
+// ================================
+
+template <class T>
+T DistanceMatrix<T>::Infinity()
+{
+    if (std::numeric_limits<T>::has_infinity)
+        return std::numeric_limits<T>::infinity();
+    return std::numeric_limits<T>::max() / 2;     // INF + INF still fits.
+}
+
+template <class T>
+int DistanceMatrix<T>::positionOf(int node) const
+{
+    auto it = index.find(node);
+    if (it == index.end())
+        throw std::out_of_range("Invalid node identifier.");
+    return it->second;
+}
+
+template <class T>
+int DistanceMatrix<T>::Size() const
+{
+    return n;
+}
+
+template <class T>
+T DistanceMatrix<T>::Distance(int u, int v) const
+{
+    return dist[static_cast<size_t>(positionOf(u)) * stride + positionOf(v)];
+}
+
+template <class T>
+bool DistanceMatrix<T>::Reachable(int u, int v) const
+{
+    return Distance(u, v) != Infinity();
+}
+
+template <class T>
+int DistanceMatrix<T>::Predecessor(int u, int v) const
+{
+    int p = pred[static_cast<size_t>(positionOf(u)) * stride + positionOf(v)];
+    return p == -1 ? -1 : nodes[p];
+}
+
+template <class T>
+std::vector<int> DistanceMatrix<T>::Path(int u, int v) const
+{
+    int i = positionOf(u), j = positionOf(v);
+    const size_t row = static_cast<size_t>(i) * stride;
+    if (dist[row + j] == Infinity())
+        return std::vector<int>();  // No path found.
+
+    std::vector<int> path;
+    for (int cur = j; cur != i; cur = pred[row + cur])
+        path.push_back(nodes[cur]);
+    path.push_back(nodes[i]);
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+template <class T>
+const T* DistanceMatrix<T>::Row(int i) const
+{
+    if (i < 0 || i >= n)
+        throw std::out_of_range("Invalid vertex index.");
+    return &dist[static_cast<size_t>(i) * stride];
+}
+
+template <class T>
+const int* DistanceMatrix<T>::PredecessorRow(int i) const
+{
+    if (i < 0 || i >= n)
+        throw std::out_of_range("Invalid vertex index.");
+    return &pred[static_cast<size_t>(i) * stride];
+}
+
+template class DistanceMatrix<double>;
+template class DistanceMatrix<float>;
+template class DistanceMatrix<int>;
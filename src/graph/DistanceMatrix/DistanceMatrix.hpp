@@ -0,0 +1,79 @@
+#ifndef DISTANCEMATRIX
+#define DISTANCEMATRIX
+
+#include <vector>
+#include <unordered_map>
+#include "../CSRGraph/CSRGraph.hpp"
+
+/**
+ * @brief All-pairs shortest path distances and predecessors (Floyd–Warshall).
+ *
+ * Distances and predecessors are stored in two contiguous row-major matrices
+ * whose rows are padded to a multiple of TILE. The matrices are filled by a
+ * blocked Floyd–Warshall: for every diagonal tile the tile itself is closed
+ * first, then its row and column of tiles, then all remaining tiles, and the
+ * tiles of the last two steps are processed in parallel. The tile kernel is a
+ * branch-free min-plus loop over contiguous rows that the compiler vectorizes.
+ *
+ * Paths are not stored; Path() walks the predecessor matrix on demand.
+ *
+ * T is the distance type: double, float (half the memory, more per vector) or
+ * int (integer weights only; distances must stay below Infinity()).
+ */
+
+template <class T>
+class DistanceMatrix
+{
+    private:
+        int n;                                  // Number of vertices.
+        int stride;                             // Row length in the matrices (n rounded up to TILE).
+        std::vector<int> nodes;                 // Node identifier of every position.
+        std::unordered_map<int, int> index;     // Node identifier -> position.
+        std::vector<T> dist;                    // dist[i * stride + j]: distance from i to j.
+        std::vector<int> pred;                  // pred[i * stride + j]: predecessor of j on a shortest i -> j path, -1 if none.
+
+        int positionOf(int node) const;
+        void relaxTile(int ci, int cj, int k0);  // Relax tile (ci, cj) through the intermediate vertices of tile k0.
+        void run();
+
+    public:
+        static const int TILE = 64;
+
+        /**
+         * @brief Default constructor. An empty matrix.
+         */
+        DistanceMatrix();
+
+        /**
+         * @brief Compute all-pairs shortest paths of a compressed graph.
+         *
+         * @param g The adjacency; parallel arcs keep the smallest weight.
+         * @param nodeIds Node identifier of every vertex of g.
+         * @throws std::invalid_argument if T is int and a weight is not an integer.
+         * @throws std::runtime_error if the graph contains a negative weight cycle.
+         */
+        DistanceMatrix(const CSRGraph& g, const std::vector<int>& nodeIds);
+
+        ~DistanceMatrix();
+
+        static T Infinity();                    // Distance of unreachable pairs.
+
+        int Size() const;                       // Number of vertices.
+        T Distance(int u, int v) const;         // Shortest distance between node IDs (Infinity() if unreachable).
+        bool Reachable(int u, int v) const;     // True if v can be reached from u.
+        int Predecessor(int u, int v) const;    // Node ID before v on a shortest u -> v path, -1 if none.
+
+        /**
+         * @brief Reconstruct a shortest path from the predecessor matrix.
+         *
+         * @param u The source node identifier.
+         * @param v The destination node identifier.
+         * @return Node IDs from u to v ({u} if u == v, empty if unreachable). O(path length).
+         */
+        std::vector<int> Path(int u, int v) const;
+
+        const T* Row(int i) const;              // Distances from position i, Size() contiguous entries.
+        const int* PredecessorRow(int i) const; // Predecessor positions for paths from position i.
+};
+
+#endif
@@ -0,0 +1,90 @@
+// EdgeLog-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 EdgeLog.cpp EdgeLog-test.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+#include "EdgeLog.hpp"
+
+using namespace std;
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // A weighted log: push, read back, drop from the front, compact.
+    // ---------------------------------------------------------------
+    EdgeLog log(true);
+    log.Push(0, 1, 2.5, 1.0);
+    log.Push(1, 2, 1.0, 2.0);
+    log.Push(2, 0, 4.0, 2.0);
+    log.Push(2, 3, 0.5, 5.0);
+    cout << "Edges:";
+    for (int i = 0; i < log.Length(); i++)
+        cout << " {" << log.Source(i) << ", " << log.Target(i) << ", " << log.Weight(i) << "} @" << log.Time(i);
+    cout << endl;
+
+    log.PopFront(1);
+    assert(log.Length() == 3 && log.Source(0) == 1 && log.Time(0) == 2.0);
+    vector<int> newIndex = log.Compact({0, 1, 0});
+    assert(log.Length() == 2 && newIndex[0] == 0 && newIndex[1] == -1 && newIndex[2] == 1);
+    assert(log.Source(1) == 2 && log.Target(1) == 3 && log.Weight(1) == 0.5 && log.Time(1) == 5.0);
+    try
+    {
+        log.Compact({0});
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    // An unweighted log keeps no weights and reports 1.
+    EdgeLog plain;
+    plain.Push(5, 6, 9.0, 0.0);
+    assert(plain.Weight(0) == 1.0);
+
+    EdgeLog copy = log;
+    assert(copy == log);
+    copy.Push(3, 3, 1, 6.0);
+    assert(copy != log && copy.Length() == 3);
+
+    // ---------------------------------------------------------------
+    // Across chunks: a sliding window of 3 chunks over 20 chunks of
+    // edges keeps its memory and its contents.
+    // ---------------------------------------------------------------
+    const int chunk = EdgeLog::CHUNK_SIZE;
+    const int window = 3 * chunk;
+    EdgeLog stream;
+    size_t steady = 0;
+    for (int i = 0; i < 20 * chunk; i++)
+    {
+        stream.Push(i, i + 1, 1, i);
+        if (stream.Length() > window)
+            stream.PopFront(stream.Length() - window);
+        if (i == 5 * chunk)
+            steady = stream.Bytes();
+    }
+    assert(stream.Length() == window && stream.Source(0) == 17 * chunk && stream.Time(window - 1) == 20 * chunk - 1);
+    for (int i = 0; i < window; i++)
+        assert(stream.Target(i) == stream.Source(i) + 1);
+    cout << "Window of " << window << " edges: " << stream.Bytes() << " bytes (after 5 chunks: " << steady << ")" << endl;
+    assert(stream.Bytes() <= steady);
+
+    // Dropping in odd steps and past the end.
+    stream.PopFront(chunk + 7);
+    assert(stream.Source(0) == 18 * chunk + 7);
+    stream.PopFront(4 * chunk);
+    assert(stream.Length() == 0);
+    stream.Push(1, 2, 1, 0);
+    assert(stream.Length() == 1 && stream.Source(0) == 1);
+
+    // A copy of a partly filled chunk keeps appending in place.
+    EdgeLog partial = stream;
+    for (int i = 0; i < 2 * chunk; i++)
+        partial.Push(i, i, 1, i);
+    assert(partial.Length() == 2 * chunk + 1 && partial.Source(chunk) == chunk - 1);
+    partial.Clear();
+    assert(partial.Length() == 0 && partial.Bytes() == 0);
+    return 0;
+}
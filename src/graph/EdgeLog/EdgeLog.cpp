@@ -0,0 +1,182 @@
+#include "EdgeLog.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+
+// =======================================================
+// Constructors and Destructor
+// =======================================================
+
+EdgeLog::EdgeLog(bool weighted) : chunks(), spare(), first(0), length(0), isWeighted(weighted)
+{
+}
+
+EdgeLog::~EdgeLog()
+{
+    // The chunks free themselves.
+}
+
+// Append an empty chunk, reusing the spare one if there is one.
+void EdgeLog::grow()
+{
+    chunks.push_back(std::move(spare));
+    spare = Chunk();
+    Chunk& chunk = chunks.back();
+    chunk.source.reserve(CHUNK_SIZE);
+    chunk.target.reserve(CHUNK_SIZE);
+    if (isWeighted)
+        chunk.weight.reserve(CHUNK_SIZE);
+    chunk.time.reserve(CHUNK_SIZE);
+}
+
+// =======================================================
+// Modification Methods
+// =======================================================
+
+void EdgeLog::Push(int u, int v, double w, double t)
+{
+    // A copied log has chunks without spare capacity; they get theirs back here.
+    if (chunks.empty() || chunks.back().source.size() == chunks.back().source.capacity())
+    {
+        if (chunks.empty() || chunks.back().source.size() == CHUNK_SIZE)
+            grow();
+        else
+        {
+            Chunk& chunk = chunks.back();
+            chunk.source.reserve(CHUNK_SIZE);
+            chunk.target.reserve(CHUNK_SIZE);
+            if (isWeighted)
+                chunk.weight.reserve(CHUNK_SIZE);
+            chunk.time.reserve(CHUNK_SIZE);
+        }
+    }
+    Chunk& chunk = chunks.back();
+    chunk.source.push_back(u);
+    chunk.target.push_back(v);
+    if (isWeighted)
+        chunk.weight.push_back(w);
+    chunk.time.push_back(t);
+    length++;
+}
+
+void EdgeLog::PopFront(int k)
+{
+    k = std::max(0, std::min(k, length));
+    length -= k;
+    first += k;
+    // Chunks whose every edge is gone become the spare, emptied but still allocated.
+    while (!chunks.empty() && first >= static_cast<int>(chunks.front().source.size()))
+    {
+        first -= static_cast<int>(chunks.front().source.size());
+        Chunk& chunk = chunks.front();
+        chunk.source.clear();
+        chunk.target.clear();
+        chunk.weight.clear();
+        chunk.time.clear();
+        spare = std::move(chunk);
+        chunks.pop_front();
+    }
+}
+
+void EdgeLog::Clear()
+{
+    chunks.clear();
+    spare = Chunk();
+    first = 0;
+    length = 0;
+}
+
+std::vector<int> EdgeLog::Compact(const std::vector<char>& removed)
+{
+    if (static_cast<int>(removed.size()) != length)
+        throw std::invalid_argument("Need one flag per edge.");
+
+    EdgeLog kept(isWeighted);
+    std::vector<int> newIndex(length, -1);
+    for (int i = 0; i < length; i++)
+    {
+        if (removed[i])
+            continue;
+        newIndex[i] = kept.length;
+        kept.Push(Source(i), Target(i), Weight(i), Time(i));
+    }
+    chunks = std::move(kept.chunks);
+    first = 0;
+    length = kept.length;
+    return newIndex;
+}
+
+// =======================================================
+// Accessors
+// =======================================================
+
+int EdgeLog::Length() const
+{
+    return length;
+}
+
+bool EdgeLog::IsWeighted() const
+{
+    return isWeighted;
+}
+
+std::size_t EdgeLog::Bytes() const
+{
+    auto bytes = [](const Chunk& chunk)
+    {
+        return chunk.source.capacity() * sizeof(int) + chunk.target.capacity() * sizeof(int) +
+               chunk.weight.capacity() * sizeof(double) + chunk.time.capacity() * sizeof(double);
+    };
+    std::size_t total = bytes(spare);
+    for (const Chunk& chunk : chunks)
+        total += bytes(chunk);
+    return total;
+}
+
+int EdgeLog::Source(int i) const
+{
+    int slot = first + i;
+    return chunks[slot >> CHUNK_SHIFT].source[slot & (CHUNK_SIZE - 1)];
+}
+
+int EdgeLog::Target(int i) const
+{
+    int slot = first + i;
+    return chunks[slot >> CHUNK_SHIFT].target[slot & (CHUNK_SIZE - 1)];
+}
+
+double EdgeLog::Weight(int i) const
+{
+    if (!isWeighted)
+        return 1;
+    int slot = first + i;
+    return chunks[slot >> CHUNK_SHIFT].weight[slot & (CHUNK_SIZE - 1)];
+}
+
+double EdgeLog::Time(int i) const
+{
+    int slot = first + i;
+    return chunks[slot >> CHUNK_SHIFT].time[slot & (CHUNK_SIZE - 1)];
+}
+
+// =======================================================
+// Operator Overloads
+// =======================================================
+
+bool EdgeLog::operator==(const EdgeLog& other) const
+{
+    if (isWeighted != other.isWeighted || length != other.length)
+        return false;
+    for (int i = 0; i < length; i++)
+    {
+        if (Source(i) != other.Source(i) || Target(i) != other.Target(i) ||
+            Weight(i) != other.Weight(i) || Time(i) != other.Time(i))
+            return false;
+    }
+    return true;
+}
+
+bool EdgeLog::operator!=(const EdgeLog& other) const
+{
+    return !(*this == other);
+}
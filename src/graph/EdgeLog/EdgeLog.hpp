@@ -0,0 +1,100 @@
+#ifndef EDGELOG
+#define EDGELOG
+
+#include <vector>
+#include <deque>
+#include <cstddef>
+
+/**
+ * @brief Append-optimized edge list with timestamps, for streams of edges.
+ *
+ * Edge i is {Source(i), Target(i), Weight(i)} stamped with Time(i). The edges
+ * live in chunks of CHUNK_SIZE slots; every chunk holds its fields as separate
+ * arrays, like EdgeStore, and never grows past its first allocation. Push() thus
+ * never moves an edge already in the log, whatever its length.
+ *
+ * Edges leave from the front: PopFront() drops the oldest ones and returns each
+ * chunk it empties to a spare slot, so a sliding window over a stream reuses the
+ * same memory instead of allocating. Compact() removes edges anywhere, keeping
+ * the order of the rest, in O(length).
+ *
+ * Edge 0 is the oldest edge still in the log. The log does not order edges by
+ * time; MultiGraph keeps its timestamps non-decreasing so that the oldest edges
+ * are also the first ones.
+ */
+
+class EdgeLog
+{
+    private:
+        struct Chunk
+        {
+            std::vector<int> source;        // Tail of every edge.
+            std::vector<int> target;        // Head of every edge.
+            std::vector<double> weight;     // Weight of every edge; empty if the log is unweighted.
+            std::vector<double> time;       // Timestamp of every edge.
+        };
+
+        std::deque<Chunk> chunks;   // The front chunk holds the oldest edges.
+        Chunk spare;                // Last emptied chunk, kept for the next one needed.
+        int first;                  // Slot of edge 0 in chunks.front().
+        int length;                 // Number of edges.
+        bool isWeighted;
+
+        void grow();                // Append an empty chunk with room for CHUNK_SIZE edges.
+
+    public:
+        static const int CHUNK_SHIFT = 12;                  // log2 of the chunk size.
+        static const int CHUNK_SIZE = 1 << CHUNK_SHIFT;     // Edges per chunk.
+
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        /**
+         * @brief Create an empty log.
+         *
+         * @param weighted True if the edges carry weights (default false).
+         */
+        explicit EdgeLog(bool weighted = false);
+
+        ~EdgeLog();
+
+        // ==================================================
+        // Modification Methods
+        // ==================================================
+
+        void Push(int u, int v, double w = 1, double t = 0);   // Append an edge at time t; w is ignored by unweighted logs. O(1).
+        void PopFront(int k);                                   // Drop the k oldest edges (all of them if k >= Length()). O(k / CHUNK_SIZE).
+        void Clear();                                           // Remove all edges and free the chunks.
+
+        /**
+         * @brief Drop the edges marked in removed, keeping the order of the rest.
+         *
+         * @param removed One flag per edge; non-zero edges are dropped.
+         * @return The new index of every old edge, -1 for dropped ones.
+         * @throws std::invalid_argument if removed does not have one flag per edge.
+         */
+        std::vector<int> Compact(const std::vector<char>& removed);
+
+        // ==================================================
+        // Accessors
+        // ==================================================
+
+        int Length() const;                 // Number of edges.
+        bool IsWeighted() const;
+        std::size_t Bytes() const;          // Heap memory held by the chunks, the spare one included.
+
+        int Source(int i) const;            // Tail of edge i (unchecked).
+        int Target(int i) const;            // Head of edge i (unchecked).
+        double Weight(int i) const;         // Weight of edge i (unchecked); 1 if unweighted.
+        double Time(int i) const;           // Timestamp of edge i (unchecked).
+
+        // ==================================================
+        // Operator Overloads
+        // ==================================================
+
+        bool operator==(const EdgeLog& other) const;    // Same weightedness and the same edges and times in the same order.
+        bool operator!=(const EdgeLog& other) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+// EdgeStore-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 EdgeStore.cpp EdgeStore-test.cpp ../../array/GeneralArray/GeneralArray.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include "EdgeStore.hpp"
+
+using namespace std;
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // A weighted store: push, read back, compact.
+    // ---------------------------------------------------------------
+    EdgeStore<double> weighted(true);
+    weighted.Push(0, 1, 2.5);
+    weighted.Push(1, 2, 1.0);
+    weighted.Push(2, 0, 4.0);
+    weighted.Push(2, 3, 0.5);
+    cout << "Edges:";
+    for (int i = 0; i < weighted.Length(); i++)
+        cout << " {" << weighted.Source(i) << ", " << weighted.Target(i) << ", " << weighted.Weight(i) << "}";
+    cout << endl;
+
+    vector<int> newIndex = weighted.Compact({0, 1, 0, 0});
+    assert(weighted.Length() == 3);
+    assert(newIndex[0] == 0 && newIndex[1] == -1 && newIndex[2] == 1 && newIndex[3] == 2);
+    assert(weighted.Source(1) == 2 && weighted.Target(1) == 0 && weighted.Weight(1) == 4.0);
+    cout << "After removing edge 1:";
+    for (int i = 0; i < weighted.Length(); i++)
+        cout << " {" << weighted.Source(i) << ", " << weighted.Target(i) << ", " << weighted.Weight(i) << "}";
+    cout << endl;
+
+    // An unweighted store keeps no weights and reports 1.
+    EdgeStore<float> plain;
+    plain.Push(5, 6, 9.0f);
+    assert(plain.Weight(0) == 1.0f && plain.Weights().empty());
+
+    // ---------------------------------------------------------------
+    // The MIXED_TYPE shim.
+    // ---------------------------------------------------------------
+    vector<MIXED_TYPE> edge = weighted.At(2);
+    assert(edge.size() == 3 && get<int>(edge[0]) == 2 && get<int>(edge[1]) == 3 && get<double>(edge[2]) == 0.5);
+    assert(plain.At(0).size() == 2);
+    GeneralArray<vector<MIXED_TYPE>> mixed = weighted.ToMixed();
+    assert(mixed.Length() == 3);
+    try
+    {
+        weighted.At(3);
+    }
+    catch (const out_of_range& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    EdgeStore<double> copy = weighted;
+    assert(copy == weighted);
+    copy.Push(3, 3, 1);
+    assert(copy != weighted);
+
+    // ---------------------------------------------------------------
+    // Memory per edge against one std::vector<MIXED_TYPE> per edge.
+    // ---------------------------------------------------------------
+    const int m = 100000;
+    EdgeStore<double> big(true);
+    big.Reserve(m);
+    for (int i = 0; i < m; i++)
+        big.Push(i, i + 1, i * 0.5);
+    size_t variantBytes = sizeof(vector<MIXED_TYPE>) + 3 * sizeof(MIXED_TYPE);
+    cout << "Bytes per weighted edge: " << big.Bytes() / m << " (vector<MIXED_TYPE>: at least "
+         << variantBytes << ")" << endl;
+    assert(big.Bytes() / m * 8 <= variantBytes);
+    return 0;
+}
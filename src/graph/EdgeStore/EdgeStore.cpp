@@ -0,0 +1,178 @@
+#include "EdgeStore.hpp"
+#include <stdexcept>
+
+// =======================================================
+// Constructors and Destructor
+// =======================================================
+
+template <class W>
+EdgeStore<W>::EdgeStore(bool weighted) : source(), target(), weight(), isWeighted(weighted)
+{
+}
+
+template <class W>
+EdgeStore<W>::~EdgeStore()
+{
+    // The arrays free themselves.
+}
+
+// =======================================================
+// Modification Methods
+// =======================================================
+
+template <class W>
+void EdgeStore<W>::Push(int u, int v, W w)
+{
+    source.push_back(u);
+    target.push_back(v);
+    if (isWeighted)
+        weight.push_back(w);
+}
+
+template <class W>
+void EdgeStore<W>::Reserve(int m)
+{
+    source.reserve(m);
+    target.reserve(m);
+    if (isWeighted)
+        weight.reserve(m);
+}
+
+template <class W>
+void EdgeStore<W>::Clear()
+{
+    source.clear();
+    target.clear();
+    weight.clear();
+}
+
+template <class W>
+std::vector<int> EdgeStore<W>::Compact(const std::vector<char>& removed)
+{
+    if (removed.size() != source.size())
+        throw std::invalid_argument("Need one flag per edge.");
+
+    std::vector<int> newIndex(source.size(), -1);
+    int kept = 0;
+    for (size_t i = 0; i < source.size(); i++)
+    {
+        if (removed[i])
+            continue;
+        source[kept] = source[i];
+        target[kept] = target[i];
+        if (isWeighted)
+            weight[kept] = weight[i];
+        newIndex[i] = kept++;
+    }
+    source.resize(kept);
+    target.resize(kept);
+    if (isWeighted)
+        weight.resize(kept);
+    return newIndex;
+}
+
+// =======================================================
+// Accessors
+// =======================================================
+
+template <class W>
+int EdgeStore<W>::Length() const
+{
+    return static_cast<int>(source.size());
+}
+
+template <class W>
+bool EdgeStore<W>::IsWeighted() const
+{
+    return isWeighted;
+}
+
+template <class W>
+std::size_t EdgeStore<W>::Bytes() const
+{
+    return source.capacity() * sizeof(int) + target.capacity() * sizeof(int) + weight.capacity() * sizeof(W);
+}
+
+template <class W>
+int EdgeStore<W>::Source(int i) const
+{
+    return source[i];
+}
+
+template <class W>
+int EdgeStore<W>::Target(int i) const
+{
+    return target[i];
+}
+
+template <class W>
+W EdgeStore<W>::Weight(int i) const
+{
+    return isWeighted ? weight[i] : W(1);
+}
+
+template <class W>
+const std::vector<int>& EdgeStore<W>::Sources() const
+{
+    return source;
+}
+
+template <class W>
+const std::vector<int>& EdgeStore<W>::Targets() const
+{
+    return target;
+}
+
+template <class W>
+const std::vector<W>& EdgeStore<W>::Weights() const
+{
+    return weight;
+}
+
+// =======================================================
+// MIXED_TYPE Compatibility
+// =======================================================
+
+template <class W>
+std::vector<MIXED_TYPE> EdgeStore<W>::At(int i) const
+{
+    if (i < 0 || i >= Length())
+        throw std::out_of_range("Edge index out of range.");
+    std::vector<MIXED_TYPE> edge;
+    edge.push_back(source[i]);
+    edge.push_back(target[i]);
+    if (isWeighted)
+        edge.push_back(weight[i]);
+    return edge;
+}
+
+template <class W>
+GeneralArray<std::vector<MIXED_TYPE>> EdgeStore<W>::ToMixed() const
+{
+    GeneralArray<std::vector<MIXED_TYPE>> edges;
+    edges.Reserve(Length());
+    for (int i = 0; i < Length(); i++)
+        edges.Push_back(At(i));
+    return edges;
+}
+
+// =======================================================
+// Operator Overloads
+// =======================================================
+
+template <class W>
+bool EdgeStore<W>::operator==(const EdgeStore& other) const
+{
+    return isWeighted == other.isWeighted && source == other.source &&
+           target == other.target && weight == other.weight;
+}
+
+template <class W>
+bool EdgeStore<W>::operator!=(const EdgeStore& other) const
+{
+    return !(*this == other);
+}
+
+template class EdgeStore<double>;
+template class EdgeStore<float>;
+template class EdgeStore<int>;
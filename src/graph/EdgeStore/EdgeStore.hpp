@@ -0,0 +1,103 @@
+#ifndef EDGESTORE
+#define EDGESTORE
+
+#include <vector>
+#include <variant>
+#include <string>
+#include <cstddef>
+
+#include "../../array/GeneralArray/GeneralArray.hpp"
+
+using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
+
+/**
+ * @brief Edge list of a graph as a structure of arrays.
+ *
+ * Edge i is {Source(i), Target(i), Weight(i)}; the three fields live in three
+ * separate contiguous arrays, so an edge of an unweighted store takes 8 bytes
+ * and one of a weighted EdgeStore<double> 16, against well over 100 for a
+ * std::vector<MIXED_TYPE> per edge. Loops over the edges read plain ints and
+ * weights without any variant dispatch.
+ *
+ * An unweighted store keeps no weight array; Weight() then returns 1. Edges are
+ * only appended or compacted away, so their order is the order of insertion.
+ *
+ * At() and ToMixed() present edges in the old MIXED_TYPE form ({u, v} or
+ * {u, v, w}) for code that still expects it.
+ *
+ * W is the weight type: double, float or int.
+ */
+
+template <class W>
+class EdgeStore
+{
+    private:
+        std::vector<int> source;    // Tail of every edge.
+        std::vector<int> target;    // Head of every edge.
+        std::vector<W> weight;      // Weight of every edge; empty if the store is unweighted.
+        bool isWeighted;
+
+    public:
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        /**
+         * @brief Create an empty store.
+         *
+         * @param weighted True if the edges carry weights (default false).
+         */
+        explicit EdgeStore(bool weighted = false);
+
+        ~EdgeStore();
+
+        // ==================================================
+        // Modification Methods
+        // ==================================================
+
+        void Push(int u, int v, W w = 1);   // Append an edge; w is ignored by unweighted stores.
+        void Reserve(int m);                // Reserve room for m edges.
+        void Clear();                       // Remove all edges.
+
+        /**
+         * @brief Drop the edges marked in removed, keeping the order of the rest.
+         *
+         * @param removed One flag per edge; non-zero edges are dropped.
+         * @return The new index of every old edge, -1 for dropped ones.
+         * @throws std::invalid_argument if removed does not have one flag per edge.
+         */
+        std::vector<int> Compact(const std::vector<char>& removed);
+
+        // ==================================================
+        // Accessors
+        // ==================================================
+
+        int Length() const;                 // Number of edges.
+        bool IsWeighted() const;
+        std::size_t Bytes() const;          // Heap memory held by the arrays.
+
+        int Source(int i) const;            // Tail of edge i (unchecked).
+        int Target(int i) const;            // Head of edge i (unchecked).
+        W Weight(int i) const;              // Weight of edge i (unchecked); 1 if unweighted.
+
+        // The arrays themselves; Weights() is empty for unweighted stores.
+        const std::vector<int>& Sources() const;
+        const std::vector<int>& Targets() const;
+        const std::vector<W>& Weights() const;
+
+        // ==================================================
+        // MIXED_TYPE Compatibility
+        // ==================================================
+
+        std::vector<MIXED_TYPE> At(int i) const;                // Edge i as {u, v} or {u, v, w}; throws std::out_of_range.
+        GeneralArray<std::vector<MIXED_TYPE>> ToMixed() const;  // All edges in that form.
+
+        // ==================================================
+        // Operator Overloads
+        // ==================================================
+
+        bool operator==(const EdgeStore& other) const;  // Same weightedness and the same edges in the same order.
+        bool operator!=(const EdgeStore& other) const;
+};
+
+#endif
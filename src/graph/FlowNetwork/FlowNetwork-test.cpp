@@ -0,0 +1,137 @@
+// FlowNetwork-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 FlowNetwork.cpp FlowNetwork-test.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include "FlowNetwork.hpp"
+
+using namespace std;
+
+// The result must be a feasible flow of the given value whose cut edges have
+// exactly that capacity, which proves both the flow and the cut optimal.
+static void CheckFlow(int n, const vector<int>& src, const vector<int>& dst, const vector<double>& cap,
+                      bool directed, int s, int t, const FlowResult& result)
+{
+    vector<double> balance(n, 0);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        double f = result.flow[i];
+        assert(f <= cap[i] + 1e-9 && f >= (directed ? 0 : -cap[i]) - 1e-9);
+        balance[src[i]] -= f;
+        balance[dst[i]] += f;
+    }
+    for (int v = 0; v < n; v++)
+        if (v != s && v != t)
+            assert(fabs(balance[v]) < 1e-9);
+    assert(fabs(balance[t] - result.value) < 1e-9 && fabs(balance[s] + result.value) < 1e-9);
+
+    vector<char> side(n, 0);
+    for (int v : result.sourceSide)
+        side[v] = 1;
+    assert(side[s] && !side[t]);
+    double cut = 0;
+    for (int i : result.cutEdges)
+        cut += cap[i];
+    assert(fabs(cut - result.value) < 1e-9);
+}
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // The textbook network (CLRS figure 26.1): maximum flow 23.
+    // ---------------------------------------------------------------
+    vector<int> src = {0, 0, 1, 2, 1, 3, 2, 4, 3, 4};
+    vector<int> dst = {1, 2, 3, 1, 2, 2, 4, 3, 5, 5};
+    vector<double> cap = {16, 13, 12, 4, 10, 9, 14, 7, 20, 4};
+    FlowNetwork clrs(6, src, dst, cap);
+    const char* names[] = {"Push-relabel", "Dinic"};
+    FlowAlgorithm algorithms[] = {FlowAlgorithm::PUSH_RELABEL, FlowAlgorithm::DINIC};
+    for (int k = 0; k < 2; k++)
+    {
+        FlowResult result = clrs.MaxFlow(0, 5, algorithms[k]);
+        cout << names[k] << ": flow " << result.value << ", source side";
+        for (int v : result.sourceSide)
+            cout << " " << v;
+        cout << ", cut edges";
+        for (int i : result.cutEdges)
+            cout << " " << src[i] << "->" << dst[i];
+        cout << endl;
+        assert(result.value == 23);
+        CheckFlow(6, src, dst, cap, true, 0, 5, result);
+    }
+
+    // Undirected: the same edges carry flow either way.
+    FlowResult both = FlowNetwork(6, src, dst, cap, false).PushRelabel(0, 5);
+    cout << "Undirected: flow " << both.value << endl;
+    CheckFlow(6, src, dst, cap, false, 0, 5, both);
+    assert(both.value == FlowNetwork(6, src, dst, cap, false).Dinic(0, 5).value);
+
+    // Parallel edges add up; no path means no flow and an empty cut.
+    FlowNetwork parallel(3, {0, 0, 1, 1}, {1, 1, 2, 2}, {2, 3, 1, 1});
+    assert(parallel.MaxFlow(0, 2).value == 2 && parallel.Dinic(0, 2).cutEdges == vector<int>({2, 3}));
+    FlowResult none = parallel.MaxFlow(2, 0);
+    assert(none.value == 0 && none.cutEdges.empty() && none.sourceSide == vector<int>({2}));
+
+    // ---------------------------------------------------------------
+    // Random networks: both algorithms agree and certify their result.
+    // ---------------------------------------------------------------
+    srand(9);
+    for (int round = 0; round < 200; round++)
+    {
+        int n = 2 + rand() % 40;
+        int m = rand() % (4 * n);
+        bool directed = round % 3 != 0;
+        src.assign(m, 0);
+        dst.assign(m, 0);
+        cap.assign(m, 0);
+        for (int i = 0; i < m; i++)
+        {
+            src[i] = rand() % n;
+            dst[i] = rand() % n;
+            cap[i] = round % 2 ? rand() % 10 : (rand() % 1000) / 64.0;
+        }
+        FlowNetwork network(n, src, dst, cap, directed);
+        int s = rand() % n, t = (s + 1 + rand() % (n - 1)) % n;
+        FlowResult pushRelabel = network.PushRelabel(s, t);
+        FlowResult dinic = network.Dinic(s, t);
+        CheckFlow(n, src, dst, cap, directed, s, t, pushRelabel);
+        CheckFlow(n, src, dst, cap, directed, s, t, dinic);
+        assert(fabs(pushRelabel.value - dinic.value) < 1e-9);
+    }
+    cout << "Random networks: push-relabel and Dinic agree." << endl;
+
+    // A long path: no recursion depth problems, and unit capacity everywhere.
+    int length = 200000;
+    src.resize(length - 1);
+    dst.resize(length - 1);
+    for (int v = 0; v + 1 < length; v++)
+    {
+        src[v] = v;
+        dst[v] = v + 1;
+    }
+    FlowNetwork path(length, src, dst, {});
+    assert(path.Dinic(0, length - 1).value == 1 && path.PushRelabel(0, length - 1).value == 1);
+
+    try
+    {
+        clrs.MaxFlow(3, 3);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    try
+    {
+        FlowNetwork(2, {0}, {1}, {-1.0});
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    return 0;
+}
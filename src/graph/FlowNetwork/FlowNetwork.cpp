@@ -0,0 +1,377 @@
+#include "FlowNetwork.hpp"
+#include <stdexcept>
+#include <algorithm>
+
+// ================================
+// Construction
+// ================================
+
+FlowNetwork::FlowNetwork(int numNodes, const std::vector<int>& source, const std::vector<int>& target,
+                         const std::vector<double>& capacities, bool directed)
+    : n(numNodes), m(static_cast<int>(source.size())), directed(directed)
+{
+    if (n < 0)
+        throw std::invalid_argument("Number of nodes must be non-negative.");
+    if (target.size() != source.size() || (!capacities.empty() && capacities.size() != source.size()))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+
+    offset.assign(n + 1, 0);
+    for (int i = 0; i < m; i++)
+    {
+        if (source[i] < 0 || source[i] >= n || target[i] < 0 || target[i] >= n)
+            throw std::invalid_argument("Edge endpoint out of range.");
+        if (!capacities.empty() && !(capacities[i] >= 0))
+            throw std::invalid_argument("Capacities must be non-negative.");
+        offset[source[i] + 1]++;
+        offset[target[i] + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+        offset[v + 1] += offset[v];
+
+    // Edge i puts its forward arc at its source and the partner arc at its target.
+    head.resize(2 * m);
+    partner.resize(2 * m);
+    capacity.resize(2 * m);
+    edgeArc.resize(m);
+    std::vector<int> next(offset.begin(), offset.end() - 1);
+    for (int i = 0; i < m; i++)
+    {
+        double c = capacities.empty() ? 1.0 : capacities[i];
+        int a = next[source[i]]++;
+        int b = next[target[i]]++;
+        head[a] = target[i];
+        head[b] = source[i];
+        partner[a] = b;
+        partner[b] = a;
+        capacity[a] = c;
+        capacity[b] = directed ? 0.0 : c;
+        edgeArc[i] = a;
+    }
+}
+
+int FlowNetwork::NumberOfNodes() const
+{
+    return n;
+}
+
+int FlowNetwork::NumberOfEdges() const
+{
+    return m;
+}
+
+void FlowNetwork::checkTerminals(int s, int t) const
+{
+    if (s < 0 || s >= n || t < 0 || t >= n)
+        throw std::invalid_argument("Source or sink out of range.");
+    if (s == t)
+        throw std::invalid_argument("Source and sink must differ.");
+}
+
+FlowResult FlowNetwork::MaxFlow(int s, int t, FlowAlgorithm algorithm) const
+{
+    switch (algorithm)
+    {
+        case FlowAlgorithm::PUSH_RELABEL:
+            return PushRelabel(s, t);
+        case FlowAlgorithm::DINIC:
+            return Dinic(s, t);
+    }
+    throw std::invalid_argument("Unknown flow algorithm.");
+}
+
+// The flow on an arc is what it lost of its capacity. The vertices still reachable
+// from s in the residual graph form the source side of a minimum cut.
+FlowResult FlowNetwork::finish(const std::vector<double>& residual, int s) const
+{
+    FlowResult result;
+    result.value = 0;
+    for (int a = offset[s]; a < offset[s + 1]; a++)
+        result.value += capacity[a] - residual[a];
+
+    result.flow.resize(m);
+    for (int i = 0; i < m; i++)
+        result.flow[i] = capacity[edgeArc[i]] - residual[edgeArc[i]];
+
+    std::vector<char> reached(n, 0);
+    std::vector<int> queue(1, s);
+    reached[s] = 1;
+    for (size_t k = 0; k < queue.size(); k++)
+    {
+        int v = queue[k];
+        for (int a = offset[v]; a < offset[v + 1]; a++)
+            if (residual[a] > 0 && !reached[head[a]])
+            {
+                reached[head[a]] = 1;
+                queue.push_back(head[a]);
+            }
+    }
+    for (int v = 0; v < n; v++)
+        if (reached[v])
+            result.sourceSide.push_back(v);
+    for (int i = 0; i < m; i++)
+    {
+        int u = head[partner[edgeArc[i]]], v = head[edgeArc[i]];
+        if (directed ? reached[u] && !reached[v] : reached[u] != reached[v])
+            result.cutEdges.push_back(i);
+    }
+    return result;
+}
+
+// ================================
+// Push-Relabel
+// ================================
+
+FlowResult FlowNetwork::PushRelabel(int s, int t) const
+{
+    checkTerminals(s, t);
+    std::vector<double> residual = capacity;
+    std::vector<double> excess(n, 0);
+    std::vector<int> height(n, 0);
+    std::vector<int> current(offset.begin(), offset.end() - 1);
+
+    // Active vertices by label; an entry whose label changed since it was added is
+    // moved when it comes up.
+    std::vector<std::vector<int>> active(2 * n + 1);
+    int highest = -1;
+
+    // Vertices with a label below n in doubly linked lists per label, for the gap
+    // heuristic. top is the highest non-empty label.
+    std::vector<int> layerHead(n, -1), prev(n, -1), next(n, -1);
+    int top = -1;
+    auto link = [&](int v)
+    {
+        int h = height[v];
+        prev[v] = -1;
+        next[v] = layerHead[h];
+        if (next[v] != -1)
+            prev[next[v]] = v;
+        layerHead[h] = v;
+        top = std::max(top, h);
+    };
+    auto unlink = [&](int v)
+    {
+        if (prev[v] != -1)
+            next[prev[v]] = next[v];
+        else
+            layerHead[height[v]] = next[v];
+        if (next[v] != -1)
+            prev[next[v]] = prev[v];
+    };
+    auto activate = [&](int v)
+    {
+        active[height[v]].push_back(v);
+        highest = std::max(highest, height[v]);
+    };
+
+    // Exact labels: distance to t in the residual graph, or n plus the distance to
+    // s for vertices that cannot reach t. Vertices reaching neither hold no excess.
+    std::vector<int> queue;
+    queue.reserve(n);
+    auto globalRelabel = [&]()
+    {
+        height.assign(n, 2 * n);
+        height[t] = 0;
+        height[s] = n;
+        for (int root : {t, s})
+        {
+            queue.assign(1, root);
+            for (size_t k = 0; k < queue.size(); k++)
+            {
+                int w = queue[k];
+                for (int a = offset[w]; a < offset[w + 1]; a++)
+                {
+                    int x = head[a];
+                    if (height[x] == 2 * n && residual[partner[a]] > 0)
+                    {
+                        height[x] = height[w] + 1;
+                        queue.push_back(x);
+                    }
+                }
+            }
+        }
+        std::fill(layerHead.begin(), layerHead.end(), -1);
+        top = -1;
+        for (auto& bucket : active)
+            bucket.clear();
+        highest = -1;
+        for (int v = 0; v < n; v++)
+        {
+            current[v] = offset[v];
+            if (height[v] < n)
+                link(v);
+            if (v != s && v != t && excess[v] > 0)
+                activate(v);
+        }
+    };
+
+    // Saturate every arc out of s, then label.
+    for (int a = offset[s]; a < offset[s + 1]; a++)
+    {
+        double delta = residual[a];
+        residual[a] = 0;
+        residual[partner[a]] += delta;
+        excess[head[a]] += delta;
+    }
+    globalRelabel();
+    long long work = 0;
+    const long long relabelPeriod = static_cast<long long>(GLOBAL_RELABEL_FREQUENCY) * n + 2LL * m;
+
+    while (highest >= 0)
+    {
+        if (active[highest].empty())
+        {
+            highest--;
+            continue;
+        }
+        int v = active[highest].back();
+        active[highest].pop_back();
+        if (height[v] != highest)
+        {
+            // Lifted by a gap since it was added.
+            if (height[v] < 2 * n)
+                activate(v);
+            continue;
+        }
+
+        // Discharge v until its excess is gone or it has to be relabeled.
+        while (excess[v] > 0)
+        {
+            if (current[v] == offset[v + 1])
+            {
+                int old = height[v];
+                int lowest = 2 * n;
+                for (int a = offset[v]; a < offset[v + 1]; a++)
+                    if (residual[a] > 0)
+                        lowest = std::min(lowest, height[head[a]] + 1);
+                work += offset[v + 1] - offset[v] + 12;
+                current[v] = offset[v];
+
+                if (old < n)
+                {
+                    unlink(v);
+                    if (layerHead[old] == -1)
+                    {
+                        // Gap: nothing at label old any more, so nothing above it can reach t.
+                        for (int h = old + 1; h <= top; h++)
+                        {
+                            for (int u = layerHead[h]; u != -1; u = next[u])
+                                height[u] = n + 1;
+                            layerHead[h] = -1;
+                        }
+                        top = old - 1;
+                        lowest = std::max(lowest, n + 1);
+                    }
+                }
+                height[v] = lowest;
+                if (lowest < n)
+                    link(v);
+                if (work > relabelPeriod)
+                {
+                    globalRelabel();
+                    work = 0;
+                }
+                else if (lowest < 2 * n)
+                    activate(v);
+                break;
+            }
+
+            int a = current[v];
+            int w = head[a];
+            if (residual[a] > 0 && height[v] == height[w] + 1)
+            {
+                double delta = std::min(excess[v], residual[a]);
+                if (excess[w] == 0 && w != s && w != t)
+                    activate(w);
+                residual[a] -= delta;
+                residual[partner[a]] += delta;
+                excess[v] -= delta;
+                excess[w] += delta;
+                if (residual[a] == 0)
+                    current[v]++;
+            }
+            else
+                current[v]++;
+        }
+    }
+    return finish(residual, s);
+}
+
+// ================================
+// Dinic
+// ================================
+
+FlowResult FlowNetwork::Dinic(int s, int t) const
+{
+    checkTerminals(s, t);
+    std::vector<double> residual = capacity;
+    std::vector<int> level(n);
+    std::vector<int> current(n);
+    std::vector<int> queue;
+    queue.reserve(n);
+    std::vector<int> path;     // Arcs from s to the vertex being expanded.
+
+    while (true)
+    {
+        // Levels: BFS distance from s over residual arcs, up to the level of t.
+        std::fill(level.begin(), level.end(), -1);
+        level[s] = 0;
+        queue.assign(1, s);
+        for (size_t k = 0; k < queue.size() && level[t] == -1; k++)
+        {
+            int v = queue[k];
+            for (int a = offset[v]; a < offset[v + 1]; a++)
+                if (residual[a] > 0 && level[head[a]] == -1)
+                {
+                    level[head[a]] = level[v] + 1;
+                    queue.push_back(head[a]);
+                }
+        }
+        if (level[t] == -1)
+            break;
+
+        // Blocking flow: advance along level arcs, retreat from dead ends, and after
+        // every augmentation back up to the first saturated arc.
+        std::copy(offset.begin(), offset.end() - 1, current.begin());
+        path.clear();
+        int v = s;
+        while (true)
+        {
+            if (v == t)
+            {
+                double delta = residual[path[0]];
+                for (int a : path)
+                    delta = std::min(delta, residual[a]);
+                size_t saturated = path.size();
+                for (size_t k = 0; k < path.size(); k++)
+                {
+                    residual[path[k]] -= delta;
+                    residual[partner[path[k]]] += delta;
+                    if (residual[path[k]] == 0 && saturated == path.size())
+                        saturated = k;
+                }
+                path.resize(saturated);
+                v = path.empty() ? s : head[path.back()];
+                continue;
+            }
+
+            int& a = current[v];
+            while (a < offset[v + 1] && !(residual[a] > 0 && level[head[a]] == level[v] + 1))
+                a++;
+            if (a < offset[v + 1])
+            {
+                path.push_back(a);
+                v = head[a];
+                continue;
+            }
+
+            // Dead end: drop v from this phase and skip the arc that led to it.
+            if (v == s)
+                break;
+            level[v] = -1;
+            path.pop_back();
+            v = path.empty() ? s : head[path.back()];
+            current[v]++;
+        }
+    }
+    return finish(residual, s);
+}
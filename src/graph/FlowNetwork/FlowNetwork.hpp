@@ -0,0 +1,114 @@
+#ifndef FLOWNETWORK
+#define FLOWNETWORK
+
+#include <vector>
+
+/**
+ * @brief Maximum flow algorithms.
+ *
+ * - PUSH_RELABEL: highest-label push-relabel with the global relabeling and gap
+ *               heuristics. O(V^2 sqrt(E)); usually the fastest.
+ * - DINIC:      blocking flows along BFS levels. O(V^2 E), O(E sqrt(V)) on unit
+ *               capacities; fast on networks with short augmenting paths.
+ */
+enum class FlowAlgorithm
+{
+    PUSH_RELABEL,   // Highest-label push-relabel.
+    DINIC           // Dinic's blocking flows.
+};
+
+/**
+ * @brief A maximum flow and a minimum cut.
+ *
+ * Edges and vertices are those of the network: edge i is the i-th edge given to
+ * the constructor. Graph::MaxFlow() and MultiGraph::MaxFlow() report node
+ * identifiers in sourceSide instead of vertex indices.
+ */
+struct FlowResult
+{
+    double value;                   // Value of the maximum flow.
+    std::vector<double> flow;       // Flow on every edge; negative if an undirected edge is used from target to source.
+    std::vector<int> sourceSide;    // Vertices on the source side of a minimum cut, in increasing order.
+    std::vector<int> cutEdges;      // Edges between the source side and the rest; their capacities add up to value.
+};
+
+/**
+ * @brief A capacitated network stored as a residual graph in compact arrays.
+ *
+ * Every edge u -> v with capacity c becomes a pair of arcs: u -> v with residual
+ * capacity c and v -> u with residual capacity 0 (c for undirected edges). The
+ * arcs of a vertex are contiguous (compressed sparse row), and every arc knows
+ * the index of its partner, so a push is two array updates.
+ *
+ * The network is built once and can be solved for any number of source and sink
+ * pairs. Every solve copies the capacities into its own residual array, so
+ * concurrent solves on one network are safe.
+ */
+class FlowNetwork
+{
+    private:
+        int n;                          // Number of vertices.
+        int m;                          // Number of edges.
+        bool directed;                  // False if every edge carries flow both ways.
+        std::vector<int> offset;        // Arcs of vertex v: offset[v] .. offset[v+1]-1.
+        std::vector<int> head;          // Head of every arc.
+        std::vector<int> partner;       // Reverse arc of every arc.
+        std::vector<double> capacity;   // Residual capacity of every arc before any flow.
+        std::vector<int> edgeArc;       // Forward arc of every edge.
+
+        void checkTerminals(int s, int t) const;
+
+        // Flows, minimum cut and value from the final residual capacities.
+        FlowResult finish(const std::vector<double>& residual, int s) const;
+
+    public:
+        /**
+         * @brief Build a network.
+         *
+         * @param numNodes Number of vertices; they are 0 .. numNodes-1.
+         * @param source Tail of every edge.
+         * @param target Head of every edge.
+         * @param capacities Capacity of every edge; empty for capacity 1 everywhere.
+         * @param directed False if edges carry flow in both directions (up to their capacity in total).
+         * @throws std::invalid_argument if the arrays differ in length, an endpoint is out of
+         *         range or a capacity is negative.
+         */
+        FlowNetwork(int numNodes, const std::vector<int>& source, const std::vector<int>& target,
+                    const std::vector<double>& capacities, bool directed = true);
+
+        int NumberOfNodes() const;
+        int NumberOfEdges() const;
+
+        /**
+         * @brief Maximum flow from s to t with the chosen algorithm.
+         *
+         * @throws std::invalid_argument if s or t is out of range or s == t.
+         */
+        FlowResult MaxFlow(int s, int t, FlowAlgorithm algorithm = FlowAlgorithm::PUSH_RELABEL) const;
+
+        /**
+         * @brief Highest-label push-relabel.
+         *
+         * Active vertices are discharged from the highest label down, through a
+         * current-arc pointer per vertex. Exact distance labels are recomputed by a
+         * backward BFS from t (and from s for vertices cut off from t) at the start
+         * and after every GLOBAL_RELABEL_FREQUENCY * V + E units of relabel work.
+         * When a label below V empties, every vertex above it is lifted past V at once
+         * (gap heuristic), since none of them can reach t any more. Their excess then
+         * flows back to s, so the result is a flow, not only a preflow.
+         */
+        FlowResult PushRelabel(int s, int t) const;
+
+        /**
+         * @brief Dinic's algorithm.
+         *
+         * Every phase labels the vertices by BFS distance from s in the residual
+         * graph and saturates a blocking flow of shortest augmenting paths, found by
+         * an iterative depth-first search with a current-arc pointer per vertex.
+         */
+        FlowResult Dinic(int s, int t) const;
+
+        static const int GLOBAL_RELABEL_FREQUENCY = 6;     // Relabel work between global relabelings, per vertex.
+};
+
+#endif
@@ -1,6 +1,18 @@
 // GraphTest.cpp
 // Compile with (for example):
-// g++ -std=c++17 Graph.cpp Graph-test.cpp\
+// g++ -std=c++17 -pthread Graph.cpp Graph-test.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../VertexQueue/VertexQueue.cpp\
+    ../Parallel/Parallel.cpp\
+    ../GraphLoader/GraphLoader.cpp\
+    ../DistanceMatrix/DistanceMatrix.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../GraphView/GraphView.cpp\
+    ../EdgeStore/EdgeStore.cpp\
+    ../GraphAnalytics/GraphAnalytics.cpp\
+    ../GraphOrdering/GraphOrdering.cpp\
+    ../GraphPartitioner/GraphPartitioner.cpp\
+    ../FlowNetwork/FlowNetwork.cpp\
     ../../array/GeneralArray/GeneralArray.cpp\
     ../../array/SparseMatrix/SparseMatrix.cpp\
     ../../chain/Node/Node.cpp\
@@ -13,6 +25,9 @@
 
 #include <iostream>
 #include <vector>
+#include <cassert>
+#include <cstdlib>
+#include <algorithm>
 
 #include "Graph.hpp"
 
@@ -142,10 +157,26 @@ int main()
     g.RemoveNode(6);
     cout << "Number of nodes after removal: " << g.NumberOfNodes() << endl;
     cout << "Number of edges after removal: " << g.NumberOfEdges() << endl;
-    for (int i = 0; i < g.NumberOfNodes(); i++) {
-        cout << "Degree of node " << i << ": " << g.Degree(i) << endl;
+    for (int node : g.Nodes()) {
+        cout << "Degree of node " << node << ": " << g.Degree(node) << endl;
     }
     cout << endl;
+
+    // Batched updates on a copy: delete two edges and insert two in one call.
+    Graph g3 = g;
+    EdgeArray inserts, deletes;
+    inserts.source = {0, 2};
+    inserts.target = {7, 5};
+    inserts.weight = {15, 25};
+    deletes.source = {0, 4};
+    deletes.target = {1, 5};
+    g3.ApplyUpdates(inserts, deletes);
+    g3.Compact();
+    cout << "After ApplyUpdates (+{0,7} +{2,5} -{0,1} -{4,5}):" << endl;
+    cout << " - Number of edges: " << g3.NumberOfEdges() << endl;
+    cout << " - Edge 0-1 exists? " << (g3.ExistsEdge(0, 1) ? "Yes" : "No") << endl;
+    cout << " - Edge 0-7 exists? " << (g3.ExistsEdge(0, 7) ? "Yes" : "No") << endl;
+    cout << " - " << g3 << endl << endl;
     
     vector<vector<int>> components = g.Components();
     cout << "Connected Components:" << endl;
@@ -175,6 +206,80 @@ int main()
     {
         cout << "Error computing biconnected components: " << ex.what() << endl;
     }
+
+    // Two triangles joined by the bridge 2 - 3, with a pendant edge 5 - 6.
+    Graph bow(7);
+    bow.AddEdge(0, 1); bow.AddEdge(1, 2); bow.AddEdge(2, 0);
+    bow.AddEdge(2, 3);
+    bow.AddEdge(3, 4); bow.AddEdge(4, 5); bow.AddEdge(5, 3);
+    bow.AddEdge(5, 6);
+    BiconnectedResult parts = bow.BiconnectedDecomposition();
+    cout << "Bow tie biconnected components:" << endl;
+    for (size_t i = 0; i < parts.components.size(); i++) 
+    {
+        cout << " Component " << i << ": ";
+        for (int node : parts.components[i])
+            cout << node << " ";
+        cout << endl;
+    }
+    cout << "Articulation points: ";
+    for (int node : parts.articulationPoints)
+        cout << node << " ";
+    cout << endl << "Bridges: ";
+    for (const auto& [u, v] : parts.bridges)
+        cout << "{" << u << ", " << v << "} ";
+    cout << endl;
+
+    // Random graphs: a node is an articulation point exactly if removing it adds
+    // components, an edge a bridge exactly if removing it does.
+    srand(7);
+    for (int trial = 0; trial < 5; trial++) 
+    {
+        Graph r(25);
+        for (int i = 0; i < 30; i++) 
+        {
+            int u = rand() % 25, v = rand() % 25;
+            if (u != v && !r.ExistsEdge(u, v))
+                r.AddEdge(u, v);
+        }
+        size_t before = r.Components().size();
+        BiconnectedResult rp = r.BiconnectedDecomposition();
+        for (int v = 0; v < 25; v++) 
+        {
+            Graph without = r;
+            without.RemoveNode(v);
+            bool cut = without.Components().size() > before;
+            bool listed = find(rp.articulationPoints.begin(), rp.articulationPoints.end(), v) != rp.articulationPoints.end();
+            assert(cut == listed);
+        }
+        for (const auto& [u, v] : rp.bridges) 
+        {
+            Graph without = r;
+            without.RemoveEdge(u, v);
+            assert(without.Components().size() == before + 1);
+        }
+    }
+
+    // A path of a million nodes: far deeper than the call stack would allow.
+    // Every edge is a bridge and every inner node an articulation point.
+    EdgeArray path;
+    path.numNodes = 1000000;
+    for (int i = 0; i + 1 < path.numNodes; i++) 
+    {
+        path.source.push_back(i);
+        path.target.push_back(i + 1);
+    }
+    Graph deep = Graph::FromEdges(path);
+    BiconnectedResult deepParts = deep.BiconnectedDecomposition();
+    assert(deepParts.components.size() == static_cast<size_t>(path.numNodes - 1));
+    assert(deepParts.articulationPoints.size() == static_cast<size_t>(path.numNodes - 2));
+    assert(deepParts.bridges.size() == static_cast<size_t>(path.numNodes - 1));
+
+    // Closing the path into a cycle leaves one component and no cut.
+    deep.AddEdge(0, path.numNodes - 1);
+    deepParts = deep.BiconnectedDecomposition();
+    assert(deepParts.components.size() == 1 && deepParts.articulationPoints.empty() && deepParts.bridges.empty());
+    cout << "Path of " << path.numNodes << " nodes decomposed without recursion." << endl;
     
     cout << endl << "=== End of Graph Test Program ===" << endl;
     return 0;
@@ -1,6 +1,18 @@
 // Graph-algorithms-test.cpp
 // Compile with (for example):
-// g++ -std=c++17 Graph.cpp Graph-test2.cpp \
+// g++ -std=c++17 -pthread Graph.cpp Graph-test2.cpp \
+    ../CSRGraph/CSRGraph.cpp \
+    ../VertexQueue/VertexQueue.cpp \
+    ../Parallel/Parallel.cpp \
+    ../GraphLoader/GraphLoader.cpp \
+    ../DistanceMatrix/DistanceMatrix.cpp \
+    ../UnionFind/UnionFind.cpp \
+    ../GraphView/GraphView.cpp \
+    ../EdgeStore/EdgeStore.cpp \
+    ../GraphAnalytics/GraphAnalytics.cpp \
+    ../GraphOrdering/GraphOrdering.cpp \
+    ../GraphPartitioner/GraphPartitioner.cpp \
+    ../FlowNetwork/FlowNetwork.cpp \
     ../../array/GeneralArray/GeneralArray.cpp \
     ../../array/SparseMatrix/SparseMatrix.cpp \
     ../../chain/Node/Node.cpp \
@@ -13,7 +25,11 @@
 
 #include <iostream>
 #include <vector>
+#include <cassert>
+#include <cstdlib>
+#include <numeric>
 #include "Graph.hpp"
+#include "../Parallel/Parallel.hpp"
 #include "../../array/SparseMatrix/SparseMatrix.hpp"
 #include "../../chain/LinkedSparseMatrix/LinkedSparseMatrix.hpp"
 
@@ -79,6 +95,31 @@ int main()
     cout << "Sollin's MST:" << endl;
     cout << mstSollin << endl << endl;
 
+    // A random graph above FILTER_KRUSKAL_CUTOFF with repeated weights, on four
+    // threads: all three algorithms agree on the weight, Kruskal and Sollin on the forest.
+    Parallel::SetThreadCount(4);
+    srand(11);
+    EdgeArray random;
+    random.numNodes = 20000;
+    for (int i = 0; i < 200000; i++) 
+    {
+        random.source.push_back(rand() % random.numNodes);
+        random.target.push_back(rand() % random.numNodes);
+        random.weight.push_back(1 + rand() % 1000);
+    }
+    Graph r = Graph::FromEdges(random);
+    auto forestWeight = [](const Graph& f) 
+    {
+        const vector<double>& w = f.Compressed().Weights();
+        return accumulate(w.begin(), w.end(), 0.0) / 2;
+    };
+    Graph rk = r.Kruskal(), rp = r.Prim(), rs = r.Sollin();
+    assert(rk == rs);
+    assert(rk.NumberOfEdges() == rp.NumberOfEdges());
+    assert(forestWeight(rk) == forestWeight(rp));
+    cout << "Random graph: spanning forest of " << rk.NumberOfEdges() << " edges, weight " << forestWeight(rk) << endl << endl;
+    Parallel::SetThreadCount(0);
+
     // --- Test Shortest Path Algorithms ---
     int source = 0, destination = 4;
     vector<int> dijkstraPath = g.Dijkstra(source, destination);
@@ -87,6 +128,221 @@ int main()
         cout << node << " ";
     cout << endl << endl;
 
+    // Single-source, all-targets mode with each priority queue.
+    const char* heapNames[] = {"binary", "4-ary", "pairing", "radix"};
+    HeapType heaps[] = {HeapType::BINARY, HeapType::FOUR_ARY, HeapType::PAIRING, HeapType::RADIX};
+    for (int h = 0; h < 4; h++) 
+    {
+        ShortestPaths tree = g.Dijkstra(source, heaps[h]);
+        cout << "Dijkstra distances from " << source << " (" << heapNames[h] << " heap): ";
+        for (double d : tree.distance)
+            cout << d << " ";
+        cout << endl;
+    }
+    ShortestPaths tree = g.Dijkstra(source);
+    cout << "Path to 9 from the shortest path tree: ";
+    for (int node : g.PathTo(tree, 9))
+        cout << node << " ";
+    cout << endl << endl;
+
+    // Point-to-point searches; the heuristic 0 turns A* into Dijkstra's algorithm.
+    PathResult astar = g.AStar(source, destination, [](int) { return 0.0; });
+    PathResult bidir = g.BidirectionalDijkstra(source, destination);
+    PathResult hopsPath = g.BidirectionalBFS(source, destination);
+    cout << "A* path (length " << astar.distance << "): ";
+    for (int node : astar.path)
+        cout << node << " ";
+    cout << endl << "Bidirectional Dijkstra path (length " << bidir.distance << "): ";
+    for (int node : bidir.path)
+        cout << node << " ";
+    cout << endl << "Bidirectional BFS path (" << hopsPath.distance << " edges): ";
+    for (int node : hopsPath.path)
+        cout << node << " ";
+    cout << endl << endl;
+    assert(astar.distance == tree.distance[destination] && bidir.distance == tree.distance[destination]);
+
+    // A weighted grid with the Manhattan distance as heuristic (every weight is at
+    // least 1, so it never overestimates): all searches agree with full Dijkstra.
+    const int side = 120;
+    EdgeArray lattice;
+    lattice.numNodes = side * side;
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++) 
+        {
+            int u = r * side + c;
+            if (c + 1 < side) 
+            {
+                lattice.source.push_back(u);
+                lattice.target.push_back(u + 1);
+                lattice.weight.push_back(1 + rand() % 3);
+            }
+            if (r + 1 < side) 
+            {
+                lattice.source.push_back(u);
+                lattice.target.push_back(u + side);
+                lattice.weight.push_back(1 + rand() % 3);
+            }
+        }
+    Graph grid = Graph::FromEdges(lattice);
+    long long touchedAStar = 0, touchedBidirectional = 0, touchedDijkstra = 0;
+    for (int q = 0; q < 20; q++) 
+    {
+        int a = rand() % (side * side), b = rand() % (side * side);
+        auto manhattan = [&](int v) { return double(abs(v / side - b / side) + abs(v % side - b % side)); };
+        ShortestPaths full = grid.Dijkstra(a);
+        PathResult p1 = grid.AStar(a, b, manhattan);
+        PathResult p2 = grid.BidirectionalDijkstra(a, b);
+        PathResult p3 = grid.BidirectionalBFS(a, b);
+        assert(p1.distance == full.distance[b] && p2.distance == full.distance[b]);
+        assert(p3.distance == abs(a / side - b / side) + abs(a % side - b % side));
+        assert(p1.path.front() == a && p1.path.back() == b && p2.path.front() == a && p2.path.back() == b);
+        assert(p3.path.size() == size_t(p3.distance) + 1);
+        for (size_t i = 0; i + 1 < p2.path.size(); i++)
+            assert(grid.ExistsEdge(p2.path[i], p2.path[i + 1]));
+        touchedAStar += p1.visited;
+        touchedBidirectional += p2.visited;
+        touchedDijkstra += grid.AStar(a, b, [](int) { return 0.0; }).visited;
+    }
+    cout << "Grid queries: A* visited " << touchedAStar << ", bidirectional Dijkstra " << touchedBidirectional
+         << ", Dijkstra " << touchedDijkstra << " vertices." << endl;
+    assert(touchedAStar < touchedDijkstra && touchedBidirectional < touchedDijkstra);
+
+    // Directed graphs: the backward searches follow the in-arcs.
+    EdgeArray arcs;
+    arcs.numNodes = 300;
+    for (int i = 0; i < 1500; i++) 
+    {
+        arcs.source.push_back(rand() % 300);
+        arcs.target.push_back(rand() % 300);
+        arcs.weight.push_back(rand() % 20);
+    }
+    Graph directed = Graph::FromEdges(arcs, true);
+    for (int a = 0; a < 300; a += 37) 
+    {
+        ShortestPaths full = directed.Dijkstra(a);
+        BFSResult levels = directed.ParallelBFS(a);
+        for (int b = 0; b < 300; b++) 
+        {
+            PathResult p = directed.BidirectionalDijkstra(a, b);
+            PathResult h = directed.BidirectionalBFS(a, b);
+            assert(p.distance == full.distance[b]);
+            assert(levels.distance[b] == -1 ? h.path.empty() : h.distance == levels.distance[b]);
+        }
+    }
+
+    // Reordering moves positions but keeps node IDs, edges and distances.
+    OrderingStrategy strategies[] = {OrderingStrategy::REVERSE_CUTHILL_MCKEE, OrderingStrategy::DEGREE, OrderingStrategy::GORDER};
+    for (OrderingStrategy strategy : strategies) 
+    {
+        Graph reordered = directed;
+        reordered.Reorder(strategy);
+        assert(reordered.NumberOfEdges() == directed.NumberOfEdges());
+        for (int a = 0; a < 300; a += 37) 
+        {
+            ShortestPaths before = directed.Dijkstra(a);
+            ShortestPaths after = reordered.Dijkstra(a);
+            for (int b = 0; b < 300; b++)
+                assert(after.distance[reordered.IndexOf(b)] == before.distance[b]);
+        }
+    }
+    Graph reorderedGrid = grid;
+    vector<int> shuffled = grid.Nodes();
+    for (int i = static_cast<int>(shuffled.size()) - 1; i > 0; i--)
+        swap(shuffled[i], shuffled[rand() % (i + 1)]);
+    reorderedGrid.Reorder(shuffled);
+    assert(reorderedGrid.Nodes() == shuffled);
+    double shuffledGap = GraphOrdering::AverageGap(reorderedGrid.Compressed());
+    reorderedGrid.Reorder(OrderingStrategy::REVERSE_CUTHILL_MCKEE);
+    double orderedGap = GraphOrdering::AverageGap(reorderedGrid.Compressed());
+    cout << "Shuffled grid average index gap: " << shuffledGap << ", after RCM: " << orderedGap << endl;
+    assert(orderedGap * 10 < shuffledGap);
+    try 
+    {
+        reorderedGrid.Reorder(vector<int>{0, 1, 2});
+    } 
+    catch (const invalid_argument& e) 
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    // Four balanced parts of the grid; the shards together own every node.
+    PartitionResult quarters = grid.Partition(4);
+    cout << "Grid in 4 parts: sizes";
+    for (int size : quarters.size)
+        cout << " " << size;
+    cout << ", cut " << quarters.edgeCut << " of " << grid.NumberOfEdges() << " edges" << endl;
+    assert(quarters.imbalance <= 1.03 && quarters.edgeCut < grid.NumberOfEdges() / 20);
+    int sharded = 0;
+    for (int p = 0; p < 4; p++)
+        sharded += GraphPartitioner::Extract(grid.Compressed(), quarters.part, p).owned;
+    assert(sharded == grid.NumberOfNodes());
+
+    // Maximum flow between opposite corners, with the weights as capacities: both
+    // algorithms agree and the cut edges have exactly the capacity of the flow.
+    FlowResult corner = grid.MaxFlow(0, side * side - 1);
+    FlowResult cornerDinic = grid.MaxFlow(0, side * side - 1, FlowAlgorithm::DINIC);
+    double cutCapacity = 0;
+    for (int i : corner.cutEdges)
+        cutCapacity += lattice.weight[i];
+    cout << "Grid corner to corner: max flow " << corner.value << ", " << corner.cutEdges.size() << " cut edges" << endl;
+    assert(corner.value == cornerDinic.value && cutCapacity == corner.value);
+    cout << endl;
+
+    ShortestPaths stepped = g.DeltaStepping(source);
+    cout << "Delta-stepping distances from " << source << ": ";
+    for (double d : stepped.distance)
+        cout << d << " ";
+    cout << endl;
+
+    BFSResult hops = g.ParallelBFS(source);
+    cout << "Parallel BFS hop counts from " << source << ": ";
+    for (int d : hops.distance)
+        cout << d << " ";
+    cout << endl << "Parallel BFS order: ";
+    for (int v : hops.order)
+        cout << g.Nodes()[v] << " ";
+    cout << endl << "Fewest-edge path to 9: ";
+    for (int node : g.PathTo(hops, 9))
+        cout << node << " ";
+    cout << endl;
+
+    // Above PARALLEL_BFS_CUTOFF on four threads: the random graph (bottom-up steps)
+    // and a path of 200000 nodes (top-down only) against the sequential search.
+    EdgeArray line;
+    line.numNodes = 200000;
+    for (int i = 0; i + 1 < line.numNodes; i++) 
+    {
+        line.source.push_back(i);
+        line.target.push_back(i + 1);
+        line.weight.push_back(1);
+    }
+    Graph path = Graph::FromEdges(line);
+    for (const Graph* big : {&r, &path}) 
+    {
+        Parallel::SetThreadCount(1);
+        BFSResult sequential = big->ParallelBFS(0);
+        Parallel::SetThreadCount(4);
+        BFSResult parallel = big->ParallelBFS(0);
+        assert(parallel.distance == sequential.distance && parallel.order.size() == sequential.order.size());
+        for (size_t i = 1; i < parallel.order.size(); i++) 
+        {
+            int v = parallel.order[i];
+            assert(parallel.distance[parallel.order[i - 1]] <= parallel.distance[v]);
+            assert(parallel.distance[parallel.parent[v]] == parallel.distance[v] - 1);
+        }
+    }
+    cout << "Parallel BFS on a path of " << path.NumberOfNodes() << " nodes: last node at "
+         << path.ParallelBFS(0).distance.back() << " hops" << endl;
+    Parallel::SetThreadCount(0);
+
+    // All ten searches in one bit-parallel sweep; row 0 is the search from the source.
+    MultiSourceBFSResult every = g.MultiSourceBFS(g.Nodes());
+    assert(every.distance[0] == hops.distance);
+    cout << "Closeness (sum of hops) from every node: ";
+    for (long long sum : every.distanceSum)
+        cout << sum << " ";
+    cout << endl << endl;
+
     vector<int> bellmanPath = g.BellmanFord(source, destination);
     cout << "Bellman-Ford shortest path from " << source << " to " << destination << ":" << endl;
     for (int node : bellmanPath)
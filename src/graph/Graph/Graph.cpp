@@ -7,6 +7,16 @@
 #include <stack>
 #include <set>
 #include <limits>
+#include <unordered_map>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include "../Parallel/Parallel.hpp"
+#include "../UnionFind/UnionFind.hpp"
+#include "../GraphAnalytics/GraphAnalytics.hpp"
 
 // ====================================
 // Constructors and Destructor
@@ -16,7 +26,7 @@
 // Creates an empty graph. By default, the graph is unweighted and undirected.
 Graph::Graph()
     : n(0), e(0), isWeighted(false), isDirected(false),
-      nodeVector(), edgelist(), adjacencyList() 
+      nodeVector(), nodeIndex(), edgelist(false), removedEdge(), removedEdges(0), adjacencyList(), edgeSlot(), inDegree(), csr(), csrValid(false) 
 {
     // No nodes; edgelist is default constructed (and empty) and so is adjacencyList.
 }
@@ -25,7 +35,7 @@ Graph::Graph()
 // Initializes the graph with nodes labeled 0 through numNodes-1.
 Graph::Graph(int numNodes, bool weighted, bool directed)
     : n(numNodes), e(0), isWeighted(weighted), isDirected(directed),
-      nodeVector(), edgelist(), adjacencyList() 
+      nodeVector(), nodeIndex(), edgelist(weighted), removedEdge(), removedEdges(0), adjacencyList(), edgeSlot(), inDegree(), csr(), csrValid(false) 
 {
     // Initialize nodeVector with nodes 0, 1, ..., n-1.
     nodeVector.resize(n);
@@ -33,51 +43,164 @@ Graph::Graph(int numNodes, bool weighted, bool directed)
     {
         nodeVector[i] = i;
     }
+    compactIndex(0);
     
     // Build the adjacency list: for each node, create an empty inner list.
-    // (We assume that DoublyLinkedList has a default constructor and an InsertBack() method.)
-    while (!adjacencyList.IsEmpty()) 
-    {
-        adjacencyList.DeleteFront();
-    }
-    for (int i = 0; i < n; i++) 
-    {
-        DoublyLinkedList<int> emptyList;
-        adjacencyList.InsertBack(emptyList);
-    }
+    adjacencyList.assign(n, std::vector<int>());
+    edgeSlot.assign(n, std::vector<int>());
+    inDegree.assign(n, 0);
     // edgelist remains empty until edges are added.
 }
 
 // Constructor from a vector of node identifiers.
 Graph::Graph(const std::vector<int>& nodes, bool weighted, bool directed)
     : n(nodes.size()), e(0), isWeighted(weighted), isDirected(directed),
-      nodeVector(nodes), edgelist(), adjacencyList() 
+      nodeVector(nodes), nodeIndex(), edgelist(weighted), removedEdge(), removedEdges(0), adjacencyList(), edgeSlot(), inDegree(), csr(), csrValid(false) 
 {
+    compactIndex(0);
+    if (static_cast<int>(nodeIndex.size()) != n)
+        throw std::invalid_argument("Node identifiers must be unique.");
+
     // Build the adjacency list: create an empty inner list for each node.
-    while (!adjacencyList.IsEmpty()) 
-    {
-        adjacencyList.DeleteFront();
-    }
-    for (size_t i = 0; i < nodeVector.size(); i++) 
-    {
-        DoublyLinkedList<int> emptyList;
-        adjacencyList.InsertBack(emptyList);
-    }
+    adjacencyList.assign(n, std::vector<int>());
+    edgeSlot.assign(n, std::vector<int>());
+    inDegree.assign(n, 0);
     // edgelist remains empty.
 }
 
 // Destructor.
 Graph::~Graph() 
 {
-    // Clear nodeVector.
-    nodeVector.clear();
-    
-    // Clear the adjacency list.
-    while (!adjacencyList.IsEmpty()) 
+    // nodeVector, nodeIndex, edgelist and the adjacency lists are destroyed by their own destructors.
+}
+
+// Bulk constructor: one pass per structure instead of one AddEdge() per edge.
+Graph Graph::FromEdges(EdgeArray edges, bool directed, bool dedupe) 
+{
+    size_t m = edges.source.size();
+    if (edges.target.size() != m || (!edges.weight.empty() && edges.weight.size() != m))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+    if (m > static_cast<size_t>(std::numeric_limits<int>::max()))
+        throw std::length_error("Too many edges.");
+    bool weighted = !edges.weight.empty();
+
+    if (dedupe)
+        GraphLoader::SortAndDedupe(edges, directed);
+    m = edges.source.size();
+
+    // Node set: either 0 .. numNodes-1 or the sorted distinct endpoints.
+    std::vector<int> nodes;
+    if (edges.numNodes >= 0) 
+    {
+        nodes.resize(edges.numNodes);
+        for (int i = 0; i < edges.numNodes; i++)
+            nodes[i] = i;
+    } 
+    else 
+    {
+        nodes.resize(2 * m);
+        Parallel::For(0, m, [&](size_t i) 
+        {
+            nodes[2 * i] = edges.source[i];
+            nodes[2 * i + 1] = edges.target[i];
+        }, 1 << 16);
+        Parallel::Sort(nodes, std::less<int>());
+        nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+    }
+
+    Graph g(nodes, weighted, directed);
+    int numNodes = g.n;
+
+    // Translate the endpoints to positions. With numNodes set the IDs are the positions.
+    std::vector<int> src(m), dst(m);
+    Parallel::For(0, m, [&](size_t i) 
+    {
+        int u = edges.source[i], v = edges.target[i];
+        if (edges.numNodes >= 0) 
+        {
+            if (u < 0 || u >= numNodes || v < 0 || v >= numNodes)
+                throw std::out_of_range("Edge endpoint out of range.");
+            src[i] = u;
+            dst[i] = v;
+        } 
+        else 
+        {
+            src[i] = g.nodeIndex.find(u)->second;
+            dst[i] = g.nodeIndex.find(v)->second;
+        }
+    }, 1 << 16);
+
+    g.bulkLoad(src, dst, std::move(edges.weight));
+    return g;
+}
+
+Graph Graph::FromEdges(const std::vector<int>& nodes, EdgeArray edges, bool directed, EdgeAggregator aggregate) 
+{
+    size_t m = edges.source.size();
+    if (edges.target.size() != m || (!edges.weight.empty() && edges.weight.size() != m))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+    if (m > static_cast<size_t>(std::numeric_limits<int>::max()))
+        throw std::length_error("Too many edges.");
+
+    GraphLoader::SortAndDedupe(edges, directed, aggregate);
+    m = edges.source.size();
+    Graph g(nodes, !edges.weight.empty(), directed);
+
+    std::vector<int> src(m), dst(m);
+    Parallel::For(0, m, [&](size_t i) 
+    {
+        src[i] = g.indexOf(edges.source[i]);
+        dst[i] = g.indexOf(edges.target[i]);
+        if (src[i] == -1 || dst[i] == -1)
+            throw std::invalid_argument("One or both nodes do not exist.");
+    }, 1 << 16);
+
+    g.bulkLoad(src, dst, std::move(edges.weight));
+    return g;
+}
+
+void Graph::bulkLoad(const std::vector<int>& src, const std::vector<int>& dst, std::vector<double> weight)
+{
+    size_t m = src.size();
+
+    // Adjacency lists: count, reserve, then fill in edge order, as AddEdge() would.
+    std::vector<int> outCount(n, 0);
+    for (size_t i = 0; i < m; i++) 
+    {
+        outCount[src[i]]++;
+        if (isDirected)
+            inDegree[dst[i]]++;
+        else
+            outCount[dst[i]]++;
+    }
+    for (int i = 0; i < n; i++) 
+    {
+        adjacencyList[i].reserve(outCount[i]);
+        edgeSlot[i].reserve(outCount[i]);
+    }
+    for (size_t i = 0; i < m; i++) 
     {
-        adjacencyList.DeleteFront();
+        adjacencyList[src[i]].push_back(nodeVector[dst[i]]);
+        edgeSlot[src[i]].push_back(static_cast<int>(i));
+        if (!isDirected) 
+        {
+            adjacencyList[dst[i]].push_back(nodeVector[src[i]]);
+            edgeSlot[dst[i]].push_back(static_cast<int>(i));
+        }
     }
-    // edgelist is destroyed by its own destructor.
+
+    // Edge list.
+    edgelist.Reserve(static_cast<int>(m));
+    for (size_t i = 0; i < m; i++)
+        edgelist.Push(nodeVector[src[i]], nodeVector[dst[i]], isWeighted ? weight[i] : 1.0);
+    removedEdge.assign(m, 0);
+    e = static_cast<int>(m);
+
+    // The compressed adjacency is built right away from the position arrays.
+    if (!isWeighted)
+        weight.assign(m, 1.0);
+    csr = CSRGraph(n, src, dst, weight, isDirected);
+    csrValid = true;
 }
 
 
@@ -89,119 +212,108 @@ Graph::~Graph()
 void Graph::AddNode(int node) 
 {
     // If node already exists, throw.
-    if (std::find(nodeVector.begin(), nodeVector.end(), node) != nodeVector.end())
+    if (nodeIndex.count(node))
         throw std::invalid_argument("Node already exists.");
     
     // Append the new node.
+    nodeIndex[node] = n;
     nodeVector.push_back(node);
     n++;
+    csrValid = false;
 
     // Append a new, empty inner list to the adjacency list.
-    DoublyLinkedList<int> emptyList;
-    adjacencyList.InsertBack(emptyList);
-}
-
-// Helper to convert a MIXED_TYPE to int (for node IDs)
-int variantToInt(const MIXED_TYPE &v) {
-    if (std::holds_alternative<int>(v))
-        return std::get<int>(v);
-    throw std::runtime_error("Variant does not hold an int.");
+    adjacencyList.push_back(std::vector<int>());
+    edgeSlot.push_back(std::vector<int>());
+    inDegree.push_back(0);
 }
 
 // RemoveNode: remove a node and all its incident edges
 void Graph::RemoveNode(int node) 
 {
-    // Find the node in nodeVector.
-    auto it = std::find(nodeVector.begin(), nodeVector.end(), node);
-    if (it == nodeVector.end())
+    // Find the node in nodeIndex.
+    int index = indexOf(node);
+    if (index == -1)
         throw std::invalid_argument("Node does not exist.");
-    int index = std::distance(nodeVector.begin(), it);
+
+    // Tombstone the edges in the node's own list. For undirected graphs these are all
+    // incident edges, and only the lists of the neighbors also refer to them.
+    for (int slot : edgeSlot[index])
+        if (!removedEdge[slot])
+            removeSlot(slot);
+    if (!isDirected) 
+    {
+        for (int v : adjacencyList[index])
+            if (v != node)
+                dropRemoved(indexOf(v));
+    } 
+    else if (inDegree[index] > 0) 
+    {
+        // In-edges of a directed graph can sit in any list.
+        for (int i = 0; i < n; i++) 
+        {
+            if (i == index)
+                continue;
+            bool found = false;
+            for (size_t j = 0; j < adjacencyList[i].size(); j++)
+                if (adjacencyList[i][j] == node) 
+                {
+                    removeSlot(edgeSlot[i][j]);
+                    found = true;
+                }
+            if (found)
+                dropRemoved(i);
+        }
+    }
     
     // Remove the corresponding inner list from adjacencyList.
-    adjacencyList.Delete(index);
+    adjacencyList.erase(adjacencyList.begin() + index);
+    edgeSlot.erase(edgeSlot.begin() + index);
+    inDegree.erase(inDegree.begin() + index);
     
-    // Erase the node from nodeVector.
-    nodeVector.erase(it);
+    // Erase the node from nodeVector and close the gap in the index.
+    nodeVector.erase(nodeVector.begin() + index);
+    nodeIndex.erase(node);
     n--;
-    
-    // Rebuild the edgelist (GeneralArray) without any edge that is incident to this node.
-    // We assume that edgelist supports push_back(), size(), and operator[].
-    GeneralArray<std::vector<MIXED_TYPE>> newEdgeList;
-    // (newEdgeList is initially empty.)
-    for (int i = 0; i < edgelist.Length(); i++) 
-    {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        // For a weighted graph, edge size should be 3; for unweighted, size 2.
-        // If either u or v equals the removed node, skip it.
-        if ((variantToInt(edge[0]) == node) || (variantToInt(edge[1]) == node))
-            continue;
-        newEdgeList.Push_back(edge);
-    }
+    compactIndex(index);
+    csrValid = false;
 
-    edgelist = newEdgeList;
-    e = edgelist.Length();
-    
-    // Also, remove the node from every inner list in adjacencyList.
-    for (auto outerIt = adjacencyList.begin(); outerIt != adjacencyList.end(); ++outerIt) 
-    {
-        // Since *outerIt is returned as const, cast away const.
-        DoublyLinkedList<int>& innerList = const_cast<DoublyLinkedList<int>&>(*outerIt);
-        // Remove all occurrences of 'node' in this inner list.
-        // We iterate by index; collect indices to remove then delete them in reverse order.
-        std::vector<int> indicesToRemove;
-        int pos = 0;
-
-        for (auto innerIt = innerList.begin(); innerIt != innerList.end(); ++innerIt, pos++) 
-            if (*innerIt == node)
-                indicesToRemove.push_back(pos);
-        
-        for (int i = indicesToRemove.size() - 1; i >= 0; i--) 
-            innerList.Delete(indicesToRemove[i]);
-    }
+    if (removedEdges > e)
+        compactEdges();
 }
 
 // AddEdge: add an edge from u to v with weight w (w forced to 1 if unweighted)
 void Graph::AddEdge(int u, int v, double w) 
 {
     // Verify both nodes exist.
-    auto it_u = std::find(nodeVector.begin(), nodeVector.end(), u);
-    auto it_v = std::find(nodeVector.begin(), nodeVector.end(), v);
+    int index_u = indexOf(u);
+    int index_v = indexOf(v);
 
-    if (it_u == nodeVector.end() || it_v == nodeVector.end())
+    if (index_u == -1 || index_v == -1)
         throw std::invalid_argument("One or both nodes do not exist.");
     
     // For unweighted graphs, force w to 1.
     if (!isWeighted)
         w = 1;
     
-    // Build the edge vector.
-    std::vector<MIXED_TYPE> edgeVec;
-    edgeVec.push_back(u);
-    edgeVec.push_back(v);
-    if (isWeighted)
-        edgeVec.push_back(w);
-    
     // Append the edge to edgelist.
-    edgelist.Push_back(edgeVec);
+    int slot = edgelist.Length();
+    edgelist.Push(u, v, w);
+    removedEdge.push_back(0);
+    csrValid = false;
     
     // Update the adjacency list:
     // For node u, add v.
-    int index_u = std::distance(nodeVector.begin(), it_u);
-    auto outerIt = adjacencyList.begin();
-    for (int i = 0; i < index_u; ++i)
-        ++outerIt;
-    // Insert v into the inner list. (Cast away const if needed.)
-    const_cast<DoublyLinkedList<int>&>(*outerIt).InsertBack(v);
+    adjacencyList[index_u].push_back(v);
+    edgeSlot[index_u].push_back(slot);
     
     // For undirected graphs, also add u to v's inner list.
     if (!isDirected) 
     {
-        int index_v = std::distance(nodeVector.begin(), it_v);
-        auto outerIt2 = adjacencyList.begin();
-        for (int i = 0; i < index_v; ++i)
-            ++outerIt2;
-        const_cast<DoublyLinkedList<int>&>(*outerIt2).InsertBack(u);
+        adjacencyList[index_v].push_back(u);
+        edgeSlot[index_v].push_back(slot);
     }
+    else
+        inDegree[index_v]++;
     
     e++;
 }
@@ -210,77 +322,98 @@ void Graph::AddEdge(int u, int v, double w)
 void Graph::RemoveEdge(int u, int v) 
 {
     // Verify that both nodes exist.
-    auto it_u = std::find(nodeVector.begin(), nodeVector.end(), u);
-    auto it_v = std::find(nodeVector.begin(), nodeVector.end(), v);
-    if (it_u == nodeVector.end() || it_v == nodeVector.end())
+    int index_u = indexOf(u);
+    int index_v = indexOf(v);
+    if (index_u == -1 || index_v == -1)
         throw std::invalid_argument("One or both nodes do not exist.");
     
-    // Rebuild the edgelist without the edge (u,v) (and for undirected graphs, (v,u)).
-    GeneralArray<std::vector<MIXED_TYPE>> newEdgeList;
-    for (int i = 0; i < edgelist.Length(); i++) 
+    // Find v in u's neighbor list; an undirected edge is listed on both sides.
+    const std::vector<int>& listU = adjacencyList[index_u];
+    auto itV = std::find(listU.begin(), listU.end(), v);
+    if (itV == listU.end())
+        return;
+
+    // Tombstone the edge instead of rebuilding the edgelist, then unlink it.
+    removeSlot(edgeSlot[index_u][itV - listU.begin()]);
+    dropRemoved(index_u);
+    if (!isDirected && index_v != index_u)
+        dropRemoved(index_v);
+
+    if (removedEdges > e)
+        compactEdges();
+}
+
+// Batched updates: one scan per touched adjacency list, one CSR rebuild per batch.
+void Graph::ApplyUpdates(const EdgeArray& inserts, const EdgeArray& deletes) 
+{
+    size_t numInserts = inserts.source.size();
+    size_t numDeletes = deletes.source.size();
+    if (inserts.target.size() != numInserts || deletes.target.size() != numDeletes ||
+        (!inserts.weight.empty() && inserts.weight.size() != numInserts))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+
+    // Validate the whole batch first, so a bad edge leaves the graph untouched.
+    for (size_t i = 0; i < numInserts; i++)
+        if (indexOf(inserts.source[i]) == -1 || indexOf(inserts.target[i]) == -1)
+            throw std::invalid_argument("One or both nodes do not exist.");
+    for (size_t i = 0; i < numDeletes; i++)
+        if (indexOf(deletes.source[i]) == -1 || indexOf(deletes.target[i]) == -1)
+            throw std::invalid_argument("One or both nodes do not exist.");
+
+    // Deletions: count the pending (u, v) pairs, then walk each source list once.
+    if (numDeletes > 0) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        bool removeEdge = false;
-        if (isWeighted) 
+        auto key = [](int u, int v) 
         {
-            // For weighted graphs, edge vector: {u, v, weight}
-            if ((variantToInt(edge[0]) == u && variantToInt(edge[1]) == v) ||
-                (!isDirected && variantToInt(edge[0]) == v && variantToInt(edge[1]) == u))
-                removeEdge = true;
-        } 
-        else 
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(u)) << 32) | static_cast<std::uint32_t>(v);
+        };
+        std::unordered_map<std::uint64_t, int> pending;
+        pending.reserve(numDeletes);
+        std::vector<int> lists;
+        lists.reserve(numDeletes);
+        for (size_t i = 0; i < numDeletes; i++) 
         {
-            // For unweighted graphs, edge vector: {u, v}
-            if ((variantToInt(edge[0]) == u && variantToInt(edge[1]) == v) ||
-                (!isDirected && variantToInt(edge[0]) == v && variantToInt(edge[1]) == u))
-                removeEdge = true;
-        }
-        if (!removeEdge)
-            newEdgeList.Push_back(edge);
-    }
-    edgelist = newEdgeList;
-    e = edgelist.Length();
-    
-    // Update the adjacency list:
-    // Remove v from u's neighbor list.
-    int index_u = std::distance(nodeVector.begin(), it_u);
-    auto outerIt = adjacencyList.begin();
-    for (int i = 0; i < index_u; ++i)
-        ++outerIt;
-    {
-        DoublyLinkedList<int>& innerList = const_cast<DoublyLinkedList<int>&>(*outerIt);
-        int pos = 0;
-
-        for (auto innerIt = innerList.begin(); innerIt != innerList.end(); ++innerIt, pos++) {
-            if (*innerIt == v) 
-            {
-                innerList.Delete(pos);
-                break;
-            }
+            pending[key(deletes.source[i], deletes.target[i])]++;
+            lists.push_back(indexOf(deletes.source[i]));
         }
-    }
-    
-    // For undirected graphs, remove u from v's neighbor list.
-    if (!isDirected) 
-    {
-        int index_v = std::distance(nodeVector.begin(), it_v);
-        auto outerIt2 = adjacencyList.begin();
+        std::sort(lists.begin(), lists.end());
+        lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
 
-        for (int i = 0; i < index_v; ++i)
-            ++outerIt2;
+        std::vector<int> touched;
+        for (int p : lists) 
         {
-            DoublyLinkedList<int>& innerList = const_cast<DoublyLinkedList<int>&>(*outerIt2);
-            int pos = 0;
-            for (auto innerIt = innerList.begin(); innerIt != innerList.end(); ++innerIt, pos++) 
+            for (size_t j = 0; j < adjacencyList[p].size(); j++) 
             {
-                if (*innerIt == u) 
-                {
-                    innerList.Delete(pos);
-                    break;
-                }
+                int v = adjacencyList[p][j];
+                int slot = edgeSlot[p][j];
+                auto it = pending.find(key(nodeVector[p], v));
+                if (it == pending.end() || it->second == 0 || removedEdge[slot])
+                    continue;
+                it->second--;
+                removeSlot(slot);
+                touched.push_back(p);
+                if (!isDirected)
+                    touched.push_back(indexOf(v));
             }
         }
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        for (int p : touched)
+            dropRemoved(p);
     }
+
+    // Insertions append to the edge list and the adjacency lists in amortized O(1) each.
+    for (size_t i = 0; i < numInserts; i++)
+        AddEdge(inserts.source[i], inserts.target[i], inserts.weight.empty() ? 1.0 : inserts.weight[i]);
+
+    csrValid = false;
+    if (removedEdges > e)
+        compactEdges();
+}
+
+void Graph::Compact() 
+{
+    compactEdges();
 }
 
 // ================================
@@ -295,23 +428,14 @@ bool Graph::IsEmpty() const
 
 int Graph::Degree(int u) const 
 {
-    if (u < 0 || u >= n) 
+    int index = indexOf(u);
+    if (index == -1) 
     {
         throw std::out_of_range("Invalid node identifier.");
     }
     
     // Obtain the out-degree from the adjacency list.
-    auto outer = adjacencyList.begin();
-    // Advance to the u-th inner list.
-    for (int i = 0; i < u; ++i) 
-    {
-        ++outer;
-    }
-    if (outer == adjacencyList.end()) 
-    {
-        throw std::runtime_error("Adjacency list index error.");
-    }
-    int outDegree = outer->Length();
+    int outDegree = adjacencyList[index].size();
 
     // For undirected graphs, degree is simply outDegree.
     if (!isDirected) 
@@ -319,50 +443,28 @@ int Graph::Degree(int u) const
         return outDegree;
     }
     
-    // For directed graphs, add the in-degree: count the number of lists where u appears.
-    int inDegree = 0;
-    for (auto it = adjacencyList.begin(); it != adjacencyList.end(); ++it)
-        for (auto inner = it->begin(); inner != it->end(); ++inner)
-            if (*inner == u) 
-                inDegree++;
-
-    return outDegree + inDegree;
+    // For directed graphs, add the in-degree, which is kept up to date by every modification.
+    return outDegree + inDegree[index];
 }
 
 bool Graph::ExistsEdge(int u, int v) const 
 {
-    if (u < 0 || u >= n || v < 0 || v >= n)
+    int index_u = indexOf(u);
+    int index_v = indexOf(v);
+    if (index_u == -1 || index_v == -1)
         throw std::out_of_range("Invalid node identifier.");
     
     // Check the neighbor list for node u.
-    auto outer = adjacencyList.begin();
-    for (int i = 0; i < u; ++i) 
-        ++outer;
-    
-    if (outer == adjacencyList.end())
-        throw std::runtime_error("Adjacency list index error.");
-    
-    for (auto inner = outer->begin(); inner != outer->end(); ++inner)
-        if (*inner == v)
-            return true;
+    const std::vector<int>& listU = adjacencyList[index_u];
+    if (std::find(listU.begin(), listU.end(), v) != listU.end())
+        return true;
     
     // For undirected graphs, also check the neighbor list for node v.
     if (!isDirected) 
     {
-        outer = adjacencyList.begin();
-        for (int i = 0; i < v; ++i) 
-        {
-            ++outer;
-        }
-        if (outer == adjacencyList.end()) 
-        {
-            throw std::runtime_error("Adjacency list index error.");
-        }
-        for (auto inner = outer->begin(); inner != outer->end(); ++inner) 
-        {
-            if (*inner == u)
-                return true;
-        }
+        const std::vector<int>& listV = adjacencyList[index_v];
+        if (std::find(listV.begin(), listV.end(), u) != listV.end())
+            return true;
     }
     
     return false;
@@ -381,6 +483,191 @@ int Graph::NumberOfEdges() const
     return e;
 }
 
+std::vector<int> Graph::Nodes() const 
+{
+    return nodeVector;
+}
+
+bool Graph::ExistsNode(int node) const 
+{
+    return nodeIndex.count(node) != 0;
+}
+
+int Graph::IndexOf(int node) const 
+{
+    int index = indexOf(node);
+    if (index == -1)
+        throw std::invalid_argument("Node does not exist.");
+    return index;
+}
+
+// Position of a node identifier in nodeVector, or -1 if it does not exist.
+int Graph::indexOf(int node) const 
+{
+    auto it = nodeIndex.find(node);
+    if (it == nodeIndex.end())
+        return -1;
+    return it->second;
+}
+
+// Compaction step: after nodeVector changed from position 'from' on,
+// renumber those nodes so that nodeIndex stays dense and consistent.
+void Graph::compactIndex(int from) 
+{
+    if (from == 0)
+        nodeIndex.reserve(nodeVector.size());
+    for (int i = from; i < static_cast<int>(nodeVector.size()); i++)
+        nodeIndex[nodeVector[i]] = i;
+}
+
+// Tombstone one edge. Its adjacency entries are erased later by dropRemoved().
+void Graph::removeSlot(int slot) 
+{
+    removedEdge[slot] = 1;
+    removedEdges++;
+    e--;
+    csrValid = false;
+    if (isDirected)
+        inDegree[nodeIndex.at(edgelist.Target(slot))]--;
+}
+
+// Erase the entries of tombstoned edges from one adjacency list, keeping the order of the rest.
+void Graph::dropRemoved(int index) 
+{
+    std::vector<int>& list = adjacencyList[index];
+    std::vector<int>& slots = edgeSlot[index];
+    size_t kept = 0;
+    for (size_t j = 0; j < list.size(); j++) 
+    {
+        if (removedEdge[slots[j]])
+            continue;
+        list[kept] = list[j];
+        slots[kept] = slots[j];
+        kept++;
+    }
+    list.resize(kept);
+    slots.resize(kept);
+}
+
+// Compaction step for the edgelist: keep the live edges in order and renumber the slots.
+void Graph::compactEdges() 
+{
+    if (removedEdges == 0)
+        return;
+
+    std::vector<int> newSlot = edgelist.Compact(removedEdge);
+
+    for (std::vector<int>& slots : edgeSlot)
+        for (int& slot : slots)
+            slot = newSlot[slot];
+    removedEdge.assign(e, 0);
+    removedEdges = 0;
+}
+
+// ================================
+// Compressed Representation
+// ================================
+
+void Graph::Freeze() 
+{
+    Compressed();
+}
+
+bool Graph::IsFrozen() const 
+{
+    return csrValid;
+}
+
+// Build the CSR from edgelist on demand. Node identifiers are translated to
+// positions once here, so the algorithms never look them up.
+const CSRGraph& Graph::Compressed() const 
+{
+    if (csrValid)
+        return csr;
+
+    std::vector<int> src, dst;
+    std::vector<double> w;
+    src.reserve(e);
+    dst.reserve(e);
+    w.reserve(e);
+    for (int i = 0; i < edgelist.Length(); i++) 
+    {
+        if (removedEdge[i])
+            continue;
+        src.push_back(nodeIndex.at(edgelist.Source(i)));
+        dst.push_back(nodeIndex.at(edgelist.Target(i)));
+        w.push_back(edgelist.Weight(i));
+    }
+
+    csr = CSRGraph(n, src, dst, w, isDirected);
+    csrValid = true;
+    return csr;
+}
+
+void Graph::Reorder(OrderingStrategy strategy) 
+{
+    std::vector<int> order = GraphOrdering::Order(Compressed(), strategy);
+    std::vector<int> nodes(n);
+    for (int k = 0; k < n; k++)
+        nodes[k] = nodeVector[order[k]];
+    Reorder(nodes);
+}
+
+// Move the per-position state of every node to its new position. Adjacency lists
+// and the edge list hold node identifiers, so only the lists themselves move.
+void Graph::Reorder(const std::vector<int>& nodes) 
+{
+    if (static_cast<int>(nodes.size()) != n)
+        throw std::invalid_argument("Reorder needs every node exactly once.");
+    std::vector<int> order(n);
+    std::vector<char> taken(n, 0);
+    for (int k = 0; k < n; k++)
+    {
+        int index = indexOf(nodes[k]);
+        if (index == -1 || taken[index])
+            throw std::invalid_argument("Reorder needs every node exactly once.");
+        taken[index] = 1;
+        order[k] = index;
+    }
+
+    std::vector<std::vector<int>> lists(n), slots(n);
+    std::vector<int> degrees(n);
+    for (int k = 0; k < n; k++)
+    {
+        lists[k] = std::move(adjacencyList[order[k]]);
+        slots[k] = std::move(edgeSlot[order[k]]);
+        degrees[k] = inDegree[order[k]];
+    }
+    adjacencyList = std::move(lists);
+    edgeSlot = std::move(slots);
+    inDegree = std::move(degrees);
+    nodeVector = nodes;
+    compactIndex(0);
+    csrValid = false;
+}
+
+
+// ===================================
+// Snapshots
+// ===================================
+
+void Graph::Save(const std::string& path) const 
+{
+    GraphView::Write(path, nodeVector, Compressed(), isWeighted);
+}
+
+Graph Graph::Load(const std::string& path) 
+{
+    GraphView view(path);
+    EdgeArray edges = view.Edges();
+    if (edges.source.size() > static_cast<size_t>(std::numeric_limits<int>::max()))
+        throw std::length_error("Too many edges.");
+    std::vector<int> nodes(view.NodeIds(), view.NodeIds() + view.NumberOfNodes());
+    Graph g(nodes, view.IsWeighted(), view.IsDirected());
+    g.bulkLoad(edges.source, edges.target, std::move(edges.weight));
+    return g;
+}
+
 // =====================================
 // Spanning Tree and Component Methods
 // =====================================
@@ -390,8 +677,12 @@ int Graph::NumberOfEdges() const
 // using BFS. Each new edge is added with weight 1.
 Graph Graph::SpanningTree() const 
 {
-    // Create an empty graph with the same number of nodes and type.
-    Graph tree(n, isWeighted, isDirected);
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
+    // Create an empty graph with the same nodes and type.
+    Graph tree(nodeVector, isWeighted, isDirected);
     // Initially, tree has the same nodes but no edges.
     std::vector<bool> visited(n, false);
     std::queue<int> q;
@@ -408,21 +699,16 @@ Graph Graph::SpanningTree() const
                 int u = q.front();
                 q.pop();
 
-                // Get u's neighbor list from adjacencyList.
-                auto it = adjacencyList.begin();
-                for (int i = 0; i < u; ++i)
-                    ++it;
-
                 // For every neighbor v of u...
-                for (auto nbrIt = it->begin(); nbrIt != it->end(); ++nbrIt) 
+                for (int i = offset[u]; i < offset[u + 1]; ++i) 
                 {
-                    int v = *nbrIt;
+                    int v = target[i];
                     if (!visited[v]) 
                     {
                         visited[v] = true;
                         q.push(v);
                         // In the spanning tree, add edge (u,v) with weight 1.
-                        tree.AddEdge(u, v, 1);
+                        tree.AddEdge(nodeVector[u], nodeVector[v], 1);
                     }
                 }
             }
@@ -435,130 +721,150 @@ Graph Graph::SpanningTree() const
 // Returns a vector of components; each component is represented as a vector of node IDs.
 std::vector<std::vector<int>> Graph::Components() const 
 {
-    std::vector<bool> visited(n, false);
+    // Every position is labelled with the smallest position of its component, so
+    // grouping in position order lists the components by their first node.
+    std::vector<int> label = GraphAnalytics::ConnectedComponents(Compressed());
+    std::vector<int> slot(n, -1);
     std::vector<std::vector<int>> components;
-    std::queue<int> q;
-    
-    for (int start = 0; start < n; ++start) 
+    for (int v = 0; v < n; v++) 
     {
-        if (!visited[start]) 
+        if (slot[label[v]] == -1) 
         {
-            std::vector<int> comp;
-            q.push(start);
-            visited[start] = true;
-
-            while (!q.empty()) 
-            {
-                int u = q.front();
-                q.pop();
-                comp.push_back(u);
-                // Get u's neighbors.
-                auto it = adjacencyList.begin();
-                for (int i = 0; i < u; ++i)
-                    ++it;
-
-                for (auto nbrIt = it->begin(); nbrIt != it->end(); ++nbrIt) 
-                {
-                    int v = *nbrIt;
-                    if (!visited[v]) 
-                    {
-                        visited[v] = true;
-                        q.push(v);
-                    }
-                }
-            }
-            components.push_back(comp);
+            slot[label[v]] = static_cast<int>(components.size());
+            components.push_back({});
         }
+        components[slot[label[v]]].push_back(nodeVector[v]);
     }
     return components;
 }
 
+// ---------- Partitioning ----------
+PartitionResult Graph::Partition(int parts, double imbalance) const 
+{
+    return GraphPartitioner::Partition(Compressed(), parts, imbalance);
+}
+
 // ---------- Biconnected Components ----------
-// Helper function for DFS to compute biconnected components.
-void Graph::BCCUtil(int u, std::vector<int>& disc, std::vector<int>& low,
-                    std::vector<int>& parent, int& time,
-                    std::stack<std::pair<int,int>>& st,
-                    std::vector<std::vector<int>>& bcc) const 
+// Iterative Hopcroft–Tarjan. dfs is the explicit call stack; next[u] is the next arc
+// of u to scan. Vertices stay on the vertex stack until the component closed by
+// their subtree is popped. Vertices are positions; the result is translated to IDs.
+BiconnectedResult Graph::BiconnectedDecomposition() const 
 {
-    disc[u] = low[u] = ++time;
-    int children = 0;
+    if (isDirected)
+        throw std::runtime_error("Biconnected components are defined only for undirected graphs.");
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
 
-    auto it = adjacencyList.begin();    // Retrieve u's neighbor list.
-    for (int i = 0; i < u; ++i)
-        ++it;
+    std::vector<int> disc(n, -1), low(n, 0), parent(n, -1), next(n, 0);
+    std::vector<char> skippedParent(n, 0);     // The tree edge back to the parent was skipped once.
+    std::vector<char> articulation(n, 0);
+    std::vector<int> dfs, vertices;
+    std::vector<std::vector<int>> components;
+    std::vector<std::pair<int, int>> bridges;
+    int time = 0;
 
-    for (auto nbrIt = it->begin(); nbrIt != it->end(); ++nbrIt) 
+    for (int root = 0; root < n; root++) 
     {
-        int v = *nbrIt;
-        if (disc[v] == -1)  // v not visited. 
-        {  
-            children++;
-            parent[v] = u;
-            st.push({u, v});
-            BCCUtil(v, disc, low, parent, time, st, bcc);
-            low[u] = std::min(low[u], low[v]);
+        if (disc[root] != -1)
+            continue;
+        disc[root] = low[root] = time++;
+        next[root] = offset[root];
+        dfs.push_back(root);
+        vertices.push_back(root);
+        int rootChildren = 0;
 
-            // If u is an articulation point, pop all edges till (u,v)
-            if ((parent[u] == -1 && children > 1) || (parent[u] != -1 && low[v] >= disc[u])) 
+        while (!dfs.empty()) 
+        {
+            int u = dfs.back();
+            if (next[u] < offset[u + 1]) 
             {
-                std::set<int> compSet;
-                while (!st.empty() && st.top() != std::make_pair(u, v)) 
+                int v = target[next[u]++];
+                if (v == u)
+                    continue;
+                // Skip the tree edge to the parent once; a parallel copy counts as a back edge.
+                if (v == parent[u] && !skippedParent[u]) 
                 {
-                    auto edge = st.top();
-                    st.pop();
-                    compSet.insert(edge.first);
-                    compSet.insert(edge.second);
+                    skippedParent[u] = 1;
+                    continue;
                 }
-                if (!st.empty()) 
-                { 
-                    auto edge = st.top();   // pop the (u,v) edge too.
-                    st.pop();
-                    compSet.insert(edge.first);
-                    compSet.insert(edge.second);
+                if (disc[v] == -1) 
+                {
+                    parent[v] = u;
+                    disc[v] = low[v] = time++;
+                    next[v] = offset[v];
+                    dfs.push_back(v);
+                    vertices.push_back(v);
                 }
-                std::vector<int> component(compSet.begin(), compSet.end());
-                bcc.push_back(component);
+                else
+                    low[u] = std::min(low[u], disc[v]);
+                continue;
+            }
+
+            // u is finished: report to its parent.
+            dfs.pop_back();
+            int p = parent[u];
+            if (p == -1)
+                break;
+            low[p] = std::min(low[p], low[u]);
+            if (low[u] > disc[p])
+                bridges.push_back({p, u});
+            if (low[u] >= disc[p]) 
+            {
+                // p separates the subtree of u: that subtree and p form a component.
+                std::vector<int> component;
+                int w;
+                do 
+                {
+                    w = vertices.back();
+                    vertices.pop_back();
+                    component.push_back(w);
+                } while (w != u);
+                component.push_back(p);
+                components.push_back(std::move(component));
+
+                if (p != root)
+                    articulation[p] = 1;
+                else
+                    rootChildren++;
             }
-        } 
-        else if (v != parent[u] && disc[v] < disc[u]) 
-        {
-            low[u] = std::min(low[u], disc[v]);
-            st.push({u, v});
         }
+        if (rootChildren > 1)
+            articulation[root] = 1;
+        vertices.clear();
+    }
+
+    // Translate positions back to node identifiers.
+    BiconnectedResult result;
+    for (auto& component : components) 
+    {
+        std::sort(component.begin(), component.end());
+        for (int& node : component)
+            node = nodeVector[node];
     }
+    result.components = std::move(components);
+    for (int v = 0; v < n; v++)
+        if (articulation[v])
+            result.articulationPoints.push_back(nodeVector[v]);
+    for (const auto& [p, u] : bridges)
+        result.bridges.push_back({nodeVector[p], nodeVector[u]});
+    return result;
 }
 
 std::vector<std::vector<int>> Graph::Biconnected() const 
 {
-    if (isDirected)
-        throw std::runtime_error("Biconnected components are defined only for undirected graphs.");
-    
-    std::vector<int> disc(n, -1);
-    std::vector<int> low(n, -1);
-    std::vector<int> parent(n, -1);
-    int time = 0;
-    std::stack<std::pair<int,int>> st;
-    std::vector<std::vector<int>> bcc;
-    
-    for (int i = 0; i < n; i++) 
-    {
-        if (disc[i] == -1)
-            BCCUtil(i, disc, low, parent, time, st, bcc);
-        if (!st.empty()) 
-        {
-            std::set<int> compSet;
-            while (!st.empty()) 
-            {
-                auto edge = st.top();
-                st.pop();
-                compSet.insert(edge.first);
-                compSet.insert(edge.second);
-            }
-            std::vector<int> component(compSet.begin(), compSet.end());
-            bcc.push_back(component);
-        }
-    }
-    return bcc;
+    return BiconnectedDecomposition().components;
+}
+
+std::vector<int> Graph::ArticulationPoints() const 
+{
+    return BiconnectedDecomposition().articulationPoints;
+}
+
+std::vector<std::pair<int, int>> Graph::Bridges() const 
+{
+    return BiconnectedDecomposition().bridges;
 }
 
 
@@ -569,9 +875,19 @@ std::vector<std::vector<int>> Graph::Biconnected() const
 // Breadth-First Search (BFS)
 std::vector<int> Graph::BFS(int start, int destination) const 
 {
-    if (start < 0 || start >= n)
+    int s = indexOf(start);
+    if (s == -1)
         throw std::out_of_range("Invalid start node identifier.");
 
+    // An unknown destination can never be reached.
+    int t = (destination == -1) ? -1 : indexOf(destination);
+    if (destination != -1 && t == -1)
+        return std::vector<int>();
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
     // Initialize visited vector and parent tracker.
     std::vector<bool> visited(n, false);
     std::vector<int> parent(n, -1);
@@ -579,33 +895,26 @@ std::vector<int> Graph::BFS(int start, int destination) const
     std::vector<int> order;
     bool found = false;
 
-    q.push(start);
-    visited[start] = true;
+    q.push(s);
+    visited[s] = true;
 
     while (!q.empty()) 
     {
         int u = q.front();
         q.pop();
-        order.push_back(u);
+        order.push_back(nodeVector[u]);
 
         // If destination is reached, we can stop.
-        if (u == destination) 
+        if (u == t) 
         {
             found = true;
             break;
         }
 
-        // Retrieve u's neighbor list from the adjacency list.
-        auto outer = adjacencyList.begin();
-        for (int i = 0; i < u; ++i)
-            ++outer;
-        if (outer == adjacencyList.end())
-            throw std::runtime_error("Adjacency list index error.");
-
         // Enqueue each unvisited neighbor.
-        for (auto nbr = outer->begin(); nbr != outer->end(); ++nbr) 
+        for (int i = offset[u]; i < offset[u + 1]; ++i) 
         {
-            int v = *nbr;
+            int v = target[i];
             if (!visited[v]) 
             {
                 visited[v] = true;
@@ -621,8 +930,8 @@ std::vector<int> Graph::BFS(int start, int destination) const
         if (!found)
             return std::vector<int>();  // No path found.
         std::vector<int> path;
-        for (int cur = destination; cur != -1; cur = parent[cur])
-            path.push_back(cur);
+        for (int cur = t; cur != -1; cur = parent[cur])
+            path.push_back(nodeVector[cur]);
         std::reverse(path.begin(), path.end());
         return path;
     }
@@ -633,54 +942,51 @@ std::vector<int> Graph::BFS(int start, int destination) const
 // Depth-First Search (DFS)
 std::vector<int> Graph::DFS(int start, int destination) const 
 {
-    if (start < 0 || start >= n)
+    int s = indexOf(start);
+    if (s == -1)
         throw std::out_of_range("Invalid start node identifier.");
 
+    int t = (destination == -1) ? -1 : indexOf(destination);
+    if (destination != -1 && t == -1)
+        return std::vector<int>();
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
     std::vector<bool> visited(n, false);
     std::vector<int> parent(n, -1);
-    std::stack<int> s;
+    std::stack<int> st;
     std::vector<int> order;
     bool found = false;
 
-    s.push(start);
-    while (!s.empty()) 
+    st.push(s);
+    while (!st.empty()) 
     {
-        int u = s.top();
-        s.pop();
+        int u = st.top();
+        st.pop();
         if (!visited[u]) 
         {
             visited[u] = true;
-            order.push_back(u);
-            if (u == destination) 
+            order.push_back(nodeVector[u]);
+            if (u == t) 
             {
                 found = true;
                 break;
             }
-            // Retrieve u's neighbor list.
-            auto outer = adjacencyList.begin();
-            for (int i = 0; i < u; ++i)
-                ++outer;
-            if (outer == adjacencyList.end())
-                throw std::runtime_error("Adjacency list index error.");
-
-            // To simulate recursive DFS order, we collect neighbors
-            // and push them in reverse order.
-            std::vector<int> neighbors;
-            for (auto nbr = outer->begin(); nbr != outer->end(); ++nbr) 
+
+            // To simulate recursive DFS order, push the unvisited neighbors
+            // in reverse so that the left-most neighbor is processed first.
+            for (int i = offset[u + 1] - 1; i >= offset[u]; --i) 
             {
-                int v = *nbr;
+                int v = target[i];
                 if (!visited[v]) 
                 {
                     if (parent[v] == -1)  // Record parent if not set.
                         parent[v] = u;
-                    neighbors.push_back(v);
+                    st.push(v);
                 }
             }
-            // Push in reverse so that the left-most neighbor is processed first.
-            for (int i = static_cast<int>(neighbors.size()) - 1; i >= 0; --i)
-            {
-                s.push(neighbors[i]);
-            }
         }
     }
 
@@ -689,18 +995,197 @@ std::vector<int> Graph::DFS(int start, int destination) const
         if (!found)
             return std::vector<int>();  // No path found.
         std::vector<int> path;
-        for (int cur = destination; cur != -1; cur = parent[cur])
-            path.push_back(cur);
+        for (int cur = t; cur != -1; cur = parent[cur])
+            path.push_back(nodeVector[cur]);
         std::reverse(path.begin(), path.end());
         return path;
     }
     return order;
 }
 
-// BFSIterator and DFSIterator
-std::vector<int> Graph::BFSIterator(int start) const 
+// Parallel direction-optimizing BFS.
+// The frontier is the last level of result.order. A top-down step claims each
+// newly reached vertex with a compare-and-swap on its parent and keeps it in the
+// buffer of its block; the buffers are joined behind the frontier with a prefix
+// sum. Only a bottom-up step marks the frontier in a bitmap and lets every
+// unvisited vertex scan its in-arcs for a frontier vertex, stopping at the first
+// hit, so graphs that stay top-down (long paths, grids) cost O(V + E).
+BFSResult Graph::ParallelBFS(int source) const 
 {
-    // If no destination is provided, BFS returns the traversal order.
+    int s = indexOf(source);
+    if (s == -1)
+        throw std::out_of_range("Invalid start node identifier.");
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<int>& inOffset = g.InOffsets();
+    const std::vector<int>& sources = g.Sources();
+
+    BFSResult result;
+    result.source = s;
+    result.distance.assign(n, -1);
+    result.order.reserve(n);
+    result.distance[s] = 0;
+    result.order.push_back(s);
+
+    // Small inputs: threads would cost more than they save.
+    if (n + static_cast<long long>(target.size()) < PARALLEL_BFS_CUTOFF || Parallel::ThreadCount() == 1) 
+    {
+        result.parent.assign(n, -1);
+        for (size_t head = 0; head < result.order.size(); head++) 
+        {
+            int u = result.order[head];
+            for (int j = offset[u]; j < offset[u + 1]; j++) 
+            {
+                int v = target[j];
+                if (result.distance[v] == -1) 
+                {
+                    result.distance[v] = result.distance[u] + 1;
+                    result.parent[v] = u;
+                    result.order.push_back(v);
+                }
+            }
+        }
+        return result;
+    }
+
+    // Direction switching thresholds from Beamer, Asanovic and Patterson (SC'12).
+    const long long alpha = 14, beta = 24;
+    const size_t words = (static_cast<size_t>(n) + 63) / 64;
+    const int threads = Parallel::ThreadCount();
+
+    std::unique_ptr<std::atomic<int>[]> parent(new std::atomic<int>[n]);
+    std::unique_ptr<std::atomic<std::uint64_t>[]> current(new std::atomic<std::uint64_t>[words]);
+    Parallel::For(0, n, [&](size_t v) { parent[v].store(-1, std::memory_order_relaxed); });
+    parent[s].store(s, std::memory_order_relaxed);  // The source is its own parent until the end.
+
+    // Vertices reached by every block of a step, and their out-arcs.
+    std::vector<std::vector<int>> reached(threads);
+    std::vector<long long> arcs(threads, 0);
+    std::vector<size_t> start(threads + 1, 0);
+
+    size_t lo = 0;          // The frontier is result.order[lo, end).
+    size_t previous = 0;    // Size of the previous frontier.
+    long long frontierArcs = offset[s + 1] - offset[s];     // Out-arcs of the frontier.
+    long long unexploredArcs = static_cast<long long>(target.size()) - frontierArcs;
+    bool bottomUp = false;
+
+    for (int level = 0; lo < result.order.size(); level++) 
+    {
+        size_t hi = result.order.size();
+        size_t size = hi - lo;
+
+        // Go bottom-up while the frontier grows and holds many of the remaining
+        // arcs, and back top-down once it shrinks and is small again.
+        if (!bottomUp && frontierArcs * alpha > unexploredArcs && size > previous)
+            bottomUp = true;
+        else if (bottomUp && static_cast<long long>(size) * beta < n && size < previous)
+            bottomUp = false;
+        previous = size;
+
+        int blocks;
+        if (bottomUp) 
+        {
+            // The frontier as a bitmap.
+            Parallel::For(0, words, [&](size_t w) { current[w].store(0, std::memory_order_relaxed); });
+            Parallel::For(lo, hi, [&](size_t i) 
+            {
+                int u = result.order[i];
+                current[u >> 6].fetch_or(std::uint64_t(1) << (u & 63), std::memory_order_relaxed);
+            });
+
+            blocks = Parallel::ForBlocks(0, n, [&](size_t first, size_t last, int b) 
+            {
+                std::vector<int>& mine = reached[b];
+                long long a = 0;
+                for (size_t v = first; v < last; v++) 
+                {
+                    if (parent[v].load(std::memory_order_relaxed) != -1)
+                        continue;
+                    for (int i = inOffset[v]; i < inOffset[v + 1]; i++) 
+                    {
+                        int u = sources[i];
+                        if (current[u >> 6].load(std::memory_order_relaxed) >> (u & 63) & 1) 
+                        {
+                            parent[v].store(u, std::memory_order_relaxed);
+                            result.distance[v] = level + 1;
+                            mine.push_back(static_cast<int>(v));
+                            a += offset[v + 1] - offset[v];
+                            break;
+                        }
+                    }
+                }
+                arcs[b] = a;
+            }, 1024);
+        } 
+        else 
+        {
+            blocks = Parallel::ForBlocks(lo, hi, [&](size_t first, size_t last, int b) 
+            {
+                std::vector<int>& mine = reached[b];
+                long long a = 0;
+                for (size_t i = first; i < last; i++) 
+                {
+                    int u = result.order[i];
+                    for (int j = offset[u]; j < offset[u + 1]; j++) 
+                    {
+                        int v = target[j];
+                        int expected = -1;
+                        if (parent[v].load(std::memory_order_relaxed) == -1 &&
+                            parent[v].compare_exchange_strong(expected, u, std::memory_order_relaxed)) 
+                        {
+                            result.distance[v] = level + 1;
+                            mine.push_back(v);
+                            a += offset[v + 1] - offset[v];
+                        }
+                    }
+                }
+                arcs[b] = a;
+            }, 64);
+        }
+
+        // Append the blocks' vertices behind the frontier: prefix sum, then copy.
+        frontierArcs = 0;
+        for (int b = 0; b < blocks; b++) 
+        {
+            start[b + 1] = start[b] + reached[b].size();
+            frontierArcs += arcs[b];
+        }
+        result.order.resize(hi + start[blocks]);
+        Parallel::For(0, blocks, [&](size_t b) 
+        {
+            std::copy(reached[b].begin(), reached[b].end(), result.order.begin() + hi + start[b]);
+            reached[b].clear();
+        }, 1);
+        unexploredArcs -= frontierArcs;
+        lo = hi;
+    }
+
+    result.parent.resize(n);
+    Parallel::For(0, n, [&](size_t v) { result.parent[v] = parent[v].load(std::memory_order_relaxed); });
+    result.parent[s] = -1;
+    return result;
+}
+
+MultiSourceBFSResult Graph::MultiSourceBFS(const std::vector<int>& sources, bool keepDistances) const 
+{
+    std::vector<int> positions;
+    positions.reserve(sources.size());
+    for (int node : sources) 
+    {
+        int s = indexOf(node);
+        if (s == -1)
+            throw std::out_of_range("Invalid start node identifier.");
+        positions.push_back(s);
+    }
+    return GraphAnalytics::MultiSourceBFS(Compressed(), positions, keepDistances);
+}
+
+// BFSIterator and DFSIterator
+std::vector<int> Graph::BFSIterator(int start) const 
+{
+    // If no destination is provided, BFS returns the traversal order.
     return BFS(start, -1);
 }
 
@@ -713,274 +1198,889 @@ std::vector<int> Graph::DFSIterator(int start) const
 // Graph Algorithms
 // ======================
 
-// variantToInt is locate before RemoveNode()
+// An undirected edge between positions u < v. Edges are ordered by weight, then by
+// endpoints; with this strict order the minimum spanning forest is unique, so every
+// algorithm below returns the same one.
+struct MSTEdge 
+{
+    double w;
+    int u, v;
+
+    bool operator<(const MSTEdge& other) const 
+    {
+        if (w != other.w)
+            return w < other.w;
+        return u != other.u ? u < other.u : v < other.v;
+    }
+};
 
-// Helper to convert a MIXED_TYPE to double (for weight)
-double variantToDouble(const MIXED_TYPE &v) 
+// Every edge of an undirected compressed adjacency once, with u < v. Self-loops are dropped.
+static std::vector<MSTEdge> undirectedEdges(const CSRGraph& g)
 {
-    if (std::holds_alternative<double>(v))
-        return std::get<double>(v);
-    if (std::holds_alternative<int>(v))
-        return static_cast<double>(std::get<int>(v));
-    if (std::holds_alternative<double>(v))
-        return static_cast<double>(std::get<double>(v));
-    throw std::runtime_error("Variant does not hold a numeric weight.");
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+    int n = g.NumberOfNodes();
+
+    std::vector<size_t> start(Parallel::ThreadCount() + 1, 0);
+    int blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int block) 
+    {
+        size_t count = 0;
+        for (size_t u = lo; u < hi; u++)
+            for (int j = offset[u]; j < offset[u + 1]; j++)
+                count += target[j] > static_cast<int>(u);
+        start[block + 1] = count;
+    }, 1 << 12);
+    for (int b = 0; b < blocks; b++)
+        start[b + 1] += start[b];
+
+    std::vector<MSTEdge> edges(start[blocks]);
+    Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int block) 
+    {
+        size_t k = start[block];
+        for (size_t u = lo; u < hi; u++)
+            for (int j = offset[u]; j < offset[u + 1]; j++)
+                if (target[j] > static_cast<int>(u))
+                    edges[k++] = {weight[j], static_cast<int>(u), target[j]};
+    }, 1 << 12);
+    return edges;
 }
 
-// Kruskal's algorithm
-// We'll implement a basic union-find structure.
-class UnionFind 
+// The edges e of edges with keep(e), in their original order, selected in parallel.
+template <class Predicate>
+static std::vector<MSTEdge> filterEdges(const std::vector<MSTEdge>& edges, Predicate keep)
 {
-    public:
-        std::vector<int> parent;
+    std::vector<std::vector<MSTEdge>> part(Parallel::ThreadCount());
+    int blocks = Parallel::ForBlocks(0, edges.size(), [&](size_t lo, size_t hi, int block) 
+    {
+        for (size_t i = lo; i < hi; i++)
+            if (keep(edges[i]))
+                part[block].push_back(edges[i]);
+    }, 1 << 14);
+    if (blocks == 1)
+        return std::move(part[0]);
+
+    std::vector<size_t> start(blocks + 1, 0);
+    for (int b = 0; b < blocks; b++)
+        start[b + 1] = start[b] + part[b].size();
+    std::vector<MSTEdge> result(start[blocks]);
+    Parallel::For(0, blocks, [&](size_t b) 
+    {
+        std::copy(part[b].begin(), part[b].end(), result.begin() + start[b]);
+    }, 1);
+    return result;
+}
 
-        UnionFind(int n) : parent(n) 
-        {
-            for (int i = 0; i < n; i++)
-                parent[i] = i;
-        }
+// Filter-Kruskal (Osipov, Sanders and Singler). Consumes edges and appends the
+// forest edges to tree in increasing order.
+static void filterKruskal(std::vector<MSTEdge>& edges, UnionFind& uf, std::vector<MSTEdge>& tree)
+{
+    std::vector<MSTEdge> light;
+    MSTEdge pivot{0, 0, 0};
+    if (edges.size() > static_cast<size_t>(Graph::FILTER_KRUSKAL_CUTOFF)) 
+    {
+        // Pivot: the median of an evenly spaced sample.
+        const size_t samples = 255;
+        std::vector<MSTEdge> sample(samples);
+        for (size_t i = 0; i < samples; i++)
+            sample[i] = edges[i * edges.size() / samples];
+        std::nth_element(sample.begin(), sample.begin() + samples / 2, sample.end());
+        pivot = sample[samples / 2];
+        light = filterEdges(edges, [&](const MSTEdge& x) { return x < pivot; });
+    }
 
-        int find(int i) 
-        {
-            if (parent[i] != i)
-                parent[i] = find(parent[i]);
-            return parent[i];
-        }
+    // Small (or unsplittable) sets are sorted and scanned.
+    if (light.empty()) 
+    {
+        Parallel::Sort(edges, std::less<MSTEdge>());
+        for (const MSTEdge& x : edges)
+            if (uf.Unite(x.u, x.v))
+                tree.push_back(x);
+        std::vector<MSTEdge>().swap(edges);
+        return;
+    }
 
-        void unite(int i, int j) 
-        {
-            int ri = find(i), rj = find(j);
-            if (ri != rj)
-                parent[rj] = ri;
-        }
-};
+    filterKruskal(light, uf, tree);
 
-Graph Graph::Kruskal() 
+    // Heavy edges that do not close a cycle with the light forest.
+    std::vector<MSTEdge> heavy = filterEdges(edges, [&](const MSTEdge& x) 
+    {
+        return !(x < pivot) && uf.Find(x.u) != uf.Find(x.v);
+    });
+    std::vector<MSTEdge>().swap(edges);
+    filterKruskal(heavy, uf, tree);
+}
+
+Graph Graph::Kruskal() const 
 {
     // We assume the graph is undirected.
     if (isDirected)
         throw std::runtime_error("Kruskal's algorithm requires an undirected graph.");
 
-    // Build a list of edges (each as a tuple: u, v, weight)
-    struct Edge { int u, v; double w; };
-    std::vector<Edge> edges;
-
-    for (int i = 0; i < edgelist.Length(); i++) 
-    {
-        std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-        int u = variantToInt(edgeVec[0]);
-        int v = variantToInt(edgeVec[1]);
-        double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-        edges.push_back({u, v, w});
-    }
-
-    // Sort edges by weight (ascending)
-    std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {return a.w < b.w;});
-
-    // Initialize union-find for all nodes.
+    std::vector<MSTEdge> edges = undirectedEdges(Compressed());
     UnionFind uf(n);
-    Graph mst(n, isWeighted, isDirected);
+    std::vector<MSTEdge> tree;
+    tree.reserve(n);
+    filterKruskal(edges, uf, tree);
 
-    // For each edge, if it does not form a cycle, add it.
-    for (const auto &e : edges) 
+    std::vector<int> src(tree.size()), dst(tree.size());
+    std::vector<double> weight(tree.size());
+    for (size_t i = 0; i < tree.size(); i++) 
     {
-        if (uf.find(e.u) != uf.find(e.v)) 
-        {
-            uf.unite(e.u, e.v);
-            mst.AddEdge(e.u, e.v, e.w);
-        }
+        src[i] = tree[i].u;
+        dst[i] = tree[i].v;
+        weight[i] = tree[i].w;
     }
+    Graph mst(nodeVector, isWeighted, isDirected);
+    mst.bulkLoad(src, dst, weight);
     return mst;
 }
 
 // ====================================----
 // Prim's algorithm
 // ====================================----
-Graph Graph::Prim() 
+Graph Graph::Prim() const 
 {
     // We assume undirected graph.
     if (isDirected)
         throw std::runtime_error("Prim's algorithm requires an undirected graph.");
 
-    Graph mst(n, isWeighted, isDirected);
-    std::vector<bool> inTree(n, false);
-    // Use a priority queue: (weight, u, v) where u is the tree vertex, v is outside.
-    typedef std::tuple<double, int, int> PQItem;
-    std::priority_queue<PQItem, std::vector<PQItem>, std::greater<PQItem>> pq;
-    
-    // Start from node 0.
-    inTree[0] = true;
-    // Push all edges from node 0.
-    // To get neighbors, iterate through adjacencyList.
-    auto it0 = adjacencyList.begin();
-    for (int i = 0; i < 0; i++) 
-        ++it0; // already at node 0.
-
-    // We need to find edges from node 0 in edgelist.
-    for (int i = 0; i < edgelist.Length(); i++) 
-    {
-        std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-        int u = variantToInt(edgeVec[0]);
-        int v = variantToInt(edgeVec[1]);
+    // Work on positions: the compressed adjacency gives every incident edge of a vertex directly.
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
 
-        if (u == 0 || v == 0) 
-        {
-            int other = (u == 0) ? v : u;
-            double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-            pq.push({w, 0, other});
-        }
-    }
-    while (!pq.empty()) 
+    // The heap holds every vertex next to the tree once, keyed by its lightest edge
+    // into the tree; parent is the tree end of that edge.
+    std::vector<char> inTree(n, 0);
+    std::vector<int> parent(n, -1);
+    DaryHeap<2> pq(n);
+    std::vector<int> src, dst;
+    std::vector<double> w;
+
+    // Grow one tree per component.
+    for (int root = 0; root < n; root++) 
     {
-        auto [w, u, v] = pq.top();
-        pq.pop();
-        if (inTree[v])
+        if (inTree[root])
             continue;
-        
-        // Add edge (u, v) to MST.
-        mst.AddEdge(u, v, w);
-        inTree[v] = true;
-
-        // Push all edges from v to outside.
-        for (int i = 0; i < edgelist.Length(); i++) 
+        pq.Push(root, 0);
+        while (!pq.IsEmpty()) 
         {
-            std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-            int a = variantToInt(edgeVec[0]);
-            int b = variantToInt(edgeVec[1]);
-            if (a == v || b == v) 
+            auto [key, u] = pq.Pop();
+            inTree[u] = 1;
+            if (parent[u] != -1) 
             {
-                int other = (a == v) ? b : a;
-                if (!inTree[other]) 
-                {
-                    double w2 = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-                    pq.push({w2, v, other});
-                }
+                src.push_back(parent[u]);
+                dst.push_back(u);
+                w.push_back(key);
+            }
+
+            // Lower the keys of the neighbors outside the tree.
+            for (int i = offset[u]; i < offset[u + 1]; i++) 
+            {
+                int v = target[i];
+                if (inTree[v] || (pq.Contains(v) && pq.Key(v) <= weight[i]))
+                    continue;
+                pq.Push(v, weight[i]);
+                parent[v] = u;
             }
         }
     }
+
+    Graph mst(nodeVector, isWeighted, isDirected);
+    mst.bulkLoad(src, dst, w);
     return mst;
 }
 
 // Sollin's (Borůvka's) algorithm
-Graph Graph::Sollin() 
+Graph Graph::Sollin() const 
 {
     // We assume undirected graph.
     if (isDirected)
         throw std::runtime_error("Sollin's algorithm requires an undirected graph.");
 
-    // Initially, each node is its own component.
-    std::vector<int> comp(n);
-    for (int i = 0; i < n; i++)
-        comp[i] = i;
+    // Working copy of the compressed adjacency. The live arcs of u are
+    // [offset[u], end[u]); arcs inside a component are swapped behind end[u].
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    std::vector<int> target = g.Targets();
+    std::vector<double> weight = g.Weights();
+    std::vector<int> end(offset.begin() + 1, offset.end());
+
+    std::vector<int> comp(n);           // Component (union-find root) of every vertex.
+    std::vector<int> cheapest(n, -1);   // Lightest arc from each vertex out of its component.
+    std::unique_ptr<std::atomic<int>[]> best(new std::atomic<int>[n]);    // Vertex with the lightest arc, per root.
+    Parallel::For(0, n, [&](size_t v) { comp[v] = static_cast<int>(v); }, 1 << 16);
 
-    auto findComp = [&](int i) -> int 
+    auto edgeOf = [&](int u) -> MSTEdge 
     {
-        while (comp[i] != i)
-            i = comp[i];
-        return i;
+        int j = cheapest[u];
+        return {weight[j], std::min(u, target[j]), std::max(u, target[j])};
     };
 
-    Graph mst(n, isWeighted, isDirected);
-    int numComponents = n;
-    while (numComponents > 1) 
+    UnionFind uf(n);
+    std::vector<std::vector<MSTEdge>> added(Parallel::ThreadCount());
+    std::vector<MSTEdge> tree;
+    while (true) 
     {
-        // For each component, find the cheapest edge.
-        std::vector<std::tuple<int,int,double>> cheapest(n, {-1, -1, std::numeric_limits<double>::infinity()});
-
-        // Iterate over every edge.
-        for (int i = 0; i < edgelist.Length(); i++) 
+        // Lightest arc of every vertex leaving its component.
+        Parallel::For(0, n, [&](size_t i) 
         {
-            std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-            int u = variantToInt(edgeVec[0]);
-            int v = variantToInt(edgeVec[1]);
-            double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-            int comp_u = findComp(u);
-            int comp_v = findComp(v);
-
-            if (comp_u == comp_v)
-                continue;
-            // Update cheapest for comp_u.
-            if (w < std::get<2>(cheapest[comp_u])) 
+            int u = static_cast<int>(i), cu = comp[u];
+            int bestArc = -1;
+            MSTEdge bestEdge{0, 0, 0};
+            for (int j = offset[u]; j < end[u];) 
             {
-                cheapest[comp_u] = {u, v, w};
+                int v = target[j];
+                if (comp[v] == cu) 
+                {
+                    end[u]--;
+                    std::swap(target[j], target[end[u]]);
+                    std::swap(weight[j], weight[end[u]]);
+                    continue;
+                }
+                MSTEdge x{weight[j], std::min(u, v), std::max(u, v)};
+                if (bestArc == -1 || x < bestEdge) 
+                {
+                    bestArc = j;
+                    bestEdge = x;
+                }
+                j++;
             }
-            // Update cheapest for comp_v.
-            if (w < std::get<2>(cheapest[comp_v])) 
+            cheapest[u] = bestArc;
+            best[u].store(-1, std::memory_order_relaxed);
+        }, 1 << 10);
+
+        // Lightest arc of every component: CAS the vertex holding it into best[root].
+        Parallel::For(0, n, [&](size_t i) 
+        {
+            int u = static_cast<int>(i);
+            if (cheapest[u] == -1)
+                return;
+            MSTEdge x = edgeOf(u);
+            std::atomic<int>& slot = best[comp[u]];
+            int current = slot.load(std::memory_order_relaxed);
+            while ((current == -1 || x < edgeOf(current)) &&
+                   !slot.compare_exchange_weak(current, u, std::memory_order_relaxed)) {}
+        }, 1 << 12);
+
+        // Contract. Two components that chose the same edge add it once, from the smaller root.
+        int blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int block) 
+        {
+            for (size_t r = lo; r < hi; r++) 
             {
-                cheapest[comp_v] = {u, v, w};
+                int u = best[r].load(std::memory_order_relaxed);
+                if (u == -1)
+                    continue;
+                MSTEdge x = edgeOf(u);
+                int other = comp[target[cheapest[u]]];
+                int back = best[other].load(std::memory_order_relaxed);
+                if (other < static_cast<int>(r) && back != -1) 
+                {
+                    MSTEdge y = edgeOf(back);
+                    if (!(x < y) && !(y < x))
+                        continue;
+                }
+                if (uf.Unite(x.u, x.v))
+                    added[block].push_back(x);
             }
-        }
+        }, 1 << 12);
 
-        // Add the cheapest edges.
-        for (int i = 0; i < n; i++) 
+        size_t before = tree.size();
+        for (int b = 0; b < blocks; b++) 
         {
-            auto [u, v, w] = cheapest[i];
-            if (u == -1 || v == -1)
-                continue;
-            int comp_u = findComp(u);
-            int comp_v = findComp(v);
-            if (comp_u == comp_v)
-                continue;
-            mst.AddEdge(u, v, w);
-            // Merge the two components.
-            comp[comp_v] = comp_u;
-            numComponents--;
+            tree.insert(tree.end(), added[b].begin(), added[b].end());
+            added[b].clear();
         }
+        if (tree.size() == before)
+            break;
+        comp = uf.Representatives();
     }
+
+    // Same edge order as Kruskal().
+    Parallel::Sort(tree, std::less<MSTEdge>());
+    std::vector<int> src(tree.size()), dst(tree.size());
+    std::vector<double> w(tree.size());
+    for (size_t i = 0; i < tree.size(); i++) 
+    {
+        src[i] = tree[i].u;
+        dst[i] = tree[i].v;
+        w[i] = tree[i].w;
+    }
+    Graph mst(nodeVector, isWeighted, isDirected);
+    mst.bulkLoad(src, dst, w);
     return mst;
 }
 
 // Dijkstra's algorithm
-std::vector<int> Graph::Dijkstra(int source, int destination) 
+// Label-setting search over the compressed adjacency. Each vertex is settled once,
+// so the cost is O((V + E) log V) with any of the comparison-based queues.
+template <class Queue>
+static void runDijkstra(const CSRGraph& g, int s, int t, Queue& pq,
+                        std::vector<double>& dist, std::vector<int>& parent)
+{
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+
+    dist[s] = 0.0;
+    pq.Push(s, 0.0);
+
+    while (!pq.IsEmpty()) 
+    {
+        auto [d, u] = pq.Pop();
+        if (u == t)
+            break;  // The destination is settled; its distance is final.
+        
+        for (int i = offset[u]; i < offset[u + 1]; i++) 
+        {
+            if (weight[i] < 0)
+                throw std::invalid_argument("Dijkstra's algorithm requires non-negative edge weights.");
+            int v = target[i];
+            double nd = d + weight[i];
+            if (nd < dist[v]) 
+            {
+                dist[v] = nd;
+                parent[v] = u;
+                pq.Push(v, nd);
+            }
+        }
+    }
+}
+
+void Graph::dijkstra(int s, int t, HeapType heap, std::vector<double>& dist, std::vector<int>& parent) const 
+{
+    const CSRGraph& g = Compressed();
+    dist.assign(n, std::numeric_limits<double>::infinity());
+    parent.assign(n, -1);
+
+    switch (heap) 
+    {
+        case HeapType::BINARY: 
+        {
+            DaryHeap<2> pq(n);
+            runDijkstra(g, s, t, pq, dist, parent);
+            break;
+        }
+        case HeapType::FOUR_ARY: 
+        {
+            DaryHeap<4> pq(n);
+            runDijkstra(g, s, t, pq, dist, parent);
+            break;
+        }
+        case HeapType::PAIRING: 
+        {
+            PairingHeap pq(n);
+            runDijkstra(g, s, t, pq, dist, parent);
+            break;
+        }
+        case HeapType::RADIX: 
+        {
+            RadixHeap pq(n);
+            runDijkstra(g, s, t, pq, dist, parent);
+            break;
+        }
+        default:
+            throw std::invalid_argument("Unknown heap type.");
+    }
+}
+
+std::vector<int> Graph::Dijkstra(int source, int destination, HeapType heap) const 
 {
-    if (source < 0 || source >= n || destination < 0 || destination >= n)
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
         throw std::out_of_range("Invalid node identifier.");
 
+    std::vector<double> dist;
+    std::vector<int> parent;
+    dijkstra(s, t, heap, dist, parent);
+
+    // Reconstruct the path.
+    if (dist[t] == std::numeric_limits<double>::infinity())
+        return std::vector<int>();  // No path found.
+    std::vector<int> path;
+
+    for (int cur = t; cur != -1; cur = parent[cur])
+        path.push_back(nodeVector[cur]);
+    std::reverse(path.begin(), path.end());
+
+    return path;
+}
+
+ShortestPaths Graph::Dijkstra(int source, HeapType heap) const 
+{
+    int s = indexOf(source);
+    if (s == -1)
+        throw std::out_of_range("Invalid node identifier.");
+
+    ShortestPaths result;
+    result.source = s;
+    dijkstra(s, -1, heap, result.distance, result.parent);
+    return result;
+}
+
+// Point-to-point searches.
+// Path from the source to meet along parentF, then from meet to the destination
+// along parentB (empty for a one-directional search).
+static std::vector<int> joinPaths(int meet, const std::vector<int>& parentF, const std::vector<int>& parentB,
+                                  const std::vector<int>& nodeVector)
+{
+    std::vector<int> path;
+    for (int cur = meet; cur != -1; cur = parentF[cur])
+        path.push_back(nodeVector[cur]);
+    std::reverse(path.begin(), path.end());
+    if (!parentB.empty())
+        for (int cur = parentB[meet]; cur != -1; cur = parentB[cur])
+            path.push_back(nodeVector[cur]);
+    return path;
+}
+
+PathResult Graph::AStar(int source, int destination, const std::function<double(int)>& heuristic) const 
+{
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
     const double INF = std::numeric_limits<double>::infinity();
-    std::vector<double> dist(n, INF);
+
+    // h[v] is evaluated once, when v is first reached.
+    std::vector<double> dist(n, INF), h(n, INF);
     std::vector<int> parent(n, -1);
-    dist[source] = 0.0;
+    DaryHeap<2> pq(n);
+    PathResult result{std::vector<int>(), INF, 1};
+
+    dist[s] = 0.0;
+    h[s] = heuristic(nodeVector[s]);
+    pq.Push(s, h[s]);
+    while (!pq.IsEmpty()) 
+    {
+        int u = pq.Pop().second;
+        if (u == t)
+            break;  // With an admissible heuristic no queued vertex can lead to a shorter path.
+        for (int i = offset[u]; i < offset[u + 1]; i++) 
+        {
+            if (weight[i] < 0)
+                throw std::invalid_argument("A* search requires non-negative edge weights.");
+            int v = target[i];
+            double nd = dist[u] + weight[i];
+            if (nd >= dist[v])
+                continue;
+            if (dist[v] == INF) 
+            {
+                h[v] = heuristic(nodeVector[v]);
+                result.visited++;
+            }
+            dist[v] = nd;
+            parent[v] = u;
+            if (h[v] != INF)
+                pq.Push(v, nd + h[v]);
+        }
+    }
 
-    // Priority queue: (distance, node)
-    typedef std::pair<double,int> PDI;
-    std::priority_queue<PDI, std::vector<PDI>, std::greater<PDI>> pq;
-    pq.push({0.0, source});
+    if (dist[t] != INF) 
+    {
+        result.distance = dist[t];
+        result.path = joinPaths(t, parent, std::vector<int>(), nodeVector);
+    }
+    return result;
+}
 
-    while (!pq.empty()) 
+PathResult Graph::BidirectionalDijkstra(int source, int destination) const 
+{
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+
+    const CSRGraph& g = Compressed();
+    const double INF = std::numeric_limits<double>::infinity();
+
+    // Index 0 searches forward over the out-arcs, index 1 backward over the in-arcs.
+    const std::vector<int>* offset[2] = {&g.Offsets(), &g.InOffsets()};
+    const std::vector<int>* head[2] = {&g.Targets(), &g.Sources()};
+    const std::vector<double>* weight[2] = {&g.Weights(), &g.InWeights()};
+    std::vector<double> dist[2] = {std::vector<double>(n, INF), std::vector<double>(n, INF)};
+    std::vector<int> parent[2] = {std::vector<int>(n, -1), std::vector<int>(n, -1)};
+    DaryHeap<2> pq[2] = {DaryHeap<2>(n), DaryHeap<2>(n)};
+    PathResult result{std::vector<int>(), INF, s == t ? 1 : 2};
+
+    double best = (s == t) ? 0.0 : INF;     // Length of the shortest path found so far.
+    int meet = (s == t) ? s : -1;           // A vertex on that path.
+    dist[0][s] = 0.0;
+    dist[1][t] = 0.0;
+    pq[0].Push(s, 0.0);
+    pq[1].Push(t, 0.0);
+
+    // Any path not found yet is at least as long as the sum of the two queue minima.
+    while (!pq[0].IsEmpty() && !pq[1].IsEmpty() && pq[0].Top().first + pq[1].Top().first < best) 
     {
-        auto [d, u] = pq.top();
-        pq.pop();
-        if (d > dist[u])
-            continue;
-        
-        // Get all edges from u.
-        for (int i = 0; i < edgelist.Length(); i++) 
+        int side = pq[0].Top().first <= pq[1].Top().first ? 0 : 1;
+        const std::vector<int>& off = *offset[side];
+        const std::vector<int>& hd = *head[side];
+        const std::vector<double>& w = *weight[side];
+        std::vector<double>& d = dist[side];
+        const std::vector<double>& other = dist[1 - side];
+
+        int u = pq[side].Pop().second;
+        for (int i = off[u]; i < off[u + 1]; i++) 
         {
-            std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-            int a = variantToInt(edgeVec[0]);
-            int b = variantToInt(edgeVec[1]);
-            double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
+            if (w[i] < 0)
+                throw std::invalid_argument("Dijkstra's algorithm requires non-negative edge weights.");
+            int v = hd[i];
+            double nd = d[u] + w[i];
+            if (nd < d[v]) 
+            {
+                if (d[v] == INF && other[v] == INF)
+                    result.visited++;
+                d[v] = nd;
+                parent[side][v] = u;
+                pq[side].Push(v, nd);
+            }
+            if (nd + other[v] < best) 
+            {
+                best = nd + other[v];
+                meet = v;
+            }
+        }
+    }
 
-            // For an undirected graph, consider both directions.
-            if (a == u || (!isDirected && b == u)) 
+    if (meet != -1) 
+    {
+        result.distance = best;
+        result.path = joinPaths(meet, parent[0], parent[1], nodeVector);
+    }
+    return result;
+}
+
+PathResult Graph::BidirectionalBFS(int source, int destination) const 
+{
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>* offset[2] = {&g.Offsets(), &g.InOffsets()};
+    const std::vector<int>* head[2] = {&g.Targets(), &g.Sources()};
+    std::vector<int> dist[2] = {std::vector<int>(n, -1), std::vector<int>(n, -1)};
+    std::vector<int> parent[2] = {std::vector<int>(n, -1), std::vector<int>(n, -1)};
+    std::vector<int> frontier[2] = {{s}, {t}};
+    std::vector<int> next;
+    PathResult result{std::vector<int>(), std::numeric_limits<double>::infinity(), s == t ? 1 : 2};
+
+    int best = (s == t) ? 0 : -1;
+    int meet = (s == t) ? s : -1;
+    dist[0][s] = 0;
+    dist[1][t] = 0;
+
+    // Before a level in which the searches meet, their balls are disjoint, so the
+    // first meeting level contains a shortest path; finish it and keep the best.
+    while (meet == -1 && !frontier[0].empty() && !frontier[1].empty()) 
+    {
+        int side = frontier[0].size() <= frontier[1].size() ? 0 : 1;
+        const std::vector<int>& off = *offset[side];
+        const std::vector<int>& hd = *head[side];
+        std::vector<int>& d = dist[side];
+        const std::vector<int>& other = dist[1 - side];
+
+        next.clear();
+        for (int u : frontier[side]) 
+        {
+            for (int i = off[u]; i < off[u + 1]; i++) 
             {
-                int v = (a == u) ? b : a;
-                if (dist[u] + w < dist[v]) 
+                int v = hd[i];
+                if (d[v] == -1) 
+                {
+                    d[v] = d[u] + 1;
+                    parent[side][v] = u;
+                    next.push_back(v);
+                    if (other[v] == -1)
+                        result.visited++;
+                }
+                if (other[v] != -1 && (best == -1 || d[v] + other[v] < best)) 
+                {
+                    best = d[v] + other[v];
+                    meet = v;
+                }
+            }
+        }
+        frontier[side].swap(next);
+    }
+
+    if (meet != -1) 
+    {
+        result.distance = best;
+        result.path = joinPaths(meet, parent[0], parent[1], nodeVector);
+    }
+    return result;
+}
+
+// Non-negative doubles order the same way as their IEEE bit patterns read as
+// unsigned integers, so a distance fits in one atomic word and the atomic
+// minimum is a compare-and-swap loop.
+static inline std::uint64_t distanceBits(double d) 
+{
+    std::uint64_t b;
+    std::memcpy(&b, &d, sizeof b);
+    return b;
+}
+
+static inline double bitsDistance(std::uint64_t b) 
+{
+    double d;
+    std::memcpy(&d, &b, sizeof d);
+    return d;
+}
+
+// Lower dist to d if it is smaller. Returns true if this call lowered it.
+static inline bool atomicMin(std::atomic<std::uint64_t>& dist, double d) 
+{
+    std::uint64_t bits = distanceBits(d);
+    std::uint64_t old = dist.load(std::memory_order_relaxed);
+    while (bits < old) 
+    {
+        if (dist.compare_exchange_weak(old, bits, std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+ShortestPaths Graph::DeltaStepping(int source, double delta) const 
+{
+    int s = indexOf(source);
+    if (s == -1)
+        throw std::out_of_range("Invalid node identifier.");
+    if (delta < 0)
+        throw std::invalid_argument("Bucket width must be non-negative.");
+
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+    size_t arcs = target.size();
+
+    // Small inputs: threads would cost more than they save.
+    if (n + static_cast<long long>(arcs) < DELTA_STEPPING_CUTOFF || Parallel::ThreadCount() == 1)
+        return Dijkstra(source);
+
+    // Validate the weights and pick the default bucket width.
+    std::vector<double> partial(Parallel::ThreadCount(), 0.0);
+    std::vector<char> negative(Parallel::ThreadCount(), 0);
+    Parallel::ForBlocks(0, arcs, [&](size_t lo, size_t hi, int b) 
+    {
+        double sum = 0;
+        for (size_t i = lo; i < hi; i++) 
+        {
+            if (weight[i] < 0)
+                negative[b] = 1;
+            sum += weight[i];
+        }
+        partial[b] = sum;
+    });
+    if (std::find(negative.begin(), negative.end(), 1) != negative.end())
+        throw std::invalid_argument("Delta-stepping requires non-negative edge weights.");
+    if (delta == 0) 
+    {
+        double total = 0;
+        for (double p : partial)
+            total += p;
+        delta = (arcs > 0 && total > 0) ? total / arcs : 1.0;
+    }
+
+    const double INF = std::numeric_limits<double>::infinity();
+    std::unique_ptr<std::atomic<std::uint64_t>[]> dist(new std::atomic<std::uint64_t>[n]);
+    Parallel::For(0, n, [&](size_t v) { dist[v].store(distanceBits(INF), std::memory_order_relaxed); });
+    dist[s].store(distanceBits(0.0), std::memory_order_relaxed);
+
+    auto bucketOf = [&](int v) 
+    {
+        return static_cast<std::uint64_t>(bitsDistance(dist[v].load(std::memory_order_relaxed)) / delta);
+    };
+
+    // Buckets are sparse, so they live in an ordered map keyed by index. A vertex may
+    // sit in several buckets; only the one matching its current distance counts.
+    std::map<std::uint64_t, std::vector<int>> bucket;
+    bucket[0].push_back(s);
+    std::vector<int> stamp(n, -1);      // Last sub-phase that expanded a vertex.
+    std::vector<char> settled(n, 0);    // Already in the removed set of the current bucket.
+    std::vector<std::vector<int>> improved(Parallel::ThreadCount());
+    int phase = 0;
+
+    // Relax the light or heavy arcs of the given vertices in parallel and file
+    // every vertex whose distance dropped into its new bucket.
+    auto relax = [&](const std::vector<int>& from, bool light) 
+    {
+        int blocks = Parallel::ForBlocks(0, from.size(), [&](size_t lo, size_t hi, int b) 
+        {
+            std::vector<int>& out = improved[b];
+            for (size_t k = lo; k < hi; k++) 
+            {
+                int u = from[k];
+                double du = bitsDistance(dist[u].load(std::memory_order_relaxed));
+                for (int i = offset[u]; i < offset[u + 1]; i++) 
+                {
+                    if ((weight[i] <= delta) != light)
+                        continue;
+                    if (atomicMin(dist[target[i]], du + weight[i]))
+                        out.push_back(target[i]);
+                }
+            }
+        }, 256);
+        for (int b = 0; b < blocks; b++) 
+        {
+            for (int v : improved[b])
+                bucket[bucketOf(v)].push_back(v);
+            improved[b].clear();
+        }
+    };
+
+    std::vector<int> frontier, removed;
+    while (!bucket.empty()) 
+    {
+        std::uint64_t current = bucket.begin()->first;
+        removed.clear();
+
+        // Light phases: repeat until the current bucket stays empty.
+        while (!bucket.empty() && bucket.begin()->first == current) 
+        {
+            std::vector<int> entries;
+            entries.swap(bucket.begin()->second);
+            bucket.erase(bucket.begin());
+
+            frontier.clear();
+            for (int v : entries) 
+            {
+                if (stamp[v] == phase || bucketOf(v) != current)
+                    continue;   // Duplicate or stale entry.
+                stamp[v] = phase;
+                frontier.push_back(v);
+                if (!settled[v]) 
+                {
+                    settled[v] = 1;
+                    removed.push_back(v);
+                }
+            }
+            phase++;
+            relax(frontier, true);
+        }
+
+        // Heavy arcs can only reach later buckets, so one pass suffices.
+        relax(removed, false);
+        for (int v : removed)
+            settled[v] = 0;
+    }
+
+    ShortestPaths result;
+    result.source = s;
+    result.distance.resize(n);
+    Parallel::For(0, n, [&](size_t v) { result.distance[v] = bitsDistance(dist[v].load(std::memory_order_relaxed)); });
+    result.parent = shortestPathParents(s, result.distance);
+    return result;
+}
+
+// Recover a shortest path tree from final distances: the parent of v is a tail
+// of a tight in-arc (dist[u] + w == dist[v]). Arcs with dist[u] < dist[v] are
+// taken in parallel; the few vertices reachable only over zero-length tight arcs
+// are attached afterwards from already attached vertices, so no cycle can form.
+std::vector<int> Graph::shortestPathParents(int s, const std::vector<double>& dist) const 
+{
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& inOffset = g.InOffsets();
+    const std::vector<int>& sources = g.Sources();
+    const std::vector<double>& inWeight = g.InWeights();
+    const double INF = std::numeric_limits<double>::infinity();
+
+    std::vector<int> parent(n, -1);
+    std::vector<char> attached(n, 0);
+    Parallel::For(0, n, [&](size_t v) 
+    {
+        if (static_cast<int>(v) == s || dist[v] == INF)
+        {
+            attached[v] = 1;
+            return;
+        }
+        for (int i = inOffset[v]; i < inOffset[v + 1]; i++) 
+        {
+            int u = sources[i];
+            if (dist[u] < dist[v] && dist[u] + inWeight[i] == dist[v]) 
+            {
+                parent[v] = u;
+                attached[v] = 1;
+                return;
+            }
+        }
+    }, 1024);
+
+    std::vector<int> pending;
+    for (int v = 0; v < n; v++)
+        if (!attached[v])
+            pending.push_back(v);
+    while (!pending.empty()) 
+    {
+        std::vector<int> rest;
+        for (int v : pending) 
+        {
+            for (int i = inOffset[v]; i < inOffset[v + 1]; i++) 
+            {
+                int u = sources[i];
+                if (attached[u] && dist[u] != INF && dist[u] + inWeight[i] == dist[v]) 
                 {
-                    dist[v] = dist[u] + w;
                     parent[v] = u;
-                    pq.push({dist[v], v});
+                    attached[v] = 1;
+                    break;
                 }
             }
+            if (!attached[v])
+                rest.push_back(v);
         }
+        if (rest.size() == pending.size())
+            throw std::logic_error("Distances do not form a shortest path tree.");
+        pending.swap(rest);
     }
-    // Reconstruct the path.
-    if (dist[destination] == INF)
+    return parent;
+}
+
+// Follow the parent pointers of a shortest path tree back to its source.
+std::vector<int> Graph::PathTo(const ShortestPaths& paths, int destination) const 
+{
+    int t = indexOf(destination);
+    if (t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+    if (paths.distance.size() != static_cast<size_t>(n))
+        throw std::invalid_argument("Shortest path tree does not belong to this graph.");
+
+    if (paths.distance[t] == std::numeric_limits<double>::infinity())
+        return std::vector<int>();  // No path found.
+    std::vector<int> path;
+
+    for (int cur = t; cur != -1; cur = paths.parent[cur])
+        path.push_back(nodeVector[cur]);
+    std::reverse(path.begin(), path.end());
+
+    return path;
+}
+
+std::vector<int> Graph::PathTo(const BFSResult& tree, int destination) const 
+{
+    int t = indexOf(destination);
+    if (t == -1)
+        throw std::out_of_range("Invalid node identifier.");
+    if (tree.distance.size() != static_cast<size_t>(n))
+        throw std::invalid_argument("BFS tree does not belong to this graph.");
+
+    if (tree.distance[t] == -1)
         return std::vector<int>();  // No path found.
     std::vector<int> path;
 
-    for (int cur = destination; cur != -1; cur = parent[cur])
-        path.push_back(cur);
+    for (int cur = t; cur != -1; cur = tree.parent[cur])
+        path.push_back(nodeVector[cur]);
     std::reverse(path.begin(), path.end());
 
     return path;
@@ -989,36 +2089,38 @@ std::vector<int> Graph::Dijkstra(int source, int destination)
 // Bellman-Ford algorithm
 std::vector<int> Graph::BellmanFord(int source, int destination) 
 {
-    if (source < 0 || source >= n || destination < 0 || destination >= n)
+    int s = indexOf(source);
+    int t = indexOf(destination);
+    if (s == -1 || t == -1)
         throw std::out_of_range("Invalid node identifier.");
 
+    const CSRGraph& g = Compressed();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+
     const double INF = std::numeric_limits<double>::infinity();
     std::vector<double> dist(n, INF);
     std::vector<int> parent(n, -1);
-    dist[source] = 0.0;
+    dist[s] = 0.0;
 
-    // Relax all edges n-1 times.
+    // Relax all arcs at most n-1 times.
     for (int i = 0; i < n - 1; i++) 
     {
         bool updated = false;
-        for (int j = 0; j < edgelist.Length(); j++) 
+        for (int u = 0; u < n; u++) 
         {
-            std::vector<MIXED_TYPE> edgeVec = edgelist[j];
-            int u = variantToInt(edgeVec[0]);
-            int v = variantToInt(edgeVec[1]);
-            double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-            if (dist[u] != INF && dist[u] + w < dist[v]) 
-            {
-                dist[v] = dist[u] + w;
-                parent[v] = u;
-                updated = true;
-            }
-            // For undirected graphs, also relax (v,u).
-            if (!isDirected && dist[v] != INF && dist[v] + w < dist[u]) 
+            if (dist[u] == INF)
+                continue;
+            for (int j = offset[u]; j < offset[u + 1]; j++) 
             {
-                dist[u] = dist[v] + w;
-                parent[u] = v;
-                updated = true;
+                int v = target[j];
+                if (dist[u] + weight[j] < dist[v]) 
+                {
+                    dist[v] = dist[u] + weight[j];
+                    parent[v] = u;
+                    updated = true;
+                }
             }
         }
         if (!updated)
@@ -1026,115 +2128,87 @@ std::vector<int> Graph::BellmanFord(int source, int destination)
     }
 
     // Check for negative cycles.
-    for (int j = 0; j < edgelist.Length(); j++) 
-    {
-        std::vector<MIXED_TYPE> edgeVec = edgelist[j];
-        int u = variantToInt(edgeVec[0]);
-        int v = variantToInt(edgeVec[1]);
-        double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
-        if (dist[u] != INF && dist[u] + w < dist[v])
-            throw std::runtime_error("Graph contains a negative weight cycle");
+    for (int u = 0; u < n; u++) 
+    {
+        if (dist[u] == INF)
+            continue;
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            if (dist[u] + weight[j] < dist[target[j]])
+                throw std::runtime_error("Graph contains a negative weight cycle");
     }
 
     // Reconstruct the path.
-    if (dist[destination] == INF)
+    if (dist[t] == INF)
         return std::vector<int>();  // No path found.
     std::vector<int> path;
 
-    for (int cur = destination; cur != -1; cur = parent[cur])
-        path.push_back(cur);
+    for (int cur = t; cur != -1; cur = parent[cur])
+        path.push_back(nodeVector[cur]);
     std::reverse(path.begin(), path.end());
 
     return path;
 }
 
 // Floyd's algorithm
+// Kept for compatibility: runs FloydWarshall() and then materializes the path of
+// every reachable pair (i, j) with i < j.
 std::vector<std::vector<int>> Graph::Floyd() 
 {
-    // Create a matrix for distances and a predecessor matrix.
-    const double INF = std::numeric_limits<double>::infinity();
-    std::vector<std::vector<double>> dist(n, std::vector<double>(n, INF));
-    std::vector<std::vector<int>> pred(n, std::vector<int>(n, -1));
-    
-    // Initialize distances: 0 for self, edge weight if edge exists.
-    for (int i = 0; i < n; i++) 
-    {
-        dist[i][i] = 0;
-    }
-
-    // For each edge in edgelist:
-    for (int i = 0; i < edgelist.Length(); i++) 
-    {
-        std::vector<MIXED_TYPE> edgeVec = edgelist[i];
-        int u = variantToInt(edgeVec[0]);
-        int v = variantToInt(edgeVec[1]);
-        double w = isWeighted ? variantToDouble(edgeVec[2]) : 1.0;
+    DistanceMatrix<double> all = FloydWarshall<double>();
 
-        dist[u][v] = w;
-        pred[u][v] = u;
-        if (!isDirected) 
-        {
-            dist[v][u] = w;
-            pred[v][u] = v;
-        }
-    }
-    
-    // Floyd–Warshall
-    for (int k = 0; k < n; k++) 
-        for (int i = 0; i < n; i++) 
-            for (int j = 0; j < n; j++) 
-                if (dist[i][k] + dist[k][j] < dist[i][j]) 
-                {
-                    dist[i][j] = dist[i][k] + dist[k][j];
-                    pred[i][j] = pred[k][j];
-                }
-    
-    // Reconstruct paths: for every pair (i,j), reconstruct the path.
-    std::vector<std::vector<int>> allPaths(n, std::vector<int>());
-
-    // For simplicity, we return a vector of paths for the pairs (i,j) where i<j.
     std::vector<std::vector<int>> paths;
     for (int i = 0; i < n; i++) 
     {
         for (int j = i+1; j < n; j++) 
         {
-            if (dist[i][j] == INF)
+            if (!all.Reachable(nodeVector[i], nodeVector[j]))
                 continue; // no path
-            
-            std::vector<int> path;
-            int cur = j;
-            while (cur != i) 
-            {
-                path.push_back(cur);
-                cur = pred[i][cur];
-            }
-
-            path.push_back(i);
-            std::reverse(path.begin(), path.end());
-            paths.push_back(path);
+            paths.push_back(all.Path(nodeVector[i], nodeVector[j]));
         }
     }
     return paths;
 }
 
+template <class T>
+DistanceMatrix<T> Graph::FloydWarshall() const 
+{
+    return DistanceMatrix<T>(Compressed(), nodeVector);
+}
+
+template DistanceMatrix<double> Graph::FloydWarshall<double>() const;
+template DistanceMatrix<float> Graph::FloydWarshall<float>() const;
+template DistanceMatrix<int> Graph::FloydWarshall<int>() const;
+
 // ===============================
-// Adjacency Matrix Generation
+// Maximum Flow
 // ===============================
 
-// Helper: convert an edge (a vector of MIXED_TYPE) into its endpoints and weight.
-static int getEdgeEndpoint(const std::vector<MIXED_TYPE>& edge, int index) 
+FlowResult Graph::MaxFlow(int source, int sink, FlowAlgorithm algorithm) const 
 {
-    // We assume that the endpoint is stored as an int.
-    return std::get<int>(edge[index]);
-}
+    int s = indexOf(source);
+    int t = indexOf(sink);
+    if (s == -1 || t == -1)
+        throw std::invalid_argument("Node does not exist.");
 
-static double getEdgeWeight(const std::vector<MIXED_TYPE>& edge, bool isWeighted) 
-{
-    if (isWeighted && edge.size() >= 3)
-        return std::get<double>(edge[2]);
-    return 1.0;
+    // The live edges in printing order, as positions.
+    EdgeStore<double> edges = getEdgeList();
+    std::vector<int> src(edges.Length()), dst(edges.Length());
+    for (int i = 0; i < edges.Length(); i++) 
+    {
+        src[i] = nodeIndex.at(edges.Source(i));
+        dst[i] = nodeIndex.at(edges.Target(i));
+    }
+    FlowNetwork network(n, src, dst, edges.Weights(), isDirected);
+    FlowResult result = network.MaxFlow(s, t, algorithm);
+    for (int& v : result.sourceSide)
+        v = nodeVector[v];
+    return result;
 }
 
+// ===============================
+// Adjacency Matrix Generation
+// ===============================
+
 // Generate the adjacency matrix as a SparseMatrix.
 SparseMatrix Graph::AdjMatSparse() const 
 {
@@ -1145,10 +2219,11 @@ SparseMatrix Graph::AdjMatSparse() const
     // Iterate over all edges in the edge list.
     for (int i = 0; i < edgelist.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        int u = getEdgeEndpoint(edge, 0);
-        int v = getEdgeEndpoint(edge, 1);
-        double weight = getEdgeWeight(edge, isWeighted);
+        if (removedEdge[i])
+            continue;
+        int u = nodeIndex.at(edgelist.Source(i));
+        int v = nodeIndex.at(edgelist.Target(i));
+        double weight = edgelist.Weight(i);
 
         // Use StoreNum to store the weight (converted to double) at (u, v).
         mat.StoreNum(std::variant<int, double>(static_cast<double>(weight)), u, v);
@@ -1169,10 +2244,11 @@ LinkedSparseMatrix Graph::AdjMatLinked() const
     // Iterate over all edges.
     for (int i = 0; i < edgelist.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        int u = getEdgeEndpoint(edge, 0);
-        int v = getEdgeEndpoint(edge, 1);
-        double weight = getEdgeWeight(edge, isWeighted);
+        if (removedEdge[i])
+            continue;
+        int u = nodeIndex.at(edgelist.Source(i));
+        int v = nodeIndex.at(edgelist.Target(i));
+        double weight = edgelist.Weight(i);
         // Add the term (u,v,weight).
         mat.StoreNum(weight, u, v);
         // For undirected graphs, also add the symmetric term.
@@ -1199,7 +2275,14 @@ Graph& Graph::operator=(const Graph& other)
         isDirected = other.isDirected;
         nodeVector = other.nodeVector;
         edgelist = other.edgelist;
+        removedEdge = other.removedEdge;
+        removedEdges = other.removedEdges;
+        nodeIndex = other.nodeIndex;
         adjacencyList = other.adjacencyList;
+        edgeSlot = other.edgeSlot;
+        inDegree = other.inDegree;
+        csr = other.csr;
+        csrValid = other.csrValid;
     }
     return *this;
 }
@@ -1211,12 +2294,13 @@ Graph& Graph::operator=(const Graph& other)
 // -------------------------------------------------------------------
 bool Graph::operator==(const Graph& other) const 
 {
-    return (n == other.n &&
-            e == other.e &&
-            isWeighted == other.isWeighted &&
-            isDirected == other.isDirected &&
-            nodeVector == other.nodeVector &&
-            edgelist == other.edgelist);
+    if (n != other.n || e != other.e || isWeighted != other.isWeighted ||
+        isDirected != other.isDirected || nodeVector != other.nodeVector)
+        return false;
+    // Tombstones are not part of the graph; compare the live edges only.
+    if (removedEdges == 0 && other.removedEdges == 0)
+        return edgelist == other.edgelist;
+    return getEdgeList() == other.getEdgeList();
 }
 
 // Inequality operator
@@ -1230,35 +2314,29 @@ bool Graph::operator!=(const Graph& other) const
 // Prints a list of edges. For weighted graphs, each edge is printed as
 // {u, v, w}, otherwise as {u, v}.
 // ----------------------------------------------------------------------
-GeneralArray<std::vector<MIXED_TYPE>> Graph::getEdgeList() const 
+EdgeStore<double> Graph::getEdgeList() const 
 {
-    return edgelist;
+    if (removedEdges == 0)
+        return edgelist;
+
+    // Skip the tombstones of deleted edges.
+    EdgeStore<double> live = edgelist;
+    live.Compact(removedEdge);
+    return live;
 }
 
 std::ostream& operator<<(std::ostream& out, const Graph& graph) 
 {
     out << "Graph edges: ";
-    // Use getEdgeList() to get a GeneralArray of edge vectors.
-    auto edgeList = graph.getEdgeList();  
+    EdgeStore<double> edgeList = graph.getEdgeList();  
 
     for (int i = 0; i < edgeList.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgeList[i];
-        if (graph.isWeighted) 
-        {
-            // For weighted graphs, assume edge[0] and edge[1] are ints and edge[2] is a double.
-            out << "{" 
-                << std::get<int>(edge[0]) << ", " 
-                << std::get<int>(edge[1]) << ", " 
-                << std::get<double>(edge[2]) << "} ";
-        } 
-        else 
-        {
-            // For unweighted graphs, only two values.
-            out << "{" 
-                << std::get<int>(edge[0]) << ", " 
-                << std::get<int>(edge[1]) << "} ";
-        }
+        // For weighted graphs, print {u, v, w}; for unweighted graphs only two values.
+        out << "{" << edgeList.Source(i) << ", " << edgeList.Target(i);
+        if (graph.isWeighted)
+            out << ", " << edgeList.Weight(i);
+        out << "} ";
     }
     return out;
 }
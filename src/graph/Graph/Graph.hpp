@@ -6,14 +6,84 @@
 #include <iterator> 
 #include <list>
 #include <stack>
+#include <unordered_map>
+#include <functional>
 
 #include "../../array/GeneralArray/GeneralArray.hpp"
 #include "../../array/SparseMatrix/SparseMatrix.hpp"
 #include "../../chain/LinkedSparseMatrix/LinkedSparseMatrix.hpp"
-#include "../../chain/DoublyLinkedList/DoublyLinkedList.hpp"
+#include "../CSRGraph/CSRGraph.hpp"
+#include "../VertexQueue/VertexQueue.hpp"
+#include "../GraphLoader/GraphLoader.hpp"
+#include "../GraphView/GraphView.hpp"
+#include "../EdgeStore/EdgeStore.hpp"
+#include "../DistanceMatrix/DistanceMatrix.hpp"
+#include "../GraphAnalytics/GraphAnalytics.hpp"
+#include "../GraphOrdering/GraphOrdering.hpp"
+#include "../GraphPartitioner/GraphPartitioner.hpp"
+#include "../FlowNetwork/FlowNetwork.hpp"
 
 using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
 
+/**
+ * @brief Single-source shortest path tree.
+ *
+ * Entry i describes the i-th node of the graph (see Graph::Nodes()); for a graph
+ * built with Graph(numNodes) that is simply node i. parent[i] is the position of
+ * the predecessor of node i on a shortest path, or -1 for the source and for
+ * unreachable nodes. Unreachable nodes have an infinite distance.
+ */
+struct ShortestPaths
+{
+    int source;                     // Position of the source node.
+    std::vector<double> distance;   // Shortest distance from the source.
+    std::vector<int> parent;        // Predecessor position on a shortest path.
+};
+
+/**
+ * @brief Breadth-first search tree with hop distances.
+ *
+ * Indexed by position like ShortestPaths. distance[i] is the number of edges on a
+ * shortest path from the source, or -1 if node i is unreachable; parent[i] is the
+ * position of a BFS parent (-1 for the source and unreachable nodes). order lists
+ * the positions of the reached nodes level by level, ascending within a level.
+ */
+struct BFSResult
+{
+    int source;                 // Position of the source node.
+    std::vector<int> distance;  // Hop count from the source, -1 if unreachable.
+    std::vector<int> parent;    // Parent position in the BFS tree.
+    std::vector<int> order;     // Reached positions in visitation order.
+};
+
+/**
+ * @brief Result of a point-to-point search (A*, bidirectional Dijkstra or BFS).
+ *
+ * path lists node identifiers from the source to the destination and is empty if
+ * the destination is unreachable, in which case distance is infinite. visited
+ * counts the vertices the search labeled, i.e. how much of the graph it touched.
+ */
+struct PathResult
+{
+    std::vector<int> path;      // Node identifiers from source to destination.
+    double distance;            // Path length: total weight, or number of edges for BFS.
+    int visited;                // Vertices reached by the search (both directions together).
+};
+
+/**
+ * @brief Biconnected components, articulation points and bridges of an undirected graph.
+ *
+ * All entries are node identifiers. Every component lists its nodes in Nodes()
+ * order; components appear in the order the depth-first search completes them.
+ * Nodes without edges belong to no component.
+ */
+struct BiconnectedResult
+{
+    std::vector<std::vector<int>> components;       // Node sets of the biconnected components.
+    std::vector<int> articulationPoints;            // Nodes whose removal disconnects their component, in Nodes() order.
+    std::vector<std::pair<int, int>> bridges;       // Edges whose removal disconnects their component, as {parent, child} in the DFS tree.
+};
+
 /**
  * @brief Graph data structure (without support for multiple edges).
  *
@@ -25,8 +95,14 @@ using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
  * The graph can operate in both weighted and unweighted modes, and can be either directed or undirected.
  * In an undirected graph, the edge {u, v, w} is considered identical to {v, u, w}.
  *
- * The graph is stored using an adjacency matrix (via either SparseMatrix or LinkedSparseMatrix)
- * while also maintaining a vector of node IDs and a vector of edges (for convenience).
+ * The graph is stored as adjacency lists plus an edge list (see EdgeStore), with a
+ * vector of node IDs; adjacency matrices (SparseMatrix or LinkedSparseMatrix) are
+ * generated on request.
+ *
+ * Traversal and shortest-path algorithms run on a compressed sparse row copy of the
+ * adjacency (see CSRGraph). The copy is built on first use, or eagerly by Freeze(),
+ * and is discarded by any modification of the graph. Vertex i of the compressed copy
+ * is the node nodeVector[i].
  */
 
 class Graph 
@@ -35,17 +111,47 @@ class Graph
         int n;   // Number of vertices.
         int e;   // Number of edges.
         std::vector<int> nodeVector; // List of node identifiers.
-        GeneralArray<std::vector<MIXED_TYPE>> edgelist;
-        DoublyLinkedList<DoublyLinkedList<int>> adjacencyList;    // The adjacency list reprecentation of a graph
+        std::unordered_map<int, int> nodeIndex;  // Node identifier -> position in nodeVector.
+        EdgeStore<double> edgelist;     // Edges as node identifiers, in insertion order.
+        std::vector<char> removedEdge;  // Tombstone per edgelist slot: 1 once the edge was deleted.
+        int removedEdges;               // Number of tombstones in edgelist.
+        std::vector<std::vector<int>> adjacencyList;    // The adjacency list reprecentation of a graph, one list per position
+        std::vector<std::vector<int>> edgeSlot;         // edgelist slot of every adjacencyList entry.
+        std::vector<int> inDegree;   // In-degree per position (directed graphs only).
         bool isWeighted;  // If true, edges carry weights (otherwise, weight is forced to 1).
         bool isDirected;  // If true, the graph is directed; otherwise, it is undirected.
+        mutable CSRGraph csr;   // Compressed adjacency, indexed by position in nodeVector.
+        mutable bool csrValid;  // False once the graph is modified after the last build.
 
-        // helper function for finding biconnected part
-        GeneralArray<std::vector<MIXED_TYPE>> getEdgeList() const;
-        void BCCUtil(int u, std::vector<int>& disc, std::vector<int>& low,
-            std::vector<int>& parent, int& time,
-            std::stack<std::pair<int,int>>& st,
-            std::vector<std::vector<int>>& bcc) const;
+        // Position of a node identifier in nodeVector, or -1 if it does not exist. O(1).
+        int indexOf(int node) const;
+
+        // Renumber nodeIndex for nodeVector[from..] after nodes were inserted or erased.
+        void compactIndex(int from);
+
+        // Tombstone the edge in an edgelist slot and update e and inDegree. The
+        // adjacency entries of the edge stay until dropRemoved() runs on their lists.
+        void removeSlot(int slot);
+
+        // Erase the adjacency entries of tombstoned edges from the list at a position.
+        void dropRemoved(int index);
+
+        // Drop all tombstones from edgelist and renumber edgeSlot. O(V + E).
+        void compactEdges();
+
+        // Add edges given by positions to a graph that has its nodes but no edges. O(V + E).
+        // weight may be empty for unweighted graphs.
+        void bulkLoad(const std::vector<int>& src, const std::vector<int>& dst, std::vector<double> weight);
+
+        // Dijkstra from position s on the compressed adjacency; stops once position t
+        // is settled (t = -1 settles everything).
+        void dijkstra(int s, int t, HeapType heap, std::vector<double>& dist, std::vector<int>& parent) const;
+
+        // Shortest path tree (parent positions) consistent with final distances from position s.
+        std::vector<int> shortestPathParents(int s, const std::vector<double>& dist) const;
+
+        // The live edges of edgelist, without tombstones (used by operator== and operator<<).
+        EdgeStore<double> getEdgeList() const;
 
     public:
         // ==================================================
@@ -84,6 +190,46 @@ class Graph
          */
         ~Graph();
 
+        /**
+         * @brief Build a graph from a whole edge array at once.
+         *
+         * The bulk path used for large inputs (see GraphLoader). The edges are
+         * optionally sorted and deduplicated in parallel, then the node index,
+         * adjacency lists and compressed adjacency are built in one pass each,
+         * without going through AddEdge().
+         *
+         * The nodes are 0 .. edges.numNodes-1 if numNodes is set, otherwise the
+         * distinct endpoints in ascending order. The graph is weighted iff
+         * edges.weight is non-empty.
+         *
+         * @param edges The edges; taken by value so callers can move a large array in.
+         * @param directed True if the graph should be directed.
+         * @param dedupe If true (default), parallel edges are merged keeping the smallest weight
+         *               and the edges are stored in (u, v) order; otherwise input order is kept.
+         * @return The constructed graph.
+         */
+        static Graph FromEdges(EdgeArray edges, bool directed = false, bool dedupe = true);
+
+        /**
+         * @brief Build a graph with given nodes from a whole edge array at once.
+         *
+         * The bulk path of FromEdges(), but the nodes are exactly nodes, in that order,
+         * so isolated nodes and arbitrary identifiers are kept; edges.numNodes is
+         * ignored. The edges are always sorted by (u, v) and parallel edges merged
+         * into one by aggregate. The graph is weighted iff edges.weight is non-empty
+         * or aggregate is SUM or COUNT.
+         *
+         * @param nodes The node identifiers.
+         * @param edges The edges, as node identifiers.
+         * @param directed True if the graph should be directed.
+         * @param aggregate Weight of a merged edge: MIN (default), MAX, SUM or COUNT.
+         * @return The constructed graph.
+         * @throws std::invalid_argument if the node identifiers are not unique or an
+         *         endpoint is not one of them.
+         */
+        static Graph FromEdges(const std::vector<int>& nodes, EdgeArray edges, bool directed = false,
+                               EdgeAggregator aggregate = EdgeAggregator::MIN);
+
         // ==================================================
         // Modification Methods (Add/Remove)
         // ==================================================
@@ -116,11 +262,43 @@ class Graph
         /**
          * @brief Remove an edge from the graph.
          *
+         * Removes one edge from u to v (nothing happens if there is none). The edge is
+         * tombstoned in the edge list rather than erased, so the cost is O(deg(u) + deg(v))
+         * plus an amortized O(1) share of the next compaction.
+         *
          * @param u The source node.
          * @param v The destination node.
          */
         void RemoveEdge(int u, int v);
 
+        /**
+         * @brief Apply a batch of edge deletions and insertions.
+         *
+         * The deletions are applied first, then the insertions, so a batch that deletes
+         * and re-inserts an edge changes its weight. Every adjacency list touched by the
+         * deletions is scanned once for the whole batch, and the compressed adjacency is
+         * rebuilt once at the next query instead of once per edit. Deleting an edge that
+         * does not exist is ignored, as in RemoveEdge(); each deletion removes one edge.
+         *
+         * Deleted edges are tombstoned and the edge list is compacted once the
+         * tombstones outnumber the live edges, which keeps every update amortized
+         * O(1) apart from the adjacency scans.
+         *
+         * @param inserts Edges to add; weights are taken from inserts.weight if it is non-empty, 1 otherwise.
+         * @param deletes Edges to remove; deletes.weight is ignored.
+         * @throws std::invalid_argument if an endpoint does not exist or the arrays have different lengths.
+         *         Nothing is modified in that case.
+         */
+        void ApplyUpdates(const EdgeArray& inserts, const EdgeArray& deletes);
+
+        /**
+         * @brief Drop the tombstones of deleted edges now.
+         *
+         * Deletions compact the edge list on their own once half of it is dead; call
+         * this to release the memory earlier, e.g. before the graph becomes read-only.
+         */
+        void Compact();
+
         // ==================================================
         // Accessor Methods (Properties)
         // ==================================================
@@ -164,6 +342,116 @@ class Graph
          */
         int NumberOfEdges() const;
 
+        /**
+         * @brief Get the node identifiers in position order.
+         *
+         * Position i in per-node results such as ShortestPaths refers to Nodes()[i].
+         *
+         * @return A vector of node identifiers.
+         */
+        std::vector<int> Nodes() const;
+
+        /**
+         * @brief Check whether a node identifier belongs to the graph.
+         *
+         * @param node Node identifier.
+         * @return True if the node exists. Runs in O(1).
+         */
+        bool ExistsNode(int node) const;
+
+        /**
+         * @brief Get the position of a node identifier.
+         *
+         * Positions are dense (0 .. NumberOfNodes()-1) and follow Nodes(). Removing a
+         * node shifts the positions of the nodes after it down by one.
+         *
+         * @param node Node identifier.
+         * @return The position of the node. Runs in O(1).
+         */
+        int IndexOf(int node) const;
+
+        // ==================================================
+        // Compressed Representation
+        // ==================================================
+
+        /**
+         * @brief Build the compressed (CSR/CSC) adjacency now.
+         *
+         * Algorithms build it on demand anyway; calling Freeze() once after the graph
+         * has been assembled moves that cost out of the first query. Any later
+         * modification discards the compressed copy until it is needed again.
+         */
+        void Freeze();
+
+        /**
+         * @brief Check whether an up-to-date compressed adjacency exists.
+         * @return True if the graph has not been modified since the last build.
+         */
+        bool IsFrozen() const;
+
+        /**
+         * @brief Get the compressed adjacency, building it if necessary.
+         *
+         * Vertex i of the returned CSRGraph is the i-th node identifier of the graph.
+         *
+         * @return A reference that stays valid until the graph is next modified.
+         */
+        const CSRGraph& Compressed() const;
+
+        /**
+         * @brief Renumber the node positions for better memory locality.
+         *
+         * Computes the ordering with GraphOrdering on the compressed adjacency and
+         * moves every node to its new position; see Reorder(const std::vector<int>&).
+         * Node identifiers, edges and weights do not change. Traversals on large
+         * sparse graphs whose nodes were inserted in an arbitrary order run
+         * noticeably faster afterwards.
+         *
+         * @param strategy The ordering (reverse Cuthill-McKee, degree or Gorder).
+         */
+        void Reorder(OrderingStrategy strategy);
+
+        /**
+         * @brief Move the nodes to the positions given by a list of their identifiers.
+         *
+         * Afterwards Nodes() == nodes, and per-position results (ShortestPaths,
+         * BFSResult, CSR vertices) follow the new order. The compressed adjacency
+         * is rebuilt on its next use. O(V + E).
+         *
+         * @param nodes Every node identifier of the graph exactly once.
+         * @throws std::invalid_argument if nodes is not a permutation of Nodes().
+         */
+        void Reorder(const std::vector<int>& nodes);
+
+        // ==================================================
+        // Snapshots
+        // ==================================================
+
+        /**
+         * @brief Write the graph as a binary snapshot.
+         *
+         * The snapshot holds the node identifiers and the compressed adjacency in the
+         * format described in GraphView, which queries it in place without loading.
+         * Edge order within a node is not kept: arcs are stored sorted by position.
+         *
+         * @param path Output file; replaced atomically if it exists.
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        void Save(const std::string& path) const;
+
+        /**
+         * @brief Rebuild a mutable graph from a snapshot written by Save().
+         *
+         * Nodes keep their identifiers and positions; the edges are loaded through the
+         * bulk path of FromEdges() in (u, v) order. Open a GraphView instead when
+         * read-only queries are enough.
+         *
+         * @param path Snapshot file.
+         * @return The graph.
+         * @throws std::runtime_error if the file is not a valid snapshot.
+         */
+        static Graph Load(const std::string& path);
+
         // ==================================================
         // Spanning Tree and Component Methods
         // ==================================================
@@ -178,17 +466,67 @@ class Graph
         /**
          * @brief Compute the connected components of the graph.
          *
+         * Uses GraphAnalytics::ConnectedComponents() on the compressed adjacency, in
+         * parallel. Edge directions are ignored, so a directed graph yields its weakly
+         * connected components. The components are ordered by their first node in
+         * Nodes(), and the nodes of each component follow Nodes() as well.
+         *
          * @return A vector of vectors, where each inner vector contains the node IDs of a connected component.
          */
         std::vector<std::vector<int>> Components() const;
 
+        /**
+         * @brief Split the nodes into parts of nearly equal size with few edges between them.
+         *
+         * Runs the multilevel k-way partitioner GraphPartitioner::Partition() on the
+         * compressed adjacency. Entry i of the partition belongs to Nodes()[i];
+         * GraphPartitioner::Extract() cuts the compressed adjacency into per-part
+         * shards with halo nodes for distributed processing.
+         *
+         * @param parts Number of parts, at least 1.
+         * @param imbalance Allowed excess of the largest part over the average, e.g. 0.03 for 3%.
+         * @return The part of every position, the edge cut and the communication volume.
+         * @throws std::invalid_argument if parts < 1 or imbalance is negative.
+         */
+        PartitionResult Partition(int parts, double imbalance = 0.03) const;
+
         /**
          * @brief Compute the biconnected components of the graph.
          *
          * @return A vector of vectors, where each inner vector contains the node IDs of a biconnected component.
+         * @throws std::runtime_error if the graph is directed.
          */
         std::vector<std::vector<int>> Biconnected() const;
 
+        /**
+         * @brief Biconnected components, articulation points and bridges in one pass.
+         *
+         * Iterative Hopcroft–Tarjan depth-first search over the compressed adjacency
+         * with explicit stacks, so the depth of the graph is bounded by memory, not by
+         * the call stack. O(V + E). Self-loops are ignored; a pair of parallel edges
+         * is never a bridge.
+         *
+         * @return The components, articulation points and bridges.
+         * @throws std::runtime_error if the graph is directed.
+         */
+        BiconnectedResult BiconnectedDecomposition() const;
+
+        /**
+         * @brief Nodes whose removal increases the number of connected components.
+         *
+         * @return Node IDs in Nodes() order.
+         * @throws std::runtime_error if the graph is directed.
+         */
+        std::vector<int> ArticulationPoints() const;
+
+        /**
+         * @brief Edges whose removal increases the number of connected components.
+         *
+         * @return The bridges as pairs of node IDs.
+         * @throws std::runtime_error if the graph is directed.
+         */
+        std::vector<std::pair<int, int>> Bridges() const;
+
         // ==================================================
         // Traversal and Path Finding
         // ==================================================
@@ -215,6 +553,41 @@ class Graph
          */
         std::vector<int> DFS(int start = 0, int destination = -1) const;
 
+        /**
+         * @brief Multithreaded, direction-optimizing breadth-first search.
+         *
+         * Level-synchronous BFS over the compressed adjacency. Each level is expanded
+         * either top-down (frontier vertices push to their neighbors, collected in
+         * per-thread buffers) or bottom-up (unvisited vertices look for a parent in
+         * a bitmap of the frontier), switching when the growing frontier gets large
+         * relative to the unexplored edges (Beamer et al.). Top-down levels only
+         * touch the frontier and its arcs, so the search is O(V + E) however long
+         * the diameter. Graphs with fewer than PARALLEL_BFS_CUTOFF nodes plus arcs,
+         * or a single worker thread, are searched with a sequential queue instead.
+         *
+         * @param source The source node identifier.
+         * @return Hop distances, BFS parents and the visitation order, level by level.
+         */
+        BFSResult ParallelBFS(int source) const;
+
+        static const int PARALLEL_BFS_CUTOFF = 1 << 15;    // Smaller graphs use a sequential BFS.
+
+        /**
+         * @brief Breadth-first searches from many sources in one bit-parallel sweep.
+         *
+         * Runs GraphAnalytics::MultiSourceBFS() on the compressed adjacency: up to
+         * 256 searches share every pass over the arcs, which is much faster than
+         * calling BFS() or ParallelBFS() once per source.
+         *
+         * @param sources The source node identifiers.
+         * @param keepDistances If false, only the per-source statistics (reached
+         *        nodes, distance sum, eccentricity) are returned.
+         * @return Rows in the order of sources; sources and the columns of distance
+         *         are positions (see Nodes()).
+         * @throws std::out_of_range if a source node does not exist.
+         */
+        MultiSourceBFSResult MultiSourceBFS(const std::vector<int>& sources, bool keepDistances = true) const;
+
         /**
          * @brief Get an iterator (vector) of node IDs in BFS order.
          *
@@ -238,32 +611,158 @@ class Graph
         /**
          * @brief Compute the minimum spanning tree using Kruskal's algorithm.
          *
+         * Filter-Kruskal: the edges are split around a sampled pivot weight, the light
+         * half is solved first, and heavy edges whose endpoints are already connected
+         * are filtered out in parallel before the heavy half is processed. Edge sets of
+         * at most FILTER_KRUSKAL_CUTOFF edges are sorted with Parallel::Sort() and
+         * scanned. Most heavy edges of a dense graph are never sorted.
+         *
+         * Ties between equal weights are broken by the endpoint positions, so Kruskal()
+         * and Sollin() return the same forest, with the edges in increasing weight.
+         * A disconnected graph yields a minimum spanning forest.
+         *
          * @return A Graph object representing the minimum spanning tree.
+         * @throws std::runtime_error if the graph is directed.
          */
-        Graph Kruskal();
+        Graph Kruskal() const;
+
+        static const int FILTER_KRUSKAL_CUTOFF = 1 << 16;  // Smaller edge sets are sorted whole.
 
         /**
          * @brief Compute the minimum spanning tree using Prim's algorithm.
          *
+         * Grows the tree over the compressed adjacency with an indexed binary heap
+         * (DaryHeap<2>) that keeps one entry per vertex and lowers its key when a
+         * lighter edge into the tree is found, in O((V + E) log V). Every component is
+         * grown in turn, so a disconnected graph yields a minimum spanning forest.
+         *
          * @return A Graph object representing the minimum spanning tree.
+         * @throws std::runtime_error if the graph is directed.
          */
-        Graph Prim();
+        Graph Prim() const;
 
         /**
-         * @brief Compute the minimum spanning tree using Sollin's algorithm.
+         * @brief Compute the minimum spanning tree using Sollin's (Borůvka's) algorithm.
+         *
+         * In every round all vertices find their lightest edge leaving their component
+         * in parallel, the components pick their lightest edge with compare-and-swap,
+         * and the chosen edges are contracted with a lock-free UnionFind. Edges inside
+         * a component are dropped from the working adjacency for good, so later rounds
+         * only scan the edges still between components. O(log V) rounds.
          *
          * @return A Graph object representing the minimum spanning tree.
+         * @throws std::runtime_error if the graph is directed.
          */
-        Graph Sollin();
+        Graph Sollin() const;
 
         /**
          * @brief Compute the shortest path from a source to a destination using Dijkstra's algorithm.
          *
+         * Runs in O((V + E) log V) over the compressed adjacency and stops as soon as the
+         * destination is settled. Edge weights must be non-negative.
+         *
          * @param source The source node identifier.
          * @param destination The destination node identifier.
-         * @return A vector of node IDs representing the shortest path.
+         * @param heap The priority queue to use (HeapType::RADIX requires integer weights).
+         * @return A vector of node IDs representing the shortest path (empty if unreachable).
+         */
+        std::vector<int> Dijkstra(int source, int destination, HeapType heap = HeapType::BINARY) const;
+
+        /**
+         * @brief Compute the shortest paths from a source to every node using Dijkstra's algorithm.
+         *
+         * @param source The source node identifier.
+         * @param heap The priority queue to use (HeapType::RADIX requires integer weights).
+         * @return The full distance and parent arrays.
          */
-        std::vector<int> Dijkstra(int source, int destination);
+        ShortestPaths Dijkstra(int source, HeapType heap = HeapType::BINARY) const;
+
+        /**
+         * @brief A* search guided by a heuristic.
+         *
+         * Dijkstra's algorithm with the queue ordered by distance plus heuristic, so
+         * vertices that lead towards the destination are settled first. heuristic(v)
+         * must not overestimate the distance from node v to the destination (e.g. the
+         * straight-line or Manhattan distance between coordinates on a grid or road
+         * graph); the path is then a shortest one. With a consistent heuristic every
+         * vertex is settled at most once, otherwise vertices may be reopened. A
+         * heuristic of infinity prunes a vertex; one that is constantly 0 gives
+         * Dijkstra's algorithm.
+         *
+         * @param source The source node identifier.
+         * @param destination The destination node identifier.
+         * @param heuristic Lower bound on the distance from a node identifier to the destination.
+         * @return The path, its length and the number of vertices visited.
+         * @throws std::out_of_range if a node does not exist.
+         * @throws std::invalid_argument if a negative edge weight is met.
+         */
+        PathResult AStar(int source, int destination, const std::function<double(int)>& heuristic) const;
+
+        /**
+         * @brief Point-to-point shortest path by bidirectional Dijkstra.
+         *
+         * Searches forward from the source over out-arcs and backward from the
+         * destination over in-arcs, always advancing the side whose queue minimum is
+         * smaller, and stops once the two minima together reach the shortest path
+         * found so far. On road-like graphs this settles roughly two balls of half the
+         * radius instead of one of the full radius.
+         *
+         * @param source The source node identifier.
+         * @param destination The destination node identifier.
+         * @return The path, its length and the number of vertices visited.
+         * @throws std::out_of_range if a node does not exist.
+         * @throws std::invalid_argument if a negative edge weight is met.
+         */
+        PathResult BidirectionalDijkstra(int source, int destination) const;
+
+        /**
+         * @brief Point-to-point path with the fewest edges by bidirectional BFS.
+         *
+         * Expands whole levels, each time on the side with the smaller frontier, and
+         * stops after the first level in which the two searches meet. Edge weights
+         * are ignored.
+         *
+         * @param source The source node identifier.
+         * @param destination The destination node identifier.
+         * @return The path, its number of edges and the number of vertices visited.
+         * @throws std::out_of_range if a node does not exist.
+         */
+        PathResult BidirectionalBFS(int source, int destination) const;
+
+        /**
+         * @brief Parallel single-source shortest paths by delta-stepping (Meyer and Sanders).
+         *
+         * Vertices are kept in buckets of width delta. The light arcs (weight <= delta)
+         * of a bucket are relaxed in parallel until the bucket stays empty, then its
+         * heavy arcs are relaxed once. Distances are updated with an atomic minimum.
+         * Graphs with fewer than DELTA_STEPPING_CUTOFF nodes plus arcs, or a single
+         * worker thread, are handed to the sequential Dijkstra instead.
+         *
+         * @param source The source node identifier.
+         * @param delta Bucket width; 0 (default) uses the mean arc weight.
+         * @return The same distance and parent arrays as Dijkstra(source).
+         */
+        ShortestPaths DeltaStepping(int source, double delta = 0) const;
+
+        static const int DELTA_STEPPING_CUTOFF = 1 << 15;   // Smaller graphs use Dijkstra.
+
+        /**
+         * @brief Extract the path to a destination from a shortest path tree.
+         *
+         * @param paths A tree returned by one of the single-source methods of this graph.
+         * @param destination The destination node identifier.
+         * @return A vector of node IDs from the source to the destination (empty if unreachable).
+         */
+        std::vector<int> PathTo(const ShortestPaths& paths, int destination) const;
+
+        /**
+         * @brief Extract the path to a destination from a BFS tree (fewest edges).
+         *
+         * @param tree A tree returned by ParallelBFS() on this graph.
+         * @param destination The destination node identifier.
+         * @return A vector of node IDs from the source to the destination (empty if unreachable).
+         */
+        std::vector<int> PathTo(const BFSResult& tree, int destination) const;
 
         /**
          * @brief Compute the shortest path from a source to a destination using the Bellman-Ford algorithm.
@@ -277,10 +776,41 @@ class Graph
         /**
          * @brief Compute the shortest paths between all pairs of nodes using Floyd's algorithm.
          *
+         * Materializes every path; prefer FloydWarshall() for large graphs.
+         *
          * @return A two-dimensional vector, where each inner vector represents the shortest path between a pair of nodes.
          */
         std::vector<std::vector<int>> Floyd();
 
+        /**
+         * @brief All-pairs shortest paths by a blocked, multithreaded Floyd–Warshall.
+         *
+         * Returns a compact distance matrix plus predecessor matrix; individual paths
+         * are reconstructed on demand with DistanceMatrix::Path(). T selects the
+         * distance type: double (default), float, or int (integer weights only).
+         *
+         * @return The distance and predecessor matrices.
+         * @throws std::runtime_error if the graph contains a negative weight cycle.
+         */
+        template <class T = double>
+        DistanceMatrix<T> FloydWarshall() const;
+
+        /**
+         * @brief Maximum flow and minimum cut between two nodes.
+         *
+         * Edge weights are the capacities (1 in unweighted graphs); undirected edges
+         * carry flow either way. The graph is copied into a FlowNetwork for every
+         * call; build a FlowNetwork once to solve many source and sink pairs.
+         *
+         * @param source Node identifier of the source.
+         * @param sink Node identifier of the sink.
+         * @param algorithm PUSH_RELABEL (default) or DINIC.
+         * @return The flow value; flow[i] is the flow on the i-th edge in the order
+         *         operator<< prints them; sourceSide holds node identifiers, in Nodes() order.
+         * @throws std::invalid_argument if a node does not exist, source == sink or a weight is negative.
+         */
+        FlowResult MaxFlow(int source, int sink, FlowAlgorithm algorithm = FlowAlgorithm::PUSH_RELABEL) const;
+
         // ==================================================
         // Adjacency Matrix Generation
         // ==================================================
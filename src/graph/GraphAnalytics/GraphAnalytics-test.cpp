@@ -0,0 +1,245 @@
+// GraphAnalytics-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread GraphAnalytics.cpp GraphAnalytics-test.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../Parallel/Parallel.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include "GraphAnalytics.hpp"
+#include "../Parallel/Parallel.hpp"
+
+using namespace std;
+
+// Triangles by brute force over all vertex triples (small graphs only).
+static long long BruteTriangles(int n, const vector<int>& src, const vector<int>& dst)
+{
+    set<pair<int, int>> edge;
+    for (size_t i = 0; i < src.size(); i++)
+        if (src[i] != dst[i])
+            edge.insert({min(src[i], dst[i]), max(src[i], dst[i])});
+    long long t = 0;
+    for (int a = 0; a < n; a++)
+        for (int b = a + 1; b < n; b++)
+            if (edge.count({a, b}))
+                for (int c = b + 1; c < n; c++)
+                    if (edge.count({a, c}) && edge.count({b, c}))
+                        t++;
+    return t;
+}
+
+// Smallest vertex of the component of every vertex, by repeated relaxation.
+static vector<int> BruteComponents(int n, const vector<int>& src, const vector<int>& dst)
+{
+    vector<int> label(n);
+    for (int v = 0; v < n; v++)
+        label[v] = v;
+    for (bool changed = true; changed;)
+    {
+        changed = false;
+        for (size_t i = 0; i < src.size(); i++)
+        {
+            int m = min(label[src[i]], label[dst[i]]);
+            if (label[src[i]] != m || label[dst[i]] != m)
+            {
+                label[src[i]] = label[dst[i]] = m;
+                changed = true;
+            }
+        }
+    }
+    return label;
+}
+
+// Hop distances from s along the out-arcs, by a queue-based BFS.
+static vector<int> BruteBFS(const CSRGraph& g, int s)
+{
+    vector<int> distance(g.NumberOfNodes(), -1), queue = {s};
+    distance[s] = 0;
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        int u = queue[head];
+        for (int j = g.Offsets()[u]; j < g.Offsets()[u + 1]; j++)
+            if (distance[g.Targets()[j]] == -1)
+            {
+                distance[g.Targets()[j]] = distance[u] + 1;
+                queue.push_back(g.Targets()[j]);
+            }
+    }
+    return distance;
+}
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // Two triangles sharing vertex 2, plus a tail 4 - 5 - 6.
+    //   0 - 1, 1 - 2, 2 - 0, 2 - 3, 3 - 4, 4 - 2, 4 - 5, 5 - 6
+    // ---------------------------------------------------------------
+    vector<int> src = {0, 1, 2, 2, 3, 4, 4, 5};
+    vector<int> dst = {1, 2, 0, 3, 4, 2, 5, 6};
+    CSRGraph g(7, src, dst, vector<double>(src.size(), 1.0), false);
+
+    cout << "Triangles: " << GraphAnalytics::TriangleCount(g) << endl;
+
+    vector<int> core = GraphAnalytics::CoreNumbers(g);
+    cout << "Core numbers:";
+    for (int c : core)
+        cout << " " << c;
+    cout << endl;
+
+    vector<int> label = GraphAnalytics::LabelPropagation(g);
+    cout << "Labels:";
+    for (int l : label)
+        cout << " " << l;
+    cout << endl;
+
+    // Components of a forest of three trees, one of them the isolated vertex 4.
+    CSRGraph forest(7, {0, 2, 5, 3}, {1, 3, 6, 6}, {1, 1, 1, 1}, false);
+    vector<int> component = GraphAnalytics::ConnectedComponents(forest);
+    cout << "Components:";
+    for (int c : component)
+        cout << " " << c;
+    cout << endl;
+
+    MultiSourceBFSResult bfs = GraphAnalytics::MultiSourceBFS(g, {0, 6});
+    for (size_t i = 0; i < bfs.sources.size(); i++)
+    {
+        cout << "Hops from " << bfs.sources[i] << ":";
+        for (int h : bfs.distance[i])
+            cout << " " << h;
+        cout << " (sum " << bfs.distanceSum[i] << ", eccentricity " << bfs.eccentricity[i] << ")" << endl;
+    }
+
+    PageRankResult pull = GraphAnalytics::PageRank(g);
+    PageRankResult push = GraphAnalytics::PageRank(g, 0.85, 1e-8, 1000, PageRankMode::PUSH);
+    cout << "PageRank (pull, " << pull.iterations << " rounds):";
+    for (double r : pull.rank)
+        cout << " " << round(r * 1000) / 1000;
+    cout << endl;
+    cout << "PageRank (push, " << push.iterations << " rounds):";
+    for (double r : push.rank)
+        cout << " " << round(r * 1000) / 1000;
+    cout << endl << endl;
+
+    // A directed graph with a dangling vertex (3): the ranks still sum to one.
+    CSRGraph d(4, {0, 1, 2, 2}, {1, 2, 0, 3}, {1, 1, 1, 1}, true);
+    PageRankResult dp = GraphAnalytics::PageRank(d, 0.85, 1e-10, 1000);
+    PageRankResult dq = GraphAnalytics::PageRank(d, 0.85, 1e-10, 1000, PageRankMode::PUSH);
+    double sum = 0;
+    for (int v = 0; v < 4; v++)
+    {
+        sum += dp.rank[v];
+        assert(fabs(dp.rank[v] - dq.rank[v]) < 1e-8);
+    }
+    assert(fabs(sum - 1) < 1e-9);
+    try
+    {
+        GraphAnalytics::TriangleCount(d);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl << endl;
+    }
+
+    // ---------------------------------------------------------------
+    // Random graphs on four threads: brute-force triangles, core numbers checked
+    // against their definition, push vs. pull PageRank.
+    // ---------------------------------------------------------------
+    Parallel::SetThreadCount(4);
+    srand(3);
+    for (int trial = 0; trial < 20; trial++)
+    {
+        int n = 20 + rand() % 60;
+        vector<int> s, t;
+        for (int i = 0; i < n * (1 + trial % 6); i++)
+        {
+            s.push_back(rand() % n);
+            t.push_back(rand() % n);
+        }
+        CSRGraph r(n, s, t, vector<double>(s.size(), 1.0), false);
+        assert(GraphAnalytics::TriangleCount(r) == BruteTriangles(n, s, t));
+
+        // Components against a sequential search, undirected and (weakly) directed.
+        for (bool directed : {false, true})
+        {
+            CSRGraph c(n, s, t, vector<double>(s.size(), 1.0), directed);
+            vector<int> label = GraphAnalytics::ConnectedComponents(c);
+            vector<int> expected = BruteComponents(n, s, t);
+            assert(label == expected);
+        }
+
+        PageRankResult a = GraphAnalytics::PageRank(r, 0.85, 1e-10, 1000);
+        PageRankResult b = GraphAnalytics::PageRank(r, 0.85, 1e-10, 1000, PageRankMode::PUSH);
+        for (int v = 0; v < n; v++)
+            assert(fabs(a.rank[v] - b.rank[v]) < 1e-8);
+    }
+
+    // Multi-source BFS against one BFS per source: 300 sources make a full batch of
+    // 256 searches and one of 44, on an undirected and a directed graph.
+    for (bool directed : {false, true})
+    {
+        const int n = 5000;
+        vector<int> s, t;
+        for (int i = 0; i < 3 * n; i++)
+        {
+            s.push_back(rand() % n);
+            t.push_back(rand() % n);
+        }
+        CSRGraph r(n, s, t, vector<double>(s.size(), 1.0), directed);
+        vector<int> sources;
+        for (int i = 0; i < 300; i++)
+            sources.push_back(rand() % n);
+        MultiSourceBFSResult all = GraphAnalytics::MultiSourceBFS(r, sources);
+        MultiSourceBFSResult stats = GraphAnalytics::MultiSourceBFS(r, sources, false);
+        assert(stats.distance.empty() && stats.distanceSum == all.distanceSum);
+        for (size_t i = 0; i < sources.size(); i++)
+        {
+            vector<int> expected = BruteBFS(r, sources[i]);
+            assert(all.distance[i] == expected);
+            int reached = 0, eccentricity = 0;
+            long long sum = 0;
+            for (int h : expected)
+                if (h != -1)
+                {
+                    reached++;
+                    sum += h;
+                    eccentricity = max(eccentricity, h);
+                }
+            assert(all.reached[i] == reached && all.distanceSum[i] == sum && all.eccentricity[i] == eccentricity);
+        }
+    }
+
+    // Large enough for the parallel peeling: every vertex of core number k has at
+    // least k neighbors of core number >= k, and k + 1 would be impossible.
+    const int n = 30000;
+    vector<int> s, t;
+    for (int i = 0; i < 8 * n; i++)
+    {
+        int u = rand() % n;
+        s.push_back(u);
+        t.push_back(rand() % 2 ? rand() % n : (u + 1 + rand() % 50) % n);
+    }
+    CSRGraph big(n, s, t, vector<double>(s.size(), 1.0), false);
+    vector<int> parallel = GraphAnalytics::CoreNumbers(big);
+    Parallel::SetThreadCount(1);
+    vector<int> sequential = GraphAnalytics::CoreNumbers(big);
+    assert(parallel == sequential);
+    const vector<int>& offset = big.Offsets();
+    const vector<int>& target = big.Targets();
+    for (int u = 0; u < n; u++)
+    {
+        int atLeast = 0;
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            if (target[j] != u && sequential[target[j]] >= sequential[u])
+                atLeast++;
+        assert(atLeast >= sequential[u]);
+    }
+    cout << "Max core number of the random graph: " << *max_element(parallel.begin(), parallel.end()) << endl;
+    Parallel::SetThreadCount(0);
+    return 0;
+}
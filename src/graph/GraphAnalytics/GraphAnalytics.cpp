@@ -0,0 +1,868 @@
+#include "GraphAnalytics.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include "../Parallel/Parallel.hpp"
+#include "../UnionFind/UnionFind.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// ================================
+// Helpers
+// ================================
+
+static inline void atomicAdd(std::atomic<double>& x, double value)
+{
+    double old = x.load(std::memory_order_relaxed);
+    while (!x.compare_exchange_weak(old, old + value, std::memory_order_relaxed)) {}
+}
+
+static void requireUndirected(const CSRGraph& g, const char* message)
+{
+    if (g.IsDirected())
+        throw std::invalid_argument(message);
+}
+
+// Size of the intersection of two strictly increasing arrays.
+static std::int64_t intersectCount(const int* a, size_t na, const int* b, size_t nb)
+{
+    if (na > nb)
+    {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    std::int64_t count = 0;
+    size_t i = 0, j = 0;
+
+    // Very different lengths: binary search the short list in the long one.
+    if (na * 32 < nb)
+    {
+        const int* lo = b;
+        const int* end = b + nb;
+        for (; i < na && lo != end; i++)
+        {
+            lo = std::lower_bound(lo, end, a[i]);
+            if (lo != end && *lo == a[i])
+                count++;
+        }
+        return count;
+    }
+
+#if defined(__SSE2__)
+    // Compare four elements of a against all four rotations of four elements of b,
+    // then advance the block whose last element is smaller (or both).
+    static const int bits[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+    while (i + 4 <= na && j + 4 <= nb)
+    {
+        __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+        __m128i eq = _mm_cmpeq_epi32(va, vb);
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+        eq = _mm_or_si128(eq, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+        count += bits[_mm_movemask_ps(_mm_castsi128_ps(eq))];
+
+        int lastA = a[i + 3], lastB = b[j + 3];
+        if (lastA <= lastB)
+            i += 4;
+        if (lastB <= lastA)
+            j += 4;
+    }
+#endif
+
+    // Scalar merge for the rest.
+    while (i < na && j < nb)
+    {
+        if (a[i] < b[j])
+            i++;
+        else if (b[j] < a[i])
+            j++;
+        else
+        {
+            count++;
+            i++;
+            j++;
+        }
+    }
+    return count;
+}
+
+// ================================
+// PageRank
+// ================================
+
+PageRankResult GraphAnalytics::PageRank(const CSRGraph& g, double damping, double tolerance,
+                                        int maxIterations, PageRankMode mode)
+{
+    if (damping < 0 || damping >= 1)
+        throw std::invalid_argument("Damping factor must be in [0, 1).");
+    if (!(tolerance > 0))
+        throw std::invalid_argument("Tolerance must be positive.");
+    if (maxIterations < 0)
+        throw std::invalid_argument("Number of iterations must be non-negative.");
+
+    int n = g.NumberOfNodes();
+    PageRankResult result{std::vector<double>(), 0, 0.0};
+    if (n == 0)
+        return result;
+
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    int threads = Parallel::ThreadCount();
+    std::vector<double> partial(threads);
+
+    auto sumPartial = [&](int blocks)
+    {
+        double s = 0;
+        for (int b = 0; b < blocks; b++)
+            s += partial[b];
+        return s;
+    };
+
+    if (mode == PageRankMode::PULL)
+    {
+        const std::vector<int>& inOffset = g.InOffsets();
+        const std::vector<int>& source = g.Sources();
+        std::vector<double> rank(n, 1.0 / n), next(n), contribution(n);
+
+        for (result.iterations = 0; result.iterations < maxIterations; )
+        {
+            // Contribution per out-arc, and the rank sitting on dangling vertices.
+            int blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+            {
+                double dangling = 0;
+                for (size_t u = lo; u < hi; u++)
+                {
+                    int degree = offset[u + 1] - offset[u];
+                    contribution[u] = degree > 0 ? rank[u] / degree : 0.0;
+                    if (degree == 0)
+                        dangling += rank[u];
+                }
+                partial[b] = dangling;
+            });
+            double base = (1 - damping) / n + damping * sumPartial(blocks) / n;
+
+            blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+            {
+                double change = 0;
+                for (size_t v = lo; v < hi; v++)
+                {
+                    double sum = 0;
+                    for (int j = inOffset[v]; j < inOffset[v + 1]; j++)
+                        sum += contribution[source[j]];
+                    next[v] = base + damping * sum;
+                    change += std::fabs(next[v] - rank[v]);
+                }
+                partial[b] = change;
+            });
+            rank.swap(next);
+            result.iterations++;
+            result.error = sumPartial(blocks);
+            if (result.error < tolerance)
+                break;
+        }
+        result.rank.swap(rank);
+        return result;
+    }
+
+    // PUSH: with x_0 uniform, x_{k+1} - x_k = d M (x_k - x_{k-1}), so the changes
+    // themselves can be propagated. residual[u] is the change of u's rank not yet
+    // applied; applying it forwards d times that change along u's out-arcs.
+    double threshold = tolerance / n;
+    std::vector<double> rank(n, 1.0 / n), residual(n, 0.0);
+    std::vector<std::atomic<double>> incoming(n);
+    Parallel::For(0, n, [&](size_t v) { incoming[v].store(0.0, std::memory_order_relaxed); });
+    std::vector<int> active(threads);
+
+    // Forward d * amount from u; dangling vertices forward to everybody.
+    auto scatter = [&](size_t u, double amount, double& spread)
+    {
+        int degree = offset[u + 1] - offset[u];
+        if (degree == 0)
+        {
+            spread += damping * amount;
+            return;
+        }
+        double share = damping * amount / degree;
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            atomicAdd(incoming[target[j]], share);
+    };
+
+    // First round, dense: residual = x_1 - x_0.
+    int blocks = 0;
+    double uniform = 0;
+    if (maxIterations > 0)
+    {
+        blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+        {
+            double spread = 0;
+            for (size_t u = lo; u < hi; u++)
+                scatter(u, rank[u], spread);
+            partial[b] = spread;
+        }, 1024);
+        uniform = sumPartial(blocks) / n;
+        Parallel::For(0, n, [&](size_t v)
+        {
+            residual[v] = (1 - damping) / n + incoming[v].load(std::memory_order_relaxed) + uniform - rank[v];
+            incoming[v].store(0.0, std::memory_order_relaxed);
+        });
+        result.iterations = 1;
+    }
+
+    while (result.iterations < maxIterations)
+    {
+        blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+        {
+            double spread = 0;
+            int count = 0;
+            for (size_t u = lo; u < hi; u++)
+            {
+                double r = residual[u];
+                if (std::fabs(r) <= threshold)
+                    continue;
+                count++;
+                residual[u] = 0;
+                rank[u] += r;
+                scatter(u, r, spread);
+            }
+            partial[b] = spread;
+            active[b] = count;
+        }, 1024);
+
+        int moved = 0;
+        for (int b = 0; b < blocks; b++)
+            moved += active[b];
+        if (moved == 0)
+            break;
+        result.iterations++;
+
+        uniform = sumPartial(blocks) / n;
+        Parallel::For(0, n, [&](size_t v)
+        {
+            residual[v] += incoming[v].load(std::memory_order_relaxed) + uniform;
+            incoming[v].store(0.0, std::memory_order_relaxed);
+        });
+    }
+
+    // Apply what was left below the threshold.
+    blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+    {
+        double left = 0;
+        for (size_t v = lo; v < hi; v++)
+        {
+            left += std::fabs(residual[v]);
+            rank[v] += residual[v];
+        }
+        partial[b] = left;
+    });
+    result.error = sumPartial(blocks);
+    result.rank.swap(rank);
+    return result;
+}
+
+// ================================
+// Triangle Counting
+// ================================
+
+std::int64_t GraphAnalytics::TriangleCount(const CSRGraph& g)
+{
+    requireUndirected(g, "Triangle counting requires an undirected graph.");
+
+    int n = g.NumberOfNodes();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
+    // u precedes v if it has the smaller degree, or the same degree and a smaller index.
+    auto before = [&](int u, int v)
+    {
+        int du = offset[u + 1] - offset[u], dv = offset[v + 1] - offset[v];
+        return du < dv || (du == dv && u < v);
+    };
+
+    // Oriented adjacency: the later neighbors of every vertex, sorted and without duplicates.
+    std::vector<int> start(n + 1, 0);
+    Parallel::For(0, n, [&](size_t u)
+    {
+        int c = 0;
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            if (before(static_cast<int>(u), target[j]))
+                c++;
+        start[u + 1] = c;
+    });
+    for (int u = 0; u < n; u++)
+        start[u + 1] += start[u];
+
+    std::vector<int> later(start[n]);
+    std::vector<int> length(n);
+    Parallel::For(0, n, [&](size_t u)
+    {
+        int k = start[u];
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            if (before(static_cast<int>(u), target[j]))
+                later[k++] = target[j];
+        std::sort(later.begin() + start[u], later.begin() + k);
+        length[u] = static_cast<int>(std::unique(later.begin() + start[u], later.begin() + k) - (later.begin() + start[u]));
+    });
+
+    // Split the vertices into chunks of about equal oriented arc count.
+    int chunks = std::max(1, std::min(n, 8 * Parallel::ThreadCount()));
+    std::vector<int> bound(chunks + 1, n);
+    bound[0] = 0;
+    for (int c = 1; c < chunks; c++)
+    {
+        long long arcs = static_cast<long long>(start[n]) * c / chunks;
+        bound[c] = static_cast<int>(std::lower_bound(start.begin(), start.end(), arcs) - start.begin());
+        bound[c] = std::min(std::max(bound[c], bound[c - 1]), n);
+    }
+
+    std::vector<std::int64_t> count(chunks, 0);
+    Parallel::For(0, chunks, [&](size_t c)
+    {
+        std::int64_t t = 0;
+        for (int u = bound[c]; u < bound[c + 1]; u++)
+        {
+            const int* nu = later.data() + start[u];
+            for (int j = 0; j < length[u]; j++)
+            {
+                int v = nu[j];
+                t += intersectCount(nu, length[u], later.data() + start[v], length[v]);
+            }
+        }
+        count[c] = t;
+    }, 1);
+
+    std::int64_t total = 0;
+    for (std::int64_t t : count)
+        total += t;
+    return total;
+}
+
+// ================================
+// k-Core Decomposition
+// ================================
+
+std::vector<int> GraphAnalytics::CoreNumbers(const CSRGraph& g)
+{
+    requireUndirected(g, "k-core decomposition requires an undirected graph.");
+
+    int n = g.NumberOfNodes();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
+    std::vector<int> degree(n);
+    int maxDegree = 0;
+    for (int u = 0; u < n; u++)
+    {
+        int d = 0;
+        for (int j = offset[u]; j < offset[u + 1]; j++)
+            if (target[j] != u)
+                d++;
+        degree[u] = d;
+        maxDegree = std::max(maxDegree, d);
+    }
+
+    if (n + g.NumberOfArcs() < CORE_PEELING_CUTOFF || Parallel::ThreadCount() == 1)
+    {
+        // Batagelj-Zaversnik: vertices bucket-sorted by current degree; the smallest
+        // one is removed and each later neighbor moves down one bucket in O(1).
+        std::vector<int> bin(maxDegree + 2, 0), pos(n), vert(n);
+        for (int u = 0; u < n; u++)
+            bin[degree[u] + 1]++;
+        for (int d = 0; d <= maxDegree; d++)
+            bin[d + 1] += bin[d];
+        std::vector<int> fill(bin.begin(), bin.end() - 1);
+        for (int u = 0; u < n; u++)
+        {
+            pos[u] = fill[degree[u]]++;
+            vert[pos[u]] = u;
+        }
+
+        for (int i = 0; i < n; i++)
+        {
+            int v = vert[i];
+            for (int j = offset[v]; j < offset[v + 1]; j++)
+            {
+                int u = target[j];
+                if (degree[u] <= degree[v])
+                    continue;
+                // Swap u with the first vertex of its bucket, then shrink the bucket.
+                int du = degree[u];
+                int pw = bin[du];
+                int w = vert[pw];
+                if (u != w)
+                {
+                    vert[pos[u]] = w;
+                    pos[w] = pos[u];
+                    vert[pw] = u;
+                    pos[u] = pw;
+                }
+                bin[du]++;
+                degree[u]--;
+            }
+        }
+        return degree;
+    }
+
+    // Parallel peeling. remaining holds the live vertices, all of degree > k.
+    std::vector<std::atomic<int>> current(n);
+    std::vector<int> core(n, -1);   // -1 while the vertex is alive.
+    Parallel::For(0, n, [&](size_t u) { current[u].store(degree[u], std::memory_order_relaxed); });
+
+    int threads = Parallel::ThreadCount();
+    std::vector<std::vector<int>> part(threads);
+    auto gather = [&](int blocks)
+    {
+        std::vector<int> out;
+        for (int b = 0; b < blocks; b++)
+            out.insert(out.end(), part[b].begin(), part[b].end());
+        return out;
+    };
+
+    std::vector<int> remaining(n);
+    for (int u = 0; u < n; u++)
+        remaining[u] = u;
+    std::vector<int> lowest(threads);
+    int k = 0;
+
+    while (!remaining.empty())
+    {
+        int blocks = Parallel::ForBlocks(0, remaining.size(), [&](size_t lo, size_t hi, int b)
+        {
+            int m = INT32_MAX;
+            for (size_t i = lo; i < hi; i++)
+                m = std::min(m, current[remaining[i]].load(std::memory_order_relaxed));
+            lowest[b] = m;
+        });
+        k = std::max(k, *std::min_element(lowest.begin(), lowest.begin() + blocks));
+
+        // Split off the vertices of degree <= k.
+        blocks = Parallel::ForBlocks(0, remaining.size(), [&](size_t lo, size_t hi, int b)
+        {
+            part[b].clear();
+            for (size_t i = lo; i < hi; i++)
+                if (current[remaining[i]].load(std::memory_order_relaxed) <= k)
+                    part[b].push_back(remaining[i]);
+        });
+        std::vector<int> frontier = gather(blocks);
+
+        // Peel: every vertex whose degree falls to exactly k joins the next frontier once.
+        while (!frontier.empty())
+        {
+            for (int u : frontier)
+                core[u] = k;
+            blocks = Parallel::ForBlocks(0, frontier.size(), [&](size_t lo, size_t hi, int b)
+            {
+                part[b].clear();
+                for (size_t i = lo; i < hi; i++)
+                {
+                    int u = frontier[i];
+                    for (int j = offset[u]; j < offset[u + 1]; j++)
+                    {
+                        int v = target[j];
+                        if (v == u || core[v] != -1)
+                            continue;
+                        if (current[v].fetch_sub(1, std::memory_order_relaxed) == k + 1)
+                            part[b].push_back(v);
+                    }
+                }
+            }, 256);
+            frontier = gather(blocks);
+        }
+
+        blocks = Parallel::ForBlocks(0, remaining.size(), [&](size_t lo, size_t hi, int b)
+        {
+            part[b].clear();
+            for (size_t i = lo; i < hi; i++)
+                if (core[remaining[i]] == -1)
+                    part[b].push_back(remaining[i]);
+        });
+        remaining = gather(blocks);
+    }
+    return core;
+}
+
+// ================================
+// Label Propagation
+// ================================
+
+std::vector<int> GraphAnalytics::LabelPropagation(const CSRGraph& g, int maxIterations)
+{
+    requireUndirected(g, "Label propagation requires an undirected graph.");
+    if (maxIterations < 0)
+        throw std::invalid_argument("Number of iterations must be non-negative.");
+
+    int n = g.NumberOfNodes();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+
+    std::vector<int> label(n), next(n);
+    for (int u = 0; u < n; u++)
+        label[u] = u;
+    std::vector<char> moved(n, 1), nextMoved(n);  // 1 if the label changed in the last round.
+    std::vector<int> changed(Parallel::ThreadCount());
+
+    for (int it = 0; it < maxIterations; it++)
+    {
+        int blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+        {
+            std::vector<int> votes;
+            int c = 0;
+            for (size_t u = lo; u < hi; u++)
+            {
+                // Only vertices next to a change can change.
+                bool stale = moved[u];
+                for (int j = offset[u]; j < offset[u + 1] && !stale; j++)
+                    stale = moved[target[j]];
+                next[u] = label[u];
+                nextMoved[u] = 0;
+                if (!stale)
+                    continue;
+
+                // The labels of the neighbors plus the vertex's own, sorted so equal labels are adjacent.
+                votes.clear();
+                votes.push_back(label[u]);
+                for (int j = offset[u]; j < offset[u + 1]; j++)
+                    if (target[j] != static_cast<int>(u))
+                        votes.push_back(label[target[j]]);
+                std::sort(votes.begin(), votes.end());
+
+                int best = votes[0], bestCount = 0;
+                for (size_t i = 0; i < votes.size(); )
+                {
+                    size_t r = i;
+                    while (r < votes.size() && votes[r] == votes[i])
+                        r++;
+                    if (static_cast<int>(r - i) > bestCount)
+                    {
+                        best = votes[i];
+                        bestCount = static_cast<int>(r - i);
+                    }
+                    i = r;
+                }
+                if (best != label[u])
+                {
+                    next[u] = best;
+                    nextMoved[u] = 1;
+                    c++;
+                }
+            }
+            changed[b] = c;
+        }, 1024);
+
+        label.swap(next);
+        moved.swap(nextMoved);
+        int total = 0;
+        for (int b = 0; b < blocks; b++)
+            total += changed[b];
+        if (total == 0)
+            break;
+    }
+    return label;
+}
+
+// ================================
+// Connected Components
+// ================================
+
+std::vector<int> GraphAnalytics::ConnectedComponents(const CSRGraph& g)
+{
+    int n = g.NumberOfNodes();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    UnionFind uf(n);
+
+    // Unite every vertex with its first neighbors; on most graphs this already
+    // gathers the bulk of the largest component.
+    for (int r = 0; r < COMPONENT_SAMPLED_NEIGHBORS; r++)
+        Parallel::For(0, n, [&](size_t u)
+        {
+            if (offset[u] + r < offset[u + 1])
+                uf.Unite(static_cast<int>(u), target[offset[u] + r]);
+        }, 1 << 12);
+
+    // The most frequent representative among evenly spaced sample vertices.
+    int largest = -1;
+    if (n > 0)
+    {
+        const int samples = std::min(n, 1024);
+        std::vector<int> sample(samples);
+        for (int i = 0; i < samples; i++)
+            sample[i] = uf.Find(static_cast<int>(static_cast<long long>(i) * n / samples));
+        std::sort(sample.begin(), sample.end());
+        int run = 0, longest = 0;
+        for (int i = 0; i < samples; i++)
+        {
+            run = (i > 0 && sample[i] == sample[i - 1]) ? run + 1 : 1;
+            if (run > longest)
+            {
+                longest = run;
+                largest = sample[i];
+            }
+        }
+    }
+
+    // The remaining arcs only matter for vertices outside that component: an arc
+    // from inside it is seen from its other end. Directed graphs store the arcs
+    // once, so those vertices also scan their in-arcs.
+    const std::vector<int>& inOffset = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+    bool directed = g.IsDirected();
+    Parallel::For(0, n, [&](size_t i)
+    {
+        int u = static_cast<int>(i);
+        if (uf.Find(u) == largest)
+            return;
+        for (int j = offset[u] + COMPONENT_SAMPLED_NEIGHBORS; j < offset[u + 1]; j++)
+            uf.Unite(u, target[j]);
+        if (directed)
+            for (int j = inOffset[u]; j < inOffset[u + 1]; j++)
+                uf.Unite(u, source[j]);
+    }, 1 << 10);
+
+    // Label every component with its smallest vertex.
+    std::vector<int> root = uf.Representatives();
+    std::unique_ptr<std::atomic<int>[]> smallest(new std::atomic<int>[n]);
+    Parallel::For(0, n, [&](size_t v) { smallest[v].store(n, std::memory_order_relaxed); }, 1 << 16);
+    Parallel::For(0, n, [&](size_t v)
+    {
+        std::atomic<int>& slot = smallest[root[v]];
+        int current = slot.load(std::memory_order_relaxed);
+        while (static_cast<int>(v) < current && !slot.compare_exchange_weak(current, static_cast<int>(v), std::memory_order_relaxed)) {}
+    }, 1 << 14);
+    std::vector<int> label(n);
+    Parallel::For(0, n, [&](size_t v) { label[v] = smallest[root[v]].load(std::memory_order_relaxed); }, 1 << 16);
+    return label;
+}
+
+// ================================
+// Multi-Source BFS
+// ================================
+
+// One bit per search of a batch: WORDS 64-bit words per vertex.
+template <int WORDS>
+struct LaneSet
+{
+    std::uint64_t word[WORDS];
+};
+
+static inline int lowestLane(std::uint64_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#else
+    int b = 0;
+    while (!(x & 1))
+    {
+        x >>= 1;
+        b++;
+    }
+    return b;
+#endif
+}
+
+// result = (OR of frontier[heads[0..degree)]) & ~seen; returns whether any bit is set.
+template <int WORDS>
+static inline bool gatherLanes(const LaneSet<WORDS>* frontier, const int* heads, int degree,
+                               const LaneSet<WORDS>& seen, LaneSet<WORDS>& result)
+{
+#if defined(__SSE2__)
+    if constexpr (WORDS % 2 == 0)
+    {
+        __m128i acc[WORDS / 2];
+        for (int k = 0; k < WORDS / 2; k++)
+            acc[k] = _mm_setzero_si128();
+        for (int i = 0; i < degree; i++)
+        {
+            const __m128i* lanes = reinterpret_cast<const __m128i*>(frontier[heads[i]].word);
+            for (int k = 0; k < WORDS / 2; k++)
+                acc[k] = _mm_or_si128(acc[k], _mm_loadu_si128(lanes + k));
+        }
+        __m128i any = _mm_setzero_si128();
+        const __m128i* mask = reinterpret_cast<const __m128i*>(seen.word);
+        for (int k = 0; k < WORDS / 2; k++)
+        {
+            acc[k] = _mm_andnot_si128(_mm_loadu_si128(mask + k), acc[k]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(result.word) + k, acc[k]);
+            any = _mm_or_si128(any, acc[k]);
+        }
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(any, _mm_setzero_si128())) != 0xFFFF;
+    }
+#endif
+    std::uint64_t any = 0;
+    for (int k = 0; k < WORDS; k++)
+        result.word[k] = 0;
+    for (int i = 0; i < degree; i++)
+        for (int k = 0; k < WORDS; k++)
+            result.word[k] |= frontier[heads[i]].word[k];
+    for (int k = 0; k < WORDS; k++)
+    {
+        result.word[k] &= ~seen.word[k];
+        any |= result.word[k];
+    }
+    return any != 0;
+}
+
+// Searches from sources[first .. first+count) in one batch; count <= 64 * WORDS.
+template <int WORDS>
+static void multiSourceBatch(const CSRGraph& g, const std::vector<int>& sources, size_t first, int count,
+                             bool keepDistances, MultiSourceBFSResult& result)
+{
+    const int n = g.NumberOfNodes();
+    const std::vector<int>& offset = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<int>& inOffset = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+
+    // Value-initialized, i.e. all bits clear.
+    std::vector<LaneSet<WORDS>> seen(n), visit(n), next(n);
+    LaneSet<WORDS> all = {};
+    for (int lane = 0; lane < count; lane++)
+        all.word[lane / 64] |= std::uint64_t(1) << (lane % 64);
+    auto isAll = [&](const LaneSet<WORDS>& lanes)
+    {
+        for (int k = 0; k < WORDS; k++)
+            if (lanes.word[k] != all.word[k])
+                return false;
+        return true;
+    };
+
+    std::vector<int> frontier;
+    for (int lane = 0; lane < count; lane++)
+    {
+        int s = sources[first + lane];
+        std::uint64_t bit = std::uint64_t(1) << (lane % 64);
+        bool fresh = true;
+        for (int k = 0; k < WORDS; k++)
+            fresh = fresh && visit[s].word[k] == 0;
+        if (fresh)
+            frontier.push_back(s);
+        seen[s].word[lane / 64] |= bit;
+        visit[s].word[lane / 64] |= bit;
+        if (keepDistances)
+            result.distance[first + lane][s] = 0;
+    }
+
+    const std::int64_t arcs = g.NumberOfArcs();
+    const int workers = Parallel::ThreadCount();
+    std::vector<std::vector<int>> found(workers);
+    std::vector<std::vector<std::int64_t>> laneCount(workers, std::vector<std::int64_t>(64 * WORDS, 0));
+    std::vector<int> nextFrontier;
+    for (int level = 1; !frontier.empty(); level++)
+    {
+        std::int64_t frontierArcs = 0;
+        for (int u : frontier)
+            frontierArcs += offset[u + 1] - offset[u];
+
+        nextFrontier.clear();
+        if (frontierArcs * GraphAnalytics::MSBFS_PUSH_FACTOR < arcs)
+        {
+            // Few arcs leave the frontier: push its bits along them. A vertex joins
+            // the next frontier when it first receives a bit it has not seen.
+            for (int u : frontier)
+                for (int i = offset[u]; i < offset[u + 1]; i++)
+                {
+                    LaneSet<WORDS>& lanes = next[target[i]];
+                    std::uint64_t before = 0, after = 0;
+                    for (int k = 0; k < WORDS; k++)
+                    {
+                        before |= lanes.word[k];
+                        lanes.word[k] |= visit[u].word[k] & ~seen[target[i]].word[k];
+                        after |= lanes.word[k];
+                    }
+                    if (before == 0 && after != 0)
+                        nextFrontier.push_back(target[i]);
+                }
+            std::sort(nextFrontier.begin(), nextFrontier.end());
+        }
+        else
+        {
+            // Every vertex not yet seen by all searches pulls the frontier bits of its in-neighbors.
+            int blocks = Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int b)
+            {
+                found[b].clear();
+                for (size_t v = lo; v < hi; v++)
+                {
+                    if (isAll(seen[v]))
+                        continue;
+                    if (gatherLanes<WORDS>(visit.data(), source.data() + inOffset[v], inOffset[v + 1] - inOffset[v], seen[v], next[v]))
+                        found[b].push_back(static_cast<int>(v));
+                }
+            }, 1024);
+            for (int b = 0; b < blocks; b++)
+                nextFrontier.insert(nextFrontier.end(), found[b].begin(), found[b].end());
+        }
+
+        // Mark the new bits as seen and record them, per block, then add up the counts.
+        int blocks = Parallel::ForBlocks(0, nextFrontier.size(), [&](size_t lo, size_t hi, int b)
+        {
+            std::vector<std::int64_t>& counted = laneCount[b];
+            for (size_t j = lo; j < hi; j++)
+            {
+                int x = nextFrontier[j];
+                for (int k = 0; k < WORDS; k++)
+                {
+                    std::uint64_t bits = next[x].word[k];
+                    seen[x].word[k] |= bits;
+                    for (; bits != 0; bits &= bits - 1)
+                    {
+                        int lane = k * 64 + lowestLane(bits);
+                        counted[lane]++;
+                        if (keepDistances)
+                            result.distance[first + lane][x] = level;
+                    }
+                }
+            }
+        }, 1024);
+        for (int lane = 0; lane < count; lane++)
+        {
+            std::int64_t reached = 0;
+            for (int b = 0; b < blocks; b++)
+            {
+                reached += laneCount[b][lane];
+                laneCount[b][lane] = 0;
+            }
+            if (reached > 0)
+            {
+                result.reached[first + lane] += static_cast<int>(reached);
+                result.distanceSum[first + lane] += reached * level;
+                result.eccentricity[first + lane] = level;
+            }
+        }
+
+        // Clear the old frontier; the new one becomes current.
+        for (int u : frontier)
+            visit[u] = LaneSet<WORDS>();
+        visit.swap(next);
+        frontier.swap(nextFrontier);
+    }
+}
+
+MultiSourceBFSResult GraphAnalytics::MultiSourceBFS(const CSRGraph& g, const std::vector<int>& sources, bool keepDistances)
+{
+    const int n = g.NumberOfNodes();
+    for (int s : sources)
+        if (s < 0 || s >= n)
+            throw std::out_of_range("Source vertex out of range.");
+
+    MultiSourceBFSResult result;
+    result.sources = sources;
+    result.reached.assign(sources.size(), 1);
+    result.distanceSum.assign(sources.size(), 0);
+    result.eccentricity.assign(sources.size(), 0);
+    if (keepDistances)
+        result.distance.assign(sources.size(), std::vector<int>(n, -1));
+
+    for (size_t first = 0; first < sources.size(); first += MSBFS_LANES)
+    {
+        int count = static_cast<int>(std::min<size_t>(MSBFS_LANES, sources.size() - first));
+        if (count <= 64)
+            multiSourceBatch<1>(g, sources, first, count, keepDistances, result);
+        else
+            multiSourceBatch<MSBFS_LANES / 64>(g, sources, first, count, keepDistances, result);
+    }
+    return result;
+}
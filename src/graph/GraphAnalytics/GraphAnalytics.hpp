@@ -0,0 +1,177 @@
+#ifndef GRAPHANALYTICS
+#define GRAPHANALYTICS
+
+#include <vector>
+#include <cstdint>
+
+#include "../CSRGraph/CSRGraph.hpp"
+
+/**
+ * @brief Parallel whole-graph analytics on a compressed adjacency.
+ *
+ * Every kernel takes a CSRGraph, e.g. Graph::Compressed(), and returns per-vertex
+ * results indexed by CSR vertex, which for a Graph is the position of the node in
+ * Graph::Nodes(). The work is split over Parallel::ThreadCount() threads.
+ *
+ * - PageRank:          power iteration (pull) or change propagation (push).
+ * - TriangleCount:     degree-ordered orientation with vectorized sorted-list intersection.
+ * - CoreNumbers:       k-core decomposition by parallel peeling.
+ * - LabelPropagation:  community detection by synchronous label propagation.
+ * - ConnectedComponents: sampled linking on a lock-free UnionFind.
+ * - MultiSourceBFS:    up to 256 breadth-first searches at once on bit-parallel frontiers.
+ *
+ * Edge weights are ignored by all of them.
+ */
+
+// Selects how PageRank moves rank along the arcs.
+enum class PageRankMode
+{
+    PULL,   // Every vertex sums the contributions of its in-neighbors; no atomics.
+    PUSH    // Vertices with a large pending rank change scatter it to their out-neighbors.
+};
+
+struct PageRankResult
+{
+    std::vector<double> rank;   // PageRank of every vertex; the ranks sum to 1.
+    int iterations;             // Rounds executed.
+    double error;               // L1 change of the last round (PULL) or of the changes left unpropagated (PUSH).
+};
+
+/**
+ * @brief Hop distances and per-source statistics of a multi-source BFS.
+ *
+ * Row i belongs to the i-th source as given. distance is only filled if it was
+ * requested; the statistics are always computed and are what closeness and
+ * reachability features need.
+ */
+struct MultiSourceBFSResult
+{
+    std::vector<int> sources;                   // The source vertices, in the order given.
+    std::vector<std::vector<int>> distance;     // distance[i][v]: hops from sources[i] to v, -1 if unreachable.
+    std::vector<int> reached;                   // Vertices reached from each source, the source included.
+    std::vector<std::int64_t> distanceSum;      // Sum of the hop distances to the reached vertices.
+    std::vector<int> eccentricity;              // Largest hop distance from each source.
+};
+
+class GraphAnalytics
+{
+    public:
+        /**
+         * @brief PageRank with damping factor damping.
+         *
+         * Rank on vertices without out-arcs is spread uniformly over all vertices.
+         * PULL runs Jacobi power iterations over the in-arcs until the L1 change of a
+         * round drops below tolerance. PUSH propagates rank changes instead of ranks:
+         * in every round, each vertex whose pending change exceeds tolerance / n applies
+         * it and forwards damping times the change to its out-neighbors with atomic
+         * adds. It stops once no vertex is active, so later rounds only touch the part
+         * of the graph that is still changing; PULL is faster while most vertices are.
+         *
+         * @param g The graph; undirected edges count in both directions.
+         * @param damping Probability of following an arc (default 0.85).
+         * @param tolerance Convergence threshold on the L1 norm (default 1e-6).
+         * @param maxIterations Upper bound on the number of rounds (default 100).
+         * @param mode PULL (default) or PUSH.
+         * @return The ranks, the rounds used and the remaining error.
+         */
+        static PageRankResult PageRank(const CSRGraph& g, double damping = 0.85, double tolerance = 1e-6,
+                                       int maxIterations = 100, PageRankMode mode = PageRankMode::PULL);
+
+        /**
+         * @brief Count the triangles of an undirected graph.
+         *
+         * Every edge is oriented from the endpoint of lower degree to the one of
+         * higher degree (ties broken by index), which bounds every out-list by
+         * O(sqrt(E)). Each oriented arc u -> v then adds |N+(u) ∩ N+(v)|, computed
+         * with an SSE2 block intersection where available. Self-loops and parallel
+         * edges are ignored.
+         *
+         * @param g An undirected graph.
+         * @return The number of triangles.
+         * @throws std::invalid_argument if g is directed.
+         */
+        static std::int64_t TriangleCount(const CSRGraph& g);
+
+        /**
+         * @brief Core number of every vertex (k-core decomposition).
+         *
+         * The core number of v is the largest k such that v belongs to a subgraph in
+         * which every vertex has degree at least k. Vertices are peeled level by level:
+         * all vertices of degree at most k are removed together, in parallel, and the
+         * degrees of their neighbors are decremented atomically. Graphs below
+         * CORE_PEELING_CUTOFF vertices plus arcs, or a single thread, use the
+         * sequential O(V + E) bucket algorithm of Batagelj and Zaversnik instead.
+         * Self-loops are ignored; parallel edges count once each.
+         *
+         * @param g An undirected graph.
+         * @return The core number of every vertex.
+         * @throws std::invalid_argument if g is directed.
+         */
+        static std::vector<int> CoreNumbers(const CSRGraph& g);
+
+        static const int CORE_PEELING_CUTOFF = 1 << 15;    // Smaller graphs are peeled sequentially.
+
+        /**
+         * @brief Detect communities by label propagation.
+         *
+         * Every vertex starts with its own index as label. In each round, all vertices
+         * adopt, in parallel, the label that is most frequent among their neighbors
+         * and themselves, preferring the smallest label on ties; counting the vertex
+         * itself keeps the synchronous rounds from oscillating. Only vertices next to a
+         * label change of the previous round are re-evaluated. Stops when no label
+         * changes or after maxIterations rounds.
+         *
+         * @param g An undirected graph.
+         * @param maxIterations Upper bound on the number of rounds (default 20).
+         * @return The label of every vertex; vertices with equal labels form a community.
+         * @throws std::invalid_argument if g is directed.
+         */
+        static std::vector<int> LabelPropagation(const CSRGraph& g, int maxIterations = 20);
+
+        /**
+         * @brief Connected components; weakly connected components of a directed graph.
+         *
+         * All vertices are first united, in parallel, with their first
+         * COMPONENT_SAMPLED_NEIGHBORS neighbors on a lock-free UnionFind, which usually
+         * gathers most of the largest component. A sample of vertices then identifies
+         * that component, and only the vertices outside it unite along their remaining
+         * arcs (and in-arcs, for directed graphs), so the edges inside the largest
+         * component are mostly never touched.
+         *
+         * @param g The graph.
+         * @return The label of every vertex: the smallest vertex of its component.
+         */
+        static std::vector<int> ConnectedComponents(const CSRGraph& g);
+
+        static const int COMPONENT_SAMPLED_NEIGHBORS = 2;  // Neighbors united before sampling.
+
+        /**
+         * @brief Breadth-first searches from many sources in one sweep (MS-BFS).
+         *
+         * The sources are processed in batches of up to MSBFS_LANES. Every vertex
+         * keeps one bit per search of the batch in each of three bitsets: seen,
+         * the current frontier and the next one. A level then costs one pass for
+         * all searches together. Each vertex ORs the frontier bits of its in-neighbors
+         * and masks out the bits it has already seen, using 64-bit words, or SSE2
+         * registers where available. Small frontiers are pushed along their out-arcs
+         * instead. Batches of at most 64 sources use one word per vertex. A level
+         * touches each arc once for the whole batch, where looping single-source
+         * BFS touches it once per source; large levels run on all threads.
+         *
+         * Arcs are followed forward, so on directed graphs the distances are from
+         * the sources. Repeated sources are searched repeatedly.
+         *
+         * @param g The graph.
+         * @param sources Source vertices.
+         * @param keepDistances If false, only the per-source statistics are returned,
+         *        which saves sources.size() * n ints of memory.
+         * @return Distances (if kept) and statistics of every source.
+         * @throws std::out_of_range if a source is not a vertex of g.
+         */
+        static MultiSourceBFSResult MultiSourceBFS(const CSRGraph& g, const std::vector<int>& sources, bool keepDistances = true);
+
+        static const int MSBFS_LANES = 256;         // Searches per batch.
+        static const int MSBFS_PUSH_FACTOR = 16;    // Push while the frontier has fewer than arcs / factor out-arcs.
+};
+
+#endif
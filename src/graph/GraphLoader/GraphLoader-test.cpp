@@ -0,0 +1,192 @@
+// GraphLoader-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread GraphLoader.cpp GraphLoader-test.cpp\
+    ../Graph/Graph.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../VertexQueue/VertexQueue.cpp\
+    ../Parallel/Parallel.cpp\
+    ../DistanceMatrix/DistanceMatrix.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../GraphView/GraphView.cpp\
+    ../EdgeStore/EdgeStore.cpp\
+    ../GraphAnalytics/GraphAnalytics.cpp\
+    ../GraphOrdering/GraphOrdering.cpp\
+    ../GraphPartitioner/GraphPartitioner.cpp\
+    ../FlowNetwork/FlowNetwork.cpp\
+    ../../array/GeneralArray/GeneralArray.cpp\
+    ../../array/SparseMatrix/SparseMatrix.cpp\
+    ../../chain/Node/Node.cpp\
+    ../../chain/DoubleNode/DoubleNode.cpp\
+    ../../chain/ChainIterator/ChainIterator.cpp\
+    ../../chain/DLIterator/DLIterator.cpp\
+    ../../chain/DoublyLinkedList/DoublyLinkedList.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedMatrixTerm.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedSparseMatrix.cpp -o test
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <string>
+#include <stdexcept>
+#include "GraphLoader.hpp"
+#include "../Graph/Graph.hpp"
+
+using namespace std;
+
+static void PrintEdges(const char* name, const EdgeArray& edges)
+{
+    cout << name << " (" << edges.source.size() << " edges):";
+    for (size_t i = 0; i < edges.source.size(); i++)
+    {
+        cout << " {" << edges.source[i] << ", " << edges.target[i];
+        if (!edges.weight.empty())
+            cout << ", " << edges.weight[i];
+        cout << "}";
+    }
+    cout << endl;
+}
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // Binary round trip.
+    // ---------------------------------------------------------------
+    EdgeArray edges;
+    edges.source = {10, 20, 30, 10, 20, 40};
+    edges.target = {20, 30, 10, 20, 10, 50};
+    edges.weight = {1.5, 2.0, 4.0, 0.5, 3.0, 7.0};
+
+    GraphLoader::WriteBinary("edges.bin", edges, WeightFormat::FLOAT64);
+    EdgeArray binary = GraphLoader::ReadBinary("edges.bin", WeightFormat::FLOAT64);
+    PrintEdges("Binary (double weights)", binary);
+    assert(binary.source == edges.source && binary.target == edges.target && binary.weight == edges.weight);
+
+    GraphLoader::WriteBinary("edges.bin", edges, WeightFormat::NONE);
+    EdgeArray pattern = GraphLoader::ReadBinary("edges.bin", WeightFormat::NONE);
+    PrintEdges("Binary (no weights)", pattern);
+    assert(pattern.weight.empty());
+
+    // ---------------------------------------------------------------
+    // Sort and dedupe: {10,20} appears three times in an undirected graph.
+    // ---------------------------------------------------------------
+    EdgeArray sorted = binary;
+    GraphLoader::SortAndDedupe(sorted, false);
+    PrintEdges("Deduplicated (undirected)", sorted);
+    assert(sorted.source.size() == 4 && sorted.weight[0] == 0.5);
+
+    // The other aggregators merge the three weights 1.5, 0.5 and 3.0 of {10,20}.
+    EdgeAggregator aggregators[] = {EdgeAggregator::MAX, EdgeAggregator::SUM, EdgeAggregator::COUNT};
+    double merged[] = {3.0, 5.0, 3.0};
+    for (int k = 0; k < 3; k++)
+    {
+        EdgeArray grouped = binary;
+        GraphLoader::SortAndDedupe(grouped, false, aggregators[k]);
+        assert(grouped.source.size() == 4 && grouped.weight[0] == merged[k]);
+    }
+    EdgeArray counted = pattern;
+    GraphLoader::SortAndDedupe(counted, true, EdgeAggregator::COUNT);
+    PrintEdges("Counted (directed)", counted);
+    assert(counted.weight.size() == 5 && counted.weight[0] == 2);
+
+    // ---------------------------------------------------------------
+    // Bulk construction gives the same graph as AddEdge().
+    // ---------------------------------------------------------------
+    Graph bulk = Graph::FromEdges(binary, false);
+    Graph slow(vector<int>{10, 20, 30, 40, 50}, true, false);
+    slow.AddEdge(10, 20, 0.5);
+    slow.AddEdge(20, 30, 2.0);
+    slow.AddEdge(10, 30, 4.0);
+    slow.AddEdge(40, 50, 7.0);
+    cout << "Bulk graph: " << bulk << endl;
+    cout << "Nodes: " << bulk.NumberOfNodes() << ", edges: " << bulk.NumberOfEdges() << endl;
+    for (int node : bulk.Nodes())
+        assert(bulk.Degree(node) == slow.Degree(node));
+    ShortestPaths a = bulk.Dijkstra(10), b = slow.Dijkstra(10);
+    assert(a.distance == b.distance);
+    cout << "Dijkstra from 10:";
+    for (double d : a.distance)
+        cout << " " << d;
+    cout << endl << endl;
+
+    // ---------------------------------------------------------------
+    // SNAP text.
+    // ---------------------------------------------------------------
+    {
+        ofstream out("edges.txt");
+        out << "# Directed graph: example\n# FromNodeId\tToNodeId\n0\t1\n1\t2\n2\t0\n\n2\t3\n";
+    }
+    EdgeArray snap = GraphLoader::ReadSNAP("edges.txt");
+    PrintEdges("SNAP", snap);
+    Graph sg = Graph::FromEdges(snap, true);
+    cout << "SNAP graph BFS from 0:";
+    for (int v : sg.BFS(0, -1))
+        cout << " " << v;
+    cout << endl;
+
+    // ---------------------------------------------------------------
+    // Matrix Market.
+    // ---------------------------------------------------------------
+    {
+        ofstream out("edges.mtx");
+        out << "%%MatrixMarket matrix coordinate real symmetric\n% example\n5 5 4\n2 1 1.0\n3 2 2.5\n4 3 1.0\n1 4 9.0\n";
+    }
+    EdgeArray mtx = GraphLoader::ReadMatrixMarket("edges.mtx");
+    PrintEdges("Matrix Market", mtx);
+    Graph mg = Graph::FromEdges(mtx, !mtx.symmetric);
+    cout << "Matrix Market graph: " << mg.NumberOfNodes() << " nodes, " << mg.NumberOfEdges()
+         << " edges, degree of node 4 = " << mg.Degree(4) << endl;
+
+    // A banner followed only by blanks, with no final newline, filling a whole page.
+    {
+        ofstream out("edges.mtx");
+        string banner = "%%MatrixMarket matrix coordinate real general\n";
+        out << banner << string(4096 - banner.size(), ' ');
+    }
+    try
+    {
+        GraphLoader::ReadMatrixMarket("edges.mtx");
+        assert(false);
+    }
+    catch (const runtime_error& e)
+    {
+        assert(string(e.what()) == "Missing Matrix Market size line.");
+        cout << "Exception: " << e.what() << endl << endl;
+    }
+
+    // ---------------------------------------------------------------
+    // Larger random graph: bulk load vs. AddEdge().
+    // ---------------------------------------------------------------
+    const int n = 20000, m = 200000;
+    EdgeArray big;
+    srand(7);
+    for (int i = 0; i < m; i++)
+    {
+        big.source.push_back(rand() % n);
+        big.target.push_back(rand() % n);
+        big.weight.push_back(1 + rand() % 100);
+    }
+    GraphLoader::WriteBinary("big.bin", big, WeightFormat::FLOAT32);
+
+    auto t0 = chrono::steady_clock::now();
+    Graph fast = Graph::FromEdges(GraphLoader::ReadBinary("big.bin", WeightFormat::FLOAT32), true, false);
+    auto t1 = chrono::steady_clock::now();
+    Graph reference(n, true, true);
+    for (int i = 0; i < m; i++)
+        reference.AddEdge(big.source[i], big.target[i], big.weight[i]);
+    auto t2 = chrono::steady_clock::now();
+
+    assert(fast.Dijkstra(0).distance == reference.Dijkstra(0).distance);
+    cout << "Loaded " << fast.NumberOfEdges() << " edges in "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms (AddEdge: "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms)" << endl;
+
+    remove("edges.bin");
+    remove("edges.txt");
+    remove("edges.mtx");
+    remove("big.bin");
+    return 0;
+}
@@ -0,0 +1,400 @@
+#include "GraphLoader.hpp"
+#include "../Parallel/Parallel.hpp"
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <charconv>
+#include <algorithm>
+#include <cctype>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define GRAPHLOADER_MMAP 1
+#endif
+
+// =======================================================
+// MappedFile
+// =======================================================
+
+MappedFile::MappedFile(const std::string& path, bool sequential) : base(nullptr), length(0), mapped(false), buffer()
+{
+#ifdef GRAPHLOADER_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw std::runtime_error("Cannot open file: " + path);
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        close(fd);
+        throw std::runtime_error("Cannot stat file: " + path);
+    }
+    length = static_cast<size_t>(info.st_size);
+    if (length > 0)
+    {
+        void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p != MAP_FAILED)
+        {
+            if (sequential)
+                madvise(p, length, MADV_SEQUENTIAL);
+            base = static_cast<const char*>(p);
+            mapped = true;
+        }
+    }
+    close(fd);
+    if (mapped || length == 0)
+        return;
+#endif
+    // No mmap: read the whole file.
+    (void)sequential;
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in)
+        throw std::runtime_error("Cannot open file: " + path);
+    length = static_cast<size_t>(in.tellg());
+    buffer.resize(length);
+    in.seekg(0);
+    if (length > 0 && !in.read(buffer.data(), static_cast<std::streamsize>(length)))
+        throw std::runtime_error("Cannot read file: " + path);
+    base = buffer.data();
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef GRAPHLOADER_MMAP
+    if (mapped)
+        munmap(const_cast<char*>(base), length);
+#endif
+}
+
+const char* MappedFile::Data() const
+{
+    return base;
+}
+
+size_t MappedFile::Size() const
+{
+    return length;
+}
+
+// =======================================================
+// Binary edge files
+// =======================================================
+
+static size_t recordSize(WeightFormat format)
+{
+    switch (format)
+    {
+        case WeightFormat::NONE:    return 8;
+        case WeightFormat::FLOAT32: return 12;
+        case WeightFormat::FLOAT64: return 16;
+    }
+    throw std::invalid_argument("Unknown weight format.");
+}
+
+EdgeArray GraphLoader::ReadBinary(const std::string& path, WeightFormat format)
+{
+    MappedFile file(path);
+    size_t rec = recordSize(format);
+    if (file.Size() % rec != 0)
+        throw std::runtime_error("Binary edge file size is not a multiple of the record size.");
+
+    size_t m = file.Size() / rec;
+    EdgeArray edges;
+    edges.source.resize(m);
+    edges.target.resize(m);
+    if (format != WeightFormat::NONE)
+        edges.weight.resize(m);
+
+    // Records are independent, so every thread decodes its own slice of the mapping.
+    const char* data = file.Data();
+    Parallel::For(0, m, [&](size_t i)
+    {
+        const char* r = data + i * rec;
+        std::int32_t u, v;
+        std::memcpy(&u, r, 4);
+        std::memcpy(&v, r + 4, 4);
+        edges.source[i] = u;
+        edges.target[i] = v;
+        if (format == WeightFormat::FLOAT32)
+        {
+            float w;
+            std::memcpy(&w, r + 8, 4);
+            edges.weight[i] = w;
+        }
+        else if (format == WeightFormat::FLOAT64)
+        {
+            double w;
+            std::memcpy(&w, r + 8, 8);
+            edges.weight[i] = w;
+        }
+    }, 1 << 16);
+    return edges;
+}
+
+void GraphLoader::WriteBinary(const std::string& path, const EdgeArray& edges, WeightFormat format)
+{
+    size_t m = edges.source.size();
+    if (edges.target.size() != m || (!edges.weight.empty() && edges.weight.size() != m))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+
+    size_t rec = recordSize(format);
+    std::vector<char> out(m * rec);
+    Parallel::For(0, m, [&](size_t i)
+    {
+        char* r = out.data() + i * rec;
+        std::int32_t u = edges.source[i], v = edges.target[i];
+        std::memcpy(r, &u, 4);
+        std::memcpy(r + 4, &v, 4);
+        double w = edges.weight.empty() ? 1.0 : edges.weight[i];
+        if (format == WeightFormat::FLOAT32)
+        {
+            float f = static_cast<float>(w);
+            std::memcpy(r + 8, &f, 4);
+        }
+        else if (format == WeightFormat::FLOAT64)
+        {
+            std::memcpy(r + 8, &w, 8);
+        }
+    }, 1 << 16);
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(out.data(), static_cast<std::streamsize>(out.size())))
+        throw std::runtime_error("Cannot write file: " + path);
+}
+
+// =======================================================
+// Text edge files
+// =======================================================
+
+static const char* skipBlanks(const char* p, const char* end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p++;
+    return p;
+}
+
+static const char* nextLine(const char* p, const char* end)
+{
+    const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+    return nl ? nl + 1 : end;
+}
+
+// Parse the lines in [p, end) as "u v [w]" into out. Lines starting with '#' or '%'
+// are comments. Endpoints are shifted by -offset. Sets weighted if any weight was seen.
+static void parseEdgeLines(const char* p, const char* end, int offset, EdgeArray& out, bool& weighted)
+{
+    while (p < end)
+    {
+        const char* eol = nextLine(p, end);
+        const char* q = skipBlanks(p, eol);
+        if (q == eol || *q == '\n' || *q == '#' || *q == '%')
+        {
+            p = eol;
+            continue;
+        }
+
+        int u, v;
+        auto ru = std::from_chars(q, eol, u);
+        if (ru.ec != std::errc())
+            throw std::runtime_error("Malformed edge line.");
+        q = skipBlanks(ru.ptr, eol);
+        auto rv = std::from_chars(q, eol, v);
+        if (rv.ec != std::errc())
+            throw std::runtime_error("Malformed edge line.");
+        q = skipBlanks(rv.ptr, eol);
+
+        double w = 1.0;
+        if (q < eol && *q != '\n')
+        {
+            auto rw = std::from_chars(q, eol, w);
+            if (rw.ec != std::errc())
+                throw std::runtime_error("Malformed edge weight.");
+            weighted = true;
+        }
+
+        out.source.push_back(u - offset);
+        out.target.push_back(v - offset);
+        out.weight.push_back(w);
+        p = eol;
+    }
+}
+
+// Cut [begin, end) into one block per thread at line boundaries, parse the blocks
+// in parallel and concatenate the results in file order.
+static EdgeArray parseEdgeText(const char* begin, const char* end, int offset)
+{
+    size_t size = end - begin;
+    int blocks = std::max(1, std::min(Parallel::ThreadCount(), static_cast<int>(size / (1 << 20)) + 1));
+
+    std::vector<const char*> cut(blocks + 1);
+    cut[0] = begin;
+    cut[blocks] = end;
+    for (int b = 1; b < blocks; b++)
+    {
+        const char* p = begin + size * b / blocks;
+        if (p < cut[b - 1])
+            p = cut[b - 1];
+        cut[b] = (p > begin && p[-1] == '\n') ? p : nextLine(p, end);
+    }
+
+    std::vector<EdgeArray> part(blocks);
+    std::vector<char> weighted(blocks, 0);
+    Parallel::For(0, blocks, [&](size_t b)
+    {
+        bool w = false;
+        parseEdgeLines(cut[b], cut[b + 1], offset, part[b], w);
+        weighted[b] = w;
+    }, 1);
+
+    EdgeArray edges;
+    size_t m = 0;
+    for (const EdgeArray& a : part)
+        m += a.source.size();
+    edges.source.reserve(m);
+    edges.target.reserve(m);
+    bool anyWeight = std::find(weighted.begin(), weighted.end(), 1) != weighted.end();
+    if (anyWeight)
+        edges.weight.reserve(m);
+    for (EdgeArray& a : part)
+    {
+        edges.source.insert(edges.source.end(), a.source.begin(), a.source.end());
+        edges.target.insert(edges.target.end(), a.target.begin(), a.target.end());
+        if (anyWeight)
+            edges.weight.insert(edges.weight.end(), a.weight.begin(), a.weight.end());
+        a = EdgeArray();
+    }
+    return edges;
+}
+
+EdgeArray GraphLoader::ReadSNAP(const std::string& path)
+{
+    MappedFile file(path);
+    return parseEdgeText(file.Data(), file.Data() + file.Size(), 0);
+}
+
+EdgeArray GraphLoader::ReadMatrixMarket(const std::string& path)
+{
+    MappedFile file(path);
+    const char* p = file.Data();
+    const char* end = p + file.Size();
+
+    // Banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+    const char* eol = nextLine(p, end);
+    std::string banner(p, eol);
+    std::transform(banner.begin(), banner.end(), banner.begin(), ::tolower);
+    if (banner.compare(0, 14, "%%matrixmarket") != 0)
+        throw std::runtime_error("Missing Matrix Market banner.");
+    if (banner.find("coordinate") == std::string::npos)
+        throw std::runtime_error("Only Matrix Market coordinate files are supported.");
+    if (banner.find("complex") != std::string::npos)
+        throw std::runtime_error("Complex Matrix Market files are not supported.");
+    bool pattern = banner.find("pattern") != std::string::npos;
+    bool symmetric = banner.find("symmetric") != std::string::npos;
+    if (banner.find("skew") != std::string::npos || banner.find("hermitian") != std::string::npos)
+        throw std::runtime_error("Only general and symmetric Matrix Market files are supported.");
+    p = eol;
+
+    // Skip comments up to the size line "rows cols entries".
+    while (p < end)
+    {
+        const char* first = skipBlanks(p, end);
+        if (first < end && *first != '%' && *first != '\n')
+            break;
+        p = nextLine(p, end);
+    }
+    if (p == end)
+        throw std::runtime_error("Missing Matrix Market size line.");
+    eol = nextLine(p, end);
+    long long rows, cols, entries;
+    const char* q = skipBlanks(p, eol);
+    auto r1 = std::from_chars(q, eol, rows);
+    auto r2 = std::from_chars(skipBlanks(r1.ptr, eol), eol, cols);
+    auto r3 = std::from_chars(skipBlanks(r2.ptr, eol), eol, entries);
+    if (r1.ec != std::errc() || r2.ec != std::errc() || r3.ec != std::errc())
+        throw std::runtime_error("Malformed Matrix Market size line.");
+    if (std::max(rows, cols) > 0x7fffffff)
+        throw std::runtime_error("Matrix Market file has too many rows or columns.");
+
+    EdgeArray edges = parseEdgeText(eol, end, 1);
+    if (static_cast<long long>(edges.source.size()) != entries)
+        throw std::runtime_error("Matrix Market entry count does not match the size line.");
+
+    edges.numNodes = static_cast<int>(std::max(rows, cols));
+    edges.symmetric = symmetric;
+    if (pattern)
+        edges.weight.clear();
+    else if (edges.weight.empty() && entries > 0)
+        throw std::runtime_error("Matrix Market entries are missing their values.");
+    return edges;
+}
+
+// =======================================================
+// Sorting and deduplication
+// =======================================================
+
+void GraphLoader::SortAndDedupe(EdgeArray& edges, bool directed, EdgeAggregator aggregate)
+{
+    struct Record { int u, v; double w; };
+
+    size_t m = edges.source.size();
+    if (edges.target.size() != m || (!edges.weight.empty() && edges.weight.size() != m))
+        throw std::invalid_argument("Edge arrays must have the same length.");
+    bool weighted = !edges.weight.empty();
+
+    std::vector<Record> rec(m);
+    Parallel::For(0, m, [&](size_t i)
+    {
+        int u = edges.source[i], v = edges.target[i];
+        if (!directed && v < u)
+            std::swap(u, v);
+        rec[i] = {u, v, weighted ? edges.weight[i] : 1.0};
+    }, 1 << 16);
+
+    // Sorting by weight last puts the lightest of several parallel edges first
+    // and the heaviest last.
+    Parallel::Sort(rec, [](const Record& a, const Record& b)
+    {
+        if (a.u != b.u) return a.u < b.u;
+        if (a.v != b.v) return a.v < b.v;
+        return a.w < b.w;
+    });
+
+    // Merge every run of parallel edges into its first record.
+    size_t kept = 0;
+    for (size_t i = 0; i < m; )
+    {
+        size_t j = i + 1;
+        double w = rec[i].w;
+        while (j < m && rec[j].u == rec[i].u && rec[j].v == rec[i].v)
+        {
+            if (aggregate == EdgeAggregator::SUM)
+                w += rec[j].w;
+            j++;
+        }
+        if (aggregate == EdgeAggregator::MAX)
+            w = rec[j - 1].w;
+        else if (aggregate == EdgeAggregator::COUNT)
+            w = static_cast<double>(j - i);
+        rec[kept++] = {rec[i].u, rec[i].v, w};
+        i = j;
+    }
+    rec.resize(kept);
+    if (aggregate == EdgeAggregator::SUM || aggregate == EdgeAggregator::COUNT)
+        weighted = true;
+
+    m = rec.size();
+    edges.source.resize(m);
+    edges.target.resize(m);
+    if (weighted)
+        edges.weight.resize(m);
+    Parallel::For(0, m, [&](size_t i)
+    {
+        edges.source[i] = rec[i].u;
+        edges.target[i] = rec[i].v;
+        if (weighted)
+            edges.weight[i] = rec[i].w;
+    }, 1 << 16);
+}
@@ -0,0 +1,123 @@
+#ifndef GRAPHLOADER
+#define GRAPHLOADER
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+/**
+ * @brief Bulk edge input for Graph::FromEdges().
+ *
+ * An EdgeArray keeps the edges as three parallel arrays, so a whole graph can be
+ * read, sorted and handed over without building one object per edge. GraphLoader
+ * fills EdgeArrays from:
+ *
+ * - packed binary files of int32 u, int32 v [, float32 or float64 w] records,
+ *   read through a memory mapping and decoded in parallel;
+ * - SNAP-style text edge lists ("u v" or "u v w" per line, '#' comments);
+ * - Matrix Market coordinate files.
+ *
+ * The text parsers also work on a memory mapping: the file is cut into one block
+ * per thread at line boundaries and every block is parsed independently.
+ */
+
+// Layout of the weight field in a binary edge file.
+enum class WeightFormat
+{
+    NONE,       // 8-byte records: int32 u, int32 v.
+    FLOAT32,    // 12-byte records: int32 u, int32 v, float w.
+    FLOAT64     // 16-byte records: int32 u, int32 v, double w.
+};
+
+// How SortAndDedupe() merges parallel edges into one.
+enum class EdgeAggregator
+{
+    MIN,        // Keep the smallest weight.
+    MAX,        // Keep the largest weight.
+    SUM,        // Sum the weights (unweighted edges count 1 each).
+    COUNT       // Weight the merged edge by the number of parallel edges.
+};
+
+struct EdgeArray
+{
+    std::vector<int> source;        // Tail of every edge.
+    std::vector<int> target;        // Head of every edge.
+    std::vector<double> weight;     // Weight of every edge; empty if the edges are unweighted.
+    int numNodes = -1;              // If >= 0, the nodes are 0 .. numNodes-1; otherwise the endpoints that occur.
+    bool symmetric = false;         // True if the source declares the graph undirected (Matrix Market "symmetric").
+};
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * Falls back to reading the file into memory where mmap is unavailable.
+ */
+class MappedFile
+{
+    private:
+        const char* base;           // First byte of the file.
+        size_t length;              // File size in bytes.
+        bool mapped;                // True if base comes from mmap, false if it was read into buffer.
+        std::vector<char> buffer;   // Fallback storage.
+
+    public:
+        // Throws std::runtime_error if the file cannot be opened. sequential asks the
+        // kernel for aggressive read-ahead; pass false for random access.
+        explicit MappedFile(const std::string& path, bool sequential = true);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* Data() const;   // Start of the file contents.
+        size_t Size() const;        // Size in bytes.
+};
+
+class GraphLoader
+{
+    public:
+        /**
+         * @brief Read a packed binary edge file.
+         *
+         * @param path File path.
+         * @param format Layout of the weight field; NONE yields unweighted edges.
+         * @return The edges in file order.
+         */
+        static EdgeArray ReadBinary(const std::string& path, WeightFormat format);
+
+        /**
+         * @brief Write edges as a packed binary edge file readable by ReadBinary().
+         *
+         * Missing weights are written as 1 when format is not NONE.
+         */
+        static void WriteBinary(const std::string& path, const EdgeArray& edges, WeightFormat format);
+
+        /**
+         * @brief Read a SNAP-style text edge list.
+         *
+         * Every non-empty line that does not start with '#' or '%' holds "u v" or
+         * "u v w", separated by spaces or tabs. The edges are weighted if any line
+         * has a third column; missing weights then default to 1.
+         */
+        static EdgeArray ReadSNAP(const std::string& path);
+
+        /**
+         * @brief Read a Matrix Market coordinate file.
+         *
+         * Supports the real, integer and pattern fields with general or symmetric
+         * symmetry. Entry (i, j) becomes the edge i-1 -> j-1, the nodes are
+         * 0 .. max(rows, cols)-1 and symmetric is set for symmetric matrices.
+         */
+        static EdgeArray ReadMatrixMarket(const std::string& path);
+
+        /**
+         * @brief Sort the edges by (u, v) in parallel and merge duplicates.
+         *
+         * For undirected edges every pair is first stored as (min, max), so {u, v}
+         * and {v, u} are duplicates as well. Several parallel edges become one whose
+         * weight is given by aggregate: by default the smallest weight is kept. SUM
+         * and COUNT always produce weights, also for unweighted edges.
+         */
+        static void SortAndDedupe(EdgeArray& edges, bool directed, EdgeAggregator aggregate = EdgeAggregator::MIN);
+};
+
+#endif
@@ -0,0 +1,348 @@
+#include "GraphOrdering.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+#include "../Parallel/Parallel.hpp"
+
+// ================================
+// Helpers
+// ================================
+
+// Degree counting both directions of a directed graph.
+static std::vector<int> symmetricDegrees(const CSRGraph& g)
+{
+    int n = g.NumberOfNodes();
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& inOff = g.InOffsets();
+    std::vector<int> degree(n);
+    for (int v = 0; v < n; v++)
+    {
+        degree[v] = off[v + 1] - off[v];
+        if (g.IsDirected())
+            degree[v] += inOff[v + 1] - inOff[v];
+    }
+    return degree;
+}
+
+// Call f(u) for every out-neighbor of v, and every in-neighbor if g is directed.
+template <class F>
+static inline void forEachNeighbor(const CSRGraph& g, int v, F f)
+{
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    for (int i = off[v]; i < off[v + 1]; i++)
+        f(target[i]);
+    if (!g.IsDirected())
+        return;
+    const std::vector<int>& inOff = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+    for (int i = inOff[v]; i < inOff[v + 1]; i++)
+        f(source[i]);
+}
+
+// Vertices sorted by degree with a counting sort, ties by increasing index.
+static std::vector<int> sortByDegree(const std::vector<int>& degree, bool decreasing)
+{
+    int n = static_cast<int>(degree.size());
+    int maxDegree = n ? *std::max_element(degree.begin(), degree.end()) : 0;
+    std::vector<int> start(maxDegree + 2, 0);
+    for (int d : degree)
+        start[(decreasing ? maxDegree - d : d) + 1]++;
+    for (int k = 0; k <= maxDegree; k++)
+        start[k + 1] += start[k];
+    std::vector<int> order(n);
+    for (int v = 0; v < n; v++)
+        order[start[decreasing ? maxDegree - degree[v] : degree[v]]++] = v;
+    return order;
+}
+
+// ================================
+// Orderings
+// ================================
+
+std::vector<int> GraphOrdering::Order(const CSRGraph& g, OrderingStrategy strategy)
+{
+    switch (strategy)
+    {
+        case OrderingStrategy::REVERSE_CUTHILL_MCKEE:
+            return ReverseCuthillMcKee(g);
+        case OrderingStrategy::DEGREE:
+            return DegreeOrder(g);
+        case OrderingStrategy::GORDER:
+            return Gorder(g);
+    }
+    throw std::invalid_argument("Unknown ordering strategy.");
+}
+
+std::vector<int> GraphOrdering::DegreeOrder(const CSRGraph& g)
+{
+    return sortByDegree(symmetricDegrees(g), true);
+}
+
+// ================================
+// Reverse Cuthill-McKee
+// ================================
+
+std::vector<int> GraphOrdering::ReverseCuthillMcKee(const CSRGraph& g)
+{
+    int n = g.NumberOfNodes();
+    std::vector<int> degree = symmetricDegrees(g);
+    std::vector<int> order;
+    order.reserve(n);
+    std::vector<char> numbered(n, 0);
+
+    // Scratch for the level structures of the pseudo-peripheral search.
+    std::vector<int> level(n, -1);
+    std::vector<int> queue;
+    queue.reserve(n);
+
+    // BFS from root over the unnumbered vertices; returns the depth and leaves the
+    // visited vertices in queue, level by level.
+    auto levels = [&](int root)
+    {
+        for (int v : queue)
+            level[v] = -1;
+        queue.clear();
+        queue.push_back(root);
+        level[root] = 0;
+        for (size_t head = 0; head < queue.size(); head++)
+        {
+            int v = queue[head];
+            forEachNeighbor(g, v, [&](int u)
+            {
+                if (level[u] == -1 && !numbered[u])
+                {
+                    level[u] = level[v] + 1;
+                    queue.push_back(u);
+                }
+            });
+        }
+        return level[queue.back()];
+    };
+
+    std::vector<int> children;
+    for (int start : sortByDegree(degree, false))
+    {
+        if (numbered[start])
+            continue;
+
+        // George and Liu: move to a vertex of minimum degree in the last level
+        // while that makes the level structure deeper.
+        int root = start;
+        int depth = levels(root);
+        while (true)
+        {
+            int candidate = -1;
+            for (size_t k = queue.size(); k-- > 0 && level[queue[k]] == depth; )
+                if (candidate == -1 || degree[queue[k]] < degree[candidate] ||
+                    (degree[queue[k]] == degree[candidate] && queue[k] < candidate))
+                    candidate = queue[k];
+            int candidateDepth = levels(candidate);
+            if (candidateDepth <= depth)
+                break;
+            root = candidate;
+            depth = candidateDepth;
+        }
+
+        // Cuthill-McKee: BFS with the children of every vertex by increasing degree.
+        size_t head = order.size();
+        order.push_back(root);
+        numbered[root] = 1;
+        for (; head < order.size(); head++)
+        {
+            children.clear();
+            forEachNeighbor(g, order[head], [&](int u)
+            {
+                if (!numbered[u])
+                {
+                    numbered[u] = 1;
+                    children.push_back(u);
+                }
+            });
+            std::sort(children.begin(), children.end(), [&](int a, int b)
+            {
+                return degree[a] != degree[b] ? degree[a] < degree[b] : a < b;
+            });
+            order.insert(order.end(), children.begin(), children.end());
+        }
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+// ================================
+// Gorder
+// ================================
+
+// Unplaced vertices bucketed by score. Scores change by one, so an update moves a
+// vertex to the front of the neighboring bucket and the maximum is found by a
+// short scan down. Among equal scores the vertex updated last comes out first.
+struct UnitHeap
+{
+    std::vector<int> key, prev, next, head;
+    int top;
+
+    explicit UnitHeap(int n) : key(n, 0), prev(n, -1), next(n, -1), head(1, -1), top(0) {}
+
+    void unlink(int v)
+    {
+        if (prev[v] != -1)
+            next[prev[v]] = next[v];
+        else
+            head[key[v]] = next[v];
+        if (next[v] != -1)
+            prev[next[v]] = prev[v];
+    }
+
+    void pushFront(int v)
+    {
+        if (key[v] >= static_cast<int>(head.size()))
+            head.resize(key[v] + 1, -1);
+        prev[v] = -1;
+        next[v] = head[key[v]];
+        if (next[v] != -1)
+            prev[next[v]] = v;
+        head[key[v]] = v;
+        top = std::max(top, key[v]);
+    }
+
+    void increment(int v)
+    {
+        unlink(v);
+        key[v]++;
+        pushFront(v);
+    }
+
+    void decrement(int v)
+    {
+        unlink(v);
+        key[v]--;
+        pushFront(v);
+    }
+
+    // Remove and return a vertex of highest score, or -1 if none is left.
+    int popMax()
+    {
+        while (top > 0 && head[top] == -1)
+            top--;
+        int v = head[top];
+        if (v != -1)
+            unlink(v);
+        return v;
+    }
+};
+
+std::vector<int> GraphOrdering::Gorder(const CSRGraph& g)
+{
+    int n = g.NumberOfNodes();
+    std::vector<int> degree = symmetricDegrees(g);
+    int hubLimit = static_cast<int>(std::sqrt(static_cast<double>(n)));
+    if (hubLimit < GORDER_MIN_HUB)
+        hubLimit = GORDER_MIN_HUB;
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<int>& inOff = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+
+    // The highest-degree vertex ends up at the head of bucket 0 and starts the order.
+    UnitHeap heap(n);
+    std::vector<int> byDegree = sortByDegree(degree, true);
+    for (int k = n - 1; k >= 0; k--)
+        heap.pushFront(byDegree[k]);
+
+    std::vector<char> placed(n, 0);
+    std::vector<int> order;
+    order.reserve(n);
+
+    // Add (delta = 1) or remove (delta = -1) the score that v in the window gives to
+    // its neighbors and siblings.
+    auto score = [&](int v, int delta)
+    {
+        auto bump = [&](int u)
+        {
+            if (placed[u])
+                return;
+            if (delta > 0)
+                heap.increment(u);
+            else
+                heap.decrement(u);
+        };
+        forEachNeighbor(g, v, bump);
+        for (int i = inOff[v]; i < inOff[v + 1]; i++)
+        {
+            int u = source[i];
+            if (degree[u] > hubLimit)
+                continue;
+            for (int j = off[u]; j < off[u + 1]; j++)
+                if (target[j] != v)
+                    bump(target[j]);
+        }
+    };
+
+    for (int k = 0; k < n; k++)
+    {
+        int v = heap.popMax();
+        placed[v] = 1;
+        order.push_back(v);
+        score(v, 1);
+        if (k >= GORDER_WINDOW)
+            score(order[k - GORDER_WINDOW], -1);
+    }
+    return order;
+}
+
+// ================================
+// Relabeling
+// ================================
+
+CSRGraph GraphOrdering::Permute(const CSRGraph& g, const std::vector<int>& order)
+{
+    int n = g.NumberOfNodes();
+    if (static_cast<int>(order.size()) != n)
+        throw std::invalid_argument("Order must be a permutation of the vertices.");
+    std::vector<int> newIndex(n, -1);
+    for (int k = 0; k < n; k++)
+    {
+        int v = order[k];
+        if (v < 0 || v >= n || newIndex[v] != -1)
+            throw std::invalid_argument("Order must be a permutation of the vertices.");
+        newIndex[v] = k;
+    }
+
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+    std::vector<int> offsets(n + 1, 0);
+    for (int k = 0; k < n; k++)
+        offsets[k + 1] = offsets[k] + off[order[k] + 1] - off[order[k]];
+
+    std::vector<int> targets(target.size());
+    std::vector<double> weights(weight.size());
+    Parallel::For(0, n, [&](size_t k)
+    {
+        int v = order[k];
+        int out = offsets[k];
+        for (int i = off[v]; i < off[v + 1]; i++, out++)
+        {
+            targets[out] = newIndex[target[i]];
+            weights[out] = weight[i];
+        }
+    }, 1024);
+    return CSRGraph(std::move(offsets), std::move(targets), std::move(weights), g.IsDirected());
+}
+
+double GraphOrdering::AverageGap(const CSRGraph& g)
+{
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    if (target.empty())
+        return 0;
+    double sum = 0;
+    for (int u = 0; u < g.NumberOfNodes(); u++)
+        for (int i = off[u]; i < off[u + 1]; i++)
+            sum += std::abs(target[i] - u);
+    return sum / target.size();
+}
@@ -0,0 +1,176 @@
+// GraphPartitioner-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread GraphPartitioner.cpp GraphPartitioner-test.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../Parallel/Parallel.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <tuple>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <algorithm>
+#include "GraphPartitioner.hpp"
+#include "../Parallel/Parallel.hpp"
+
+using namespace std;
+
+// side x side grid, edges to the right and lower neighbor.
+static CSRGraph Grid(int side, bool directed)
+{
+    vector<int> src, dst;
+    for (int r = 0; r < side; r++)
+        for (int c = 0; c < side; c++)
+        {
+            if (c + 1 < side)
+            {
+                src.push_back(r * side + c);
+                dst.push_back(r * side + c + 1);
+            }
+            if (r + 1 < side)
+            {
+                src.push_back(r * side + c);
+                dst.push_back((r + 1) * side + c);
+            }
+        }
+    vector<double> w(src.size());
+    for (size_t i = 0; i < w.size(); i++)
+        w[i] = i % 7;
+    return CSRGraph(side * side, src, dst, w, directed);
+}
+
+// Every shard must own its part, list the right halo and keep every arc that
+// touches the part, with its weight.
+static void CheckShards(const CSRGraph& g, const PartitionResult& result)
+{
+    int owned = 0;
+    long long cutArcs = 0;
+    for (int p = 0; p < result.parts; p++)
+    {
+        PartitionShard shard = GraphPartitioner::Extract(g, result.part, p);
+        assert(shard.owned == result.size[p]);
+        assert(shard.global.size() == shard.owned + shard.haloOwner.size());
+        owned += shard.owned;
+        for (int k = 0; k < shard.owned; k++)
+            assert(result.part[shard.global[k]] == p);
+        for (size_t h = 0; h < shard.haloOwner.size(); h++)
+            assert(shard.haloOwner[h] == result.part[shard.global[shard.owned + h]] && shard.haloOwner[h] != p);
+
+        multiset<tuple<int, int, double>> expected, actual;
+        for (int u = 0; u < g.NumberOfNodes(); u++)
+            for (int i = g.Offsets()[u]; i < g.Offsets()[u + 1]; i++)
+            {
+                int v = g.Targets()[i];
+                bool touches = result.part[u] == p || result.part[v] == p;
+                // Arcs between two halo nodes do not belong to the shard.
+                if (touches)
+                    expected.insert({u, v, g.Weights()[i]});
+            }
+        const CSRGraph& local = shard.graph;
+        for (int u = 0; u < local.NumberOfNodes(); u++)
+            for (int i = local.Offsets()[u]; i < local.Offsets()[u + 1]; i++)
+                actual.insert({shard.global[u], shard.global[local.Targets()[i]], local.Weights()[i]});
+        assert(actual == expected);
+
+        // Cut edges are arcs of g, (tail, head), with exactly one owned endpoint.
+        for (auto& edge : shard.cutEdges)
+        {
+            assert((result.part[edge.first] == p) != (result.part[edge.second] == p));
+            assert(g.IsDirected() || result.part[edge.first] == p);
+            const int* begin = g.Targets().data() + g.Offsets()[edge.first];
+            const int* end = g.Targets().data() + g.Offsets()[edge.first + 1];
+            assert(find(begin, end, edge.second) != end);
+        }
+        cutArcs += shard.cutEdges.size();
+    }
+    assert(owned == g.NumberOfNodes());
+    assert(cutArcs == 2 * result.edgeCut);
+}
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // Two cliques joined by one edge split along that edge.
+    // ---------------------------------------------------------------
+    vector<int> src, dst;
+    for (int c = 0; c < 2; c++)
+        for (int a = 0; a < 6; a++)
+            for (int b = a + 1; b < 6; b++)
+            {
+                src.push_back(6 * c + a);
+                dst.push_back(6 * c + b);
+            }
+    src.push_back(5);
+    dst.push_back(6);
+    CSRGraph cliques(12, src, dst, vector<double>(src.size(), 1.0), false);
+    PartitionResult two = GraphPartitioner::Partition(cliques, 2);
+    cout << "Cliques:";
+    for (int p : two.part)
+        cout << " " << p;
+    cout << " (cut " << two.edgeCut << ", volume " << two.communicationVolume << ")" << endl;
+    assert(two.edgeCut == 1 && two.communicationVolume == 2 && two.size[0] == 6);
+    CheckShards(cliques, two);
+
+    PartitionShard shard = GraphPartitioner::Extract(cliques, two.part, two.part[5]);
+    cout << "Shard of node 5: " << shard.owned << " owned, halo";
+    for (size_t h = 0; h < shard.haloOwner.size(); h++)
+        cout << " " << shard.global[shard.owned + h] << "@" << shard.haloOwner[h];
+    cout << ", cut edges";
+    for (auto& edge : shard.cutEdges)
+        cout << " {" << edge.first << ", " << edge.second << "}";
+    cout << endl;
+
+    // ---------------------------------------------------------------
+    // Grids: balanced parts with a cut close to the optimum, far below a
+    // random assignment.
+    // ---------------------------------------------------------------
+    srand(4);
+    Parallel::SetThreadCount(4);
+    CSRGraph grid = Grid(100, false);
+    for (int k : {2, 4, 7, 16})
+    {
+        PartitionResult result = GraphPartitioner::Partition(grid, k, 0.03);
+        vector<int> random(grid.NumberOfNodes());
+        for (int& p : random)
+            p = rand() % k;
+        PartitionResult baseline = GraphPartitioner::Evaluate(grid, random, k);
+        cout << "Grid 100x100, " << k << " parts: cut " << result.edgeCut << " (random " << baseline.edgeCut
+             << "), imbalance " << result.imbalance << ", " << result.levels << " levels" << endl;
+        assert(result.imbalance <= 1.03 + 1e-9);
+        assert(result.edgeCut * 10 < baseline.edgeCut);
+        CheckShards(grid, result);
+    }
+    // The best bisection of the grid cuts 100 edges.
+    assert(GraphPartitioner::Partition(grid, 2).edgeCut <= 150);
+
+    // Directed graphs are partitioned as their undirected version; shards keep in-arcs.
+    CSRGraph directed = Grid(40, true);
+    PartitionResult result = GraphPartitioner::Partition(directed, 5);
+    assert(result.imbalance <= 1.03 + 1e-9);
+    CheckShards(directed, result);
+    Parallel::SetThreadCount(0);
+
+    // One part, more parts than vertices, and bad arguments.
+    assert(GraphPartitioner::Partition(cliques, 1).edgeCut == 0);
+    PartitionResult many = GraphPartitioner::Partition(cliques, 20);
+    assert(*max_element(many.size.begin(), many.size.end()) == 1);
+    try
+    {
+        GraphPartitioner::Partition(cliques, 0);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    try
+    {
+        GraphPartitioner::Evaluate(cliques, vector<int>(12, 3), 2);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    return 0;
+}
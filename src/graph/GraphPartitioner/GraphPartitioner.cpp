@@ -0,0 +1,602 @@
+#include "GraphPartitioner.hpp"
+#include <stdexcept>
+#include <algorithm>
+#include <random>
+#include <queue>
+#include <cmath>
+#include "../Parallel/Parallel.hpp"
+
+// ================================
+// Weighted Levels
+// ================================
+
+// One level of the multilevel hierarchy: an undirected graph without self-loops
+// or parallel edges, with vertex weights (original vertices merged into a vertex)
+// and edge weights (original edges merged into an edge).
+struct PartitionLevel
+{
+    int n;
+    std::vector<int> offset, adj, adjWeight, vertexWeight;
+    std::vector<int> coarse;    // Vertex of the next coarser level, once it exists.
+};
+
+// The undirected, simple version of g: unit vertex weights, and every edge weighs
+// the number of arcs between its endpoints.
+static PartitionLevel finestLevel(const CSRGraph& g)
+{
+    int n = g.NumberOfNodes();
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<int>& inOff = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+
+    PartitionLevel level;
+    level.n = n;
+    level.vertexWeight.assign(n, 1);
+    level.offset.assign(n + 1, 0);
+    level.adj.reserve(g.IsDirected() ? 2 * target.size() : target.size());
+    level.adjWeight.reserve(level.adj.capacity());
+
+    // where[v] is the slot of v in the list being built, or -1.
+    std::vector<int> where(n, -1);
+    for (int u = 0; u < n; u++)
+    {
+        size_t begin = level.adj.size();
+        auto add = [&](int v)
+        {
+            if (v == u)
+                return;
+            if (where[v] == -1)
+            {
+                where[v] = static_cast<int>(level.adj.size());
+                level.adj.push_back(v);
+                level.adjWeight.push_back(1);
+            }
+            else
+                level.adjWeight[where[v]]++;
+        };
+        for (int i = off[u]; i < off[u + 1]; i++)
+            add(target[i]);
+        if (g.IsDirected())
+            for (int i = inOff[u]; i < inOff[u + 1]; i++)
+                add(source[i]);
+        for (size_t i = begin; i < level.adj.size(); i++)
+            where[level.adj[i]] = -1;
+        level.offset[u + 1] = static_cast<int>(level.adj.size());
+    }
+    return level;
+}
+
+// Heavy-edge matching in random order, then two-hop matching; returns the
+// contracted level and fills fine.coarse. Matched pairs may not outweigh maxWeight.
+static PartitionLevel coarsen(PartitionLevel& fine, int maxWeight, std::mt19937& rng)
+{
+    int n = fine.n;
+    std::vector<int> order(n);
+    for (int v = 0; v < n; v++)
+        order[v] = v;
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<int> match(n, -1);
+    for (int v : order)
+    {
+        if (match[v] != -1)
+            continue;
+        int best = v, bestWeight = 0;
+        for (int i = fine.offset[v]; i < fine.offset[v + 1]; i++)
+        {
+            int u = fine.adj[i];
+            if (match[u] == -1 && fine.adjWeight[i] > bestWeight &&
+                fine.vertexWeight[v] + fine.vertexWeight[u] <= maxWeight)
+            {
+                best = u;
+                bestWeight = fine.adjWeight[i];
+            }
+        }
+        match[v] = best;
+        match[best] = v;
+    }
+
+    // Leaves of hubs rarely find an unmatched neighbor, which stalls the coarsening
+    // of power-law graphs. If many vertices are left, pair the unmatched ones that
+    // share a neighbor, and the isolated ones among themselves (two-hop matching,
+    // as in METIS).
+    int unmatched = 0;
+    for (int v = 0; v < n; v++)
+        if (match[v] == v)
+            unmatched++;
+    int waiting = -1;
+    for (int u = 0; u < n && unmatched > n / 4; u++)
+    {
+        int leaf = -1;
+        for (int i = fine.offset[u]; i < fine.offset[u + 1]; i++)
+        {
+            int x = fine.adj[i];
+            if (match[x] != x)
+                continue;
+            if (leaf != -1 && fine.vertexWeight[leaf] + fine.vertexWeight[x] <= maxWeight)
+            {
+                match[leaf] = x;
+                match[x] = leaf;
+                leaf = -1;
+            }
+            else
+                leaf = x;
+        }
+        if (fine.offset[u] == fine.offset[u + 1] && match[u] == u)
+        {
+            if (waiting != -1 && fine.vertexWeight[waiting] + fine.vertexWeight[u] <= maxWeight)
+            {
+                match[waiting] = u;
+                match[u] = waiting;
+                waiting = -1;
+            }
+            else
+                waiting = u;
+        }
+    }
+
+    PartitionLevel coarse;
+    coarse.n = 0;
+    fine.coarse.assign(n, -1);
+    for (int v = 0; v < n; v++)
+        if (fine.coarse[v] == -1)
+        {
+            fine.coarse[v] = coarse.n;
+            fine.coarse[match[v]] = coarse.n;
+            coarse.n++;
+        }
+
+    // Merge the lists of both members of every pair, summing parallel edges.
+    coarse.offset.assign(coarse.n + 1, 0);
+    coarse.vertexWeight.assign(coarse.n, 0);
+    coarse.adj.reserve(fine.adj.size() / 2);
+    coarse.adjWeight.reserve(fine.adj.size() / 2);
+    std::vector<int> where(coarse.n, -1);
+    int c = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (fine.coarse[v] != c)
+            continue;
+        size_t begin = coarse.adj.size();
+        int members[2] = {v, match[v]};
+        for (int m = 0; m < (match[v] == v ? 1 : 2); m++)
+        {
+            int x = members[m];
+            coarse.vertexWeight[c] += fine.vertexWeight[x];
+            for (int i = fine.offset[x]; i < fine.offset[x + 1]; i++)
+            {
+                int y = fine.coarse[fine.adj[i]];
+                if (y == c)
+                    continue;
+                if (where[y] == -1)
+                {
+                    where[y] = static_cast<int>(coarse.adj.size());
+                    coarse.adj.push_back(y);
+                    coarse.adjWeight.push_back(fine.adjWeight[i]);
+                }
+                else
+                    coarse.adjWeight[where[y]] += fine.adjWeight[i];
+            }
+        }
+        for (size_t i = begin; i < coarse.adj.size(); i++)
+            where[coarse.adj[i]] = -1;
+        coarse.offset[c + 1] = static_cast<int>(coarse.adj.size());
+        c++;
+    }
+    return coarse;
+}
+
+// ================================
+// Initial Partition
+// ================================
+
+// Split the vertices in verts into a region of weight at least targetWeight,
+// labeled left, and the rest, labeled right, by greedy graph growing: the region
+// repeatedly takes the frontier vertex whose move cuts the fewest edges.
+static void bisect(const PartitionLevel& level, const std::vector<int>& verts, int targetWeight,
+                   int left, int right, std::vector<int>& part, std::mt19937& rng)
+{
+    std::vector<int> bestSide;
+    long long bestCut = -1;
+    std::vector<int> gain(level.n, 0);
+
+    for (int trial = 0; trial < GraphPartitioner::INITIAL_TRIALS; trial++)
+    {
+        for (int v : verts)
+        {
+            part[v] = right;
+            gain[v] = 0;
+        }
+        for (int v : verts)
+            for (int i = level.offset[v]; i < level.offset[v + 1]; i++)
+                if (part[level.adj[i]] == right)
+                    gain[v] -= level.adjWeight[i];
+
+        // Max-gain queue with lazy deletion: stale entries are skipped when popped.
+        std::priority_queue<std::pair<int, int>> frontier;
+        std::uniform_int_distribution<size_t> pick(0, verts.size() - 1);
+        int weight = 0;
+        size_t scan = pick(rng);
+        while (weight < targetWeight)
+        {
+            int v = -1;
+            while (!frontier.empty())
+            {
+                std::pair<int, int> top = frontier.top();
+                frontier.pop();
+                if (part[top.second] == right && gain[top.second] == top.first)
+                {
+                    v = top.second;
+                    break;
+                }
+            }
+            if (v == -1)
+            {
+                // A new component: start from the next vertex still on the right.
+                for (size_t tried = 0; tried < verts.size() && v == -1; tried++, scan = (scan + 1) % verts.size())
+                    if (part[verts[scan]] == right)
+                        v = verts[scan];
+                if (v == -1)
+                    break;
+            }
+            part[v] = left;
+            weight += level.vertexWeight[v];
+            for (int i = level.offset[v]; i < level.offset[v + 1]; i++)
+            {
+                int u = level.adj[i];
+                if (part[u] == right)
+                {
+                    gain[u] += 2 * level.adjWeight[i];
+                    frontier.push({gain[u], u});
+                }
+            }
+        }
+
+        long long cut = 0;
+        for (int v : verts)
+            if (part[v] == left)
+                for (int i = level.offset[v]; i < level.offset[v + 1]; i++)
+                    if (part[level.adj[i]] == right)
+                        cut += level.adjWeight[i];
+        if (bestCut == -1 || cut < bestCut)
+        {
+            bestCut = cut;
+            bestSide.resize(verts.size());
+            for (size_t j = 0; j < verts.size(); j++)
+                bestSide[j] = part[verts[j]];
+        }
+    }
+    for (size_t j = 0; j < verts.size(); j++)
+        part[verts[j]] = bestSide[j];
+}
+
+// Recursive bisection of verts into the parts first .. first+k-1.
+static void recursiveBisection(const PartitionLevel& level, const std::vector<int>& verts, int k, int first,
+                               std::vector<int>& part, std::mt19937& rng)
+{
+    if (k == 1 || verts.empty())
+    {
+        for (int v : verts)
+            part[v] = first;
+        return;
+    }
+    int half = k / 2;
+    long long total = 0;
+    for (int v : verts)
+        total += level.vertexWeight[v];
+    int target = static_cast<int>(total * half / k);
+    bisect(level, verts, target, first, first + half, part, rng);
+
+    std::vector<int> leftVerts, rightVerts;
+    for (int v : verts)
+        (part[v] == first ? leftVerts : rightVerts).push_back(v);
+    recursiveBisection(level, leftVerts, half, first, part, rng);
+    recursiveBisection(level, rightVerts, k - half, first + half, part, rng);
+}
+
+// ================================
+// Refinement
+// ================================
+
+// Greedy k-way refinement: every vertex moves to the adjacent part that reduces
+// the cut the most, if that part stays within maxWeight. Vertices of overweight
+// parts also take moves that do not reduce the cut.
+static void refine(const PartitionLevel& level, int k, int maxWeight, std::vector<int>& part, std::mt19937& rng)
+{
+    std::vector<long long> partWeight(k, 0);
+    for (int v = 0; v < level.n; v++)
+        partWeight[part[v]] += level.vertexWeight[v];
+
+    std::vector<int> order(level.n);
+    for (int v = 0; v < level.n; v++)
+        order[v] = v;
+    std::vector<int> connection(k, 0);
+    std::vector<int> touched;
+
+    for (int pass = 0; pass < GraphPartitioner::REFINE_PASSES; pass++)
+    {
+        std::shuffle(order.begin(), order.end(), rng);
+        int moves = 0;
+        for (int v : order)
+        {
+            int from = part[v];
+            int w = level.vertexWeight[v];
+            bool overweight = partWeight[from] > maxWeight;
+            touched.clear();
+            for (int i = level.offset[v]; i < level.offset[v + 1]; i++)
+            {
+                int p = part[level.adj[i]];
+                if (connection[p] == 0)
+                    touched.push_back(p);
+                connection[p] += level.adjWeight[i];
+            }
+            int internal = connection[from];
+
+            int best = -1, bestGain = 0;
+            for (int p : touched)
+            {
+                if (p == from || partWeight[p] + w > maxWeight)
+                    continue;
+                int gain = connection[p] - internal;
+                bool better = best == -1 ? (gain > 0 || overweight || (gain == 0 && partWeight[p] + w < partWeight[from]))
+                                         : (gain > bestGain || (gain == bestGain && partWeight[p] < partWeight[best]));
+                if (better)
+                {
+                    best = p;
+                    bestGain = gain;
+                }
+            }
+            if (best == -1 && overweight)
+            {
+                // No neighbor part can take it: send it to the lightest part.
+                best = static_cast<int>(std::min_element(partWeight.begin(), partWeight.end()) - partWeight.begin());
+                if (best == from || partWeight[best] + w > maxWeight)
+                    best = -1;
+            }
+            for (int p : touched)
+                connection[p] = 0;
+            connection[from] = 0;
+
+            if (best != -1)
+            {
+                part[v] = best;
+                partWeight[from] -= w;
+                partWeight[best] += w;
+                moves++;
+            }
+        }
+        if (moves == 0)
+            break;
+    }
+}
+
+// ================================
+// Partitioning
+// ================================
+
+PartitionResult GraphPartitioner::Partition(const CSRGraph& g, int k, double imbalance, unsigned seed)
+{
+    if (k < 1)
+        throw std::invalid_argument("Number of parts must be at least 1.");
+    if (!(imbalance >= 0))
+        throw std::invalid_argument("Imbalance must be non-negative.");
+
+    int n = g.NumberOfNodes();
+    std::mt19937 rng(seed);
+    std::vector<PartitionLevel> levels;
+    levels.push_back(finestLevel(g));
+
+    // Coarsen while the graph still shrinks noticeably. Coarse vertices stay small
+    // enough that the initial partition can balance them.
+    long long coarsestTarget = static_cast<long long>(COARSEN_PER_PART) * k;
+    int maxVertexWeight = static_cast<int>(std::max(1.0, 1.5 * n / coarsestTarget));
+    while (levels.back().n > coarsestTarget)
+    {
+        PartitionLevel next = coarsen(levels.back(), maxVertexWeight, rng);
+        if (next.n > 0.95 * levels.back().n)
+        {
+            levels.back().coarse.clear();
+            break;
+        }
+        levels.push_back(std::move(next));
+    }
+
+    int maxWeight = static_cast<int>(std::ceil((1 + imbalance) * n / k));
+    const PartitionLevel& coarsest = levels.back();
+    std::vector<int> part(coarsest.n, 0);
+    std::vector<int> verts(coarsest.n);
+    for (int v = 0; v < coarsest.n; v++)
+        verts[v] = v;
+    recursiveBisection(coarsest, verts, k, 0, part, rng);
+    refine(coarsest, k, maxWeight, part, rng);
+
+    // Project the partition to every finer level and refine it there.
+    for (int l = static_cast<int>(levels.size()) - 2; l >= 0; l--)
+    {
+        const PartitionLevel& fine = levels[l];
+        std::vector<int> finePart(fine.n);
+        for (int v = 0; v < fine.n; v++)
+            finePart[v] = part[fine.coarse[v]];
+        part.swap(finePart);
+        refine(fine, k, maxWeight, part, rng);
+    }
+
+    PartitionResult result = Evaluate(g, part, k);
+    result.levels = static_cast<int>(levels.size());
+    return result;
+}
+
+PartitionResult GraphPartitioner::Evaluate(const CSRGraph& g, const std::vector<int>& part, int k)
+{
+    int n = g.NumberOfNodes();
+    if (k < 1)
+        throw std::invalid_argument("Number of parts must be at least 1.");
+    if (static_cast<int>(part.size()) != n)
+        throw std::invalid_argument("Partition must have one entry per vertex.");
+    for (int p : part)
+        if (p < 0 || p >= k)
+            throw std::invalid_argument("Part out of range.");
+
+    PartitionResult result;
+    result.parts = k;
+    result.part = part;
+    result.size.assign(k, 0);
+    for (int p : part)
+        result.size[p]++;
+    result.levels = 0;
+
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<int>& inOff = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+    int blocks = std::max(1, Parallel::ThreadCount());
+    std::vector<long long> cut(blocks, 0), volume(blocks, 0);
+    Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, int block)
+    {
+        // seen[p] == v + 1 once part p was counted for vertex v.
+        std::vector<int> seen(k, 0);
+        for (size_t v = lo; v < hi; v++)
+        {
+            int own = part[v];
+            seen[own] = static_cast<int>(v) + 1;
+            for (int i = off[v]; i < off[v + 1]; i++)
+            {
+                int p = part[target[i]];
+                if (p == own)
+                    continue;
+                cut[block]++;
+                if (seen[p] != static_cast<int>(v) + 1)
+                {
+                    seen[p] = static_cast<int>(v) + 1;
+                    volume[block]++;
+                }
+            }
+            if (g.IsDirected())
+                for (int i = inOff[v]; i < inOff[v + 1]; i++)
+                {
+                    int p = part[source[i]];
+                    if (p != own && seen[p] != static_cast<int>(v) + 1)
+                    {
+                        seen[p] = static_cast<int>(v) + 1;
+                        volume[block]++;
+                    }
+                }
+        }
+    });
+
+    result.edgeCut = 0;
+    result.communicationVolume = 0;
+    for (int b = 0; b < blocks; b++)
+    {
+        result.edgeCut += cut[b];
+        result.communicationVolume += volume[b];
+    }
+    if (!g.IsDirected())
+        result.edgeCut /= 2;
+    int largest = k ? *std::max_element(result.size.begin(), result.size.end()) : 0;
+    result.imbalance = n ? static_cast<double>(largest) * k / n : 1.0;
+    return result;
+}
+
+// ================================
+// Shards
+// ================================
+
+PartitionShard GraphPartitioner::Extract(const CSRGraph& g, const std::vector<int>& part, int p)
+{
+    int n = g.NumberOfNodes();
+    if (static_cast<int>(part.size()) != n)
+        throw std::invalid_argument("Partition must have one entry per vertex.");
+    if (p < 0)
+        throw std::invalid_argument("Part out of range.");
+
+    const std::vector<int>& off = g.Offsets();
+    const std::vector<int>& target = g.Targets();
+    const std::vector<double>& weight = g.Weights();
+    const std::vector<int>& inOff = g.InOffsets();
+    const std::vector<int>& source = g.Sources();
+    const std::vector<double>& inWeight = g.InWeights();
+
+    PartitionShard shard;
+    shard.part = p;
+    std::vector<int> local(n, -1);
+    for (int v = 0; v < n; v++)
+        if (part[v] == p)
+        {
+            local[v] = static_cast<int>(shard.global.size());
+            shard.global.push_back(v);
+        }
+    shard.owned = static_cast<int>(shard.global.size());
+
+    // Halo: the other endpoints of arcs leaving or (directed) entering the part.
+    std::vector<int> halo;
+    auto touch = [&](int v)
+    {
+        if (local[v] == -1)
+        {
+            local[v] = -2;
+            halo.push_back(v);
+        }
+    };
+    for (int k = 0; k < shard.owned; k++)
+    {
+        int u = shard.global[k];
+        for (int i = off[u]; i < off[u + 1]; i++)
+            touch(target[i]);
+        if (g.IsDirected())
+            for (int i = inOff[u]; i < inOff[u + 1]; i++)
+                touch(source[i]);
+    }
+    std::sort(halo.begin(), halo.end());
+    for (int v : halo)
+    {
+        local[v] = static_cast<int>(shard.global.size());
+        shard.global.push_back(v);
+        shard.haloOwner.push_back(part[v]);
+    }
+
+    // Edges with an owned endpoint. An undirected edge inside the part is taken from
+    // its smaller endpoint, and a self-loop from every second of its two arcs.
+    std::vector<int> src, dst;
+    std::vector<double> w;
+    for (int k = 0; k < shard.owned; k++)
+    {
+        int u = shard.global[k];
+        bool skipLoop = false;
+        for (int i = off[u]; i < off[u + 1]; i++)
+        {
+            int v = target[i];
+            bool inside = part[v] == p;
+            if (!g.IsDirected() && inside)
+            {
+                if (v < u)
+                    continue;
+                if (v == u)
+                {
+                    skipLoop = !skipLoop;
+                    if (!skipLoop)
+                        continue;
+                }
+            }
+            src.push_back(k);
+            dst.push_back(local[v]);
+            w.push_back(weight[i]);
+            if (!inside)
+                shard.cutEdges.push_back({u, v});
+        }
+        if (g.IsDirected())
+            for (int i = inOff[u]; i < inOff[u + 1]; i++)
+            {
+                int v = source[i];
+                if (part[v] == p)
+                    continue;
+                src.push_back(local[v]);
+                dst.push_back(k);
+                w.push_back(inWeight[i]);
+                shard.cutEdges.push_back({v, u});
+            }
+    }
+    shard.graph = CSRGraph(static_cast<int>(shard.global.size()), src, dst, w, g.IsDirected());
+    return shard;
+}
@@ -0,0 +1,106 @@
+#ifndef GRAPHPARTITIONER
+#define GRAPHPARTITIONER
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "../CSRGraph/CSRGraph.hpp"
+
+/**
+ * @brief Result of a k-way partition.
+ */
+struct PartitionResult
+{
+    int parts;                          // Number of parts k.
+    std::vector<int> part;              // Part of every vertex, in 0 .. k-1.
+    std::vector<int> size;              // Vertices per part.
+    std::int64_t edgeCut;               // Edges whose endpoints lie in different parts.
+    std::int64_t communicationVolume;   // Sum over vertices of the number of other parts among their neighbors.
+    double imbalance;                   // Largest part size divided by the average size.
+    int levels;                         // Coarsening levels used.
+};
+
+/**
+ * @brief One part of a partition, with its halo, ready to be handed to a worker.
+ *
+ * The local vertices are the owned vertices of the part (0 .. owned-1) followed
+ * by the halo (ghost) vertices: vertices of other parts that share an edge with
+ * an owned vertex. graph holds every edge with at least one owned endpoint, in
+ * local indices and with the original weights, so a worker can run a round of
+ * any neighborhood algorithm on its owned vertices and then exchange the values
+ * of its halo with the owners.
+ */
+struct PartitionShard
+{
+    int part;                           // The part this shard owns.
+    int owned;                          // Owned vertices: local 0 .. owned-1.
+    std::vector<int> global;            // Global vertex of every local vertex.
+    std::vector<int> haloOwner;         // Part owning halo vertex owned + i.
+    CSRGraph graph;                     // Local graph: edges with at least one owned endpoint.
+    std::vector<std::pair<int, int>> cutEdges;  // Global (tail, head) of every cut arc; one endpoint is owned, and comes first if undirected.
+};
+
+/**
+ * @brief Multilevel k-way graph partitioning (in the style of METIS).
+ *
+ * Partition() splits the vertices into k parts of nearly equal size while
+ * cutting as few edges as possible, in three phases:
+ *
+ * - Coarsening: heavy-edge matching contracts pairs of adjacent vertices, summing
+ *   vertex weights and the weights of merged edges, until the graph has about
+ *   COARSEN_PER_PART * k vertices or stops shrinking.
+ * - Initial partition: recursive bisection of the coarsest graph by greedy graph
+ *   growing, the best of INITIAL_TRIALS tries per bisection.
+ * - Uncoarsening: the partition is projected back level by level and refined by
+ *   greedy boundary moves (Fiduccia-Mattheyses gains, positive gains only) that
+ *   respect the balance bound, plus moves out of overweight parts.
+ *
+ * Edges count 1 each and arc weights are ignored: the cut is what a distributed
+ * computation has to communicate. Directed graphs are partitioned as their
+ * undirected version. Results are deterministic for a given seed.
+ *
+ * Extract() cuts a partitioned graph into shards with halo vertices and cut-edge
+ * lists; GraphView::Write() stores a shard as a snapshot that a worker process
+ * maps without parsing.
+ */
+class GraphPartitioner
+{
+    public:
+        /**
+         * @brief Partition a graph into k parts.
+         *
+         * @param g The graph.
+         * @param k Number of parts, at least 1.
+         * @param imbalance Allowed excess of the largest part over n / k, e.g. 0.03 for 3%.
+         * @param seed Seed of the random visiting orders.
+         * @return The part of every vertex and the quality of the partition.
+         * @throws std::invalid_argument if k < 1 or imbalance is negative.
+         */
+        static PartitionResult Partition(const CSRGraph& g, int k, double imbalance = 0.03, unsigned seed = 1);
+
+        /**
+         * @brief Evaluate an arbitrary partition vector.
+         *
+         * @return Sizes, edge cut, communication volume and imbalance of part; levels is 0.
+         * @throws std::invalid_argument if part has the wrong length or a part outside 0 .. k-1.
+         */
+        static PartitionResult Evaluate(const CSRGraph& g, const std::vector<int>& part, int k);
+
+        /**
+         * @brief Extract the shard of one part.
+         *
+         * Owned vertices and halo vertices are each in increasing global order.
+         * For directed graphs the halo also contains the tails of arcs into the part,
+         * and graph keeps those arcs, so both push and pull algorithms see every
+         * arc they need. O(n + arcs of the part).
+         *
+         * @throws std::invalid_argument if part has the wrong length or p is negative.
+         */
+        static PartitionShard Extract(const CSRGraph& g, const std::vector<int>& part, int p);
+
+        static const int COARSEN_PER_PART = 30;     // Coarsening stops at about this many vertices per part.
+        static const int INITIAL_TRIALS = 4;        // Greedy growing tries per bisection.
+        static const int REFINE_PASSES = 8;         // Refinement passes per level at most.
+};
+
+#endif
@@ -0,0 +1,156 @@
+// GraphView-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread GraphView.cpp GraphView-test.cpp\
+    ../Graph/Graph.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../VertexQueue/VertexQueue.cpp\
+    ../Parallel/Parallel.cpp\
+    ../GraphLoader/GraphLoader.cpp\
+    ../DistanceMatrix/DistanceMatrix.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../EdgeStore/EdgeStore.cpp\
+    ../GraphAnalytics/GraphAnalytics.cpp\
+    ../GraphOrdering/GraphOrdering.cpp\
+    ../GraphPartitioner/GraphPartitioner.cpp\
+    ../FlowNetwork/FlowNetwork.cpp\
+    ../../array/GeneralArray/GeneralArray.cpp\
+    ../../array/SparseMatrix/SparseMatrix.cpp\
+    ../../chain/Node/Node.cpp\
+    ../../chain/DoubleNode/DoubleNode.cpp\
+    ../../chain/ChainIterator/ChainIterator.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedSparseMatrix.cpp\
+    ../../container/MaxHeap/MaxHeap.cpp\
+    ../../container/MinHeap/MinHeap.cpp\
+    ../../container/DaryHeap/DaryHeap.cpp\
+    ../../container/PairingHeap/PairingHeap.cpp\
+    ../../container/FibonacciHeap/FibonacciHeap.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include "GraphView.hpp"
+#include "../Graph/Graph.hpp"
+
+using namespace std;
+
+int main()
+{
+    // ---------------------------------------------------------------
+    // A weighted, undirected graph with non-contiguous node IDs and a self-loop.
+    // ---------------------------------------------------------------
+    Graph g({40, 10, 30, 20}, true, false);
+    g.AddEdge(40, 10, 2.5);
+    g.AddEdge(10, 30, 1);
+    g.AddEdge(30, 40, 4);
+    g.AddEdge(20, 20, 7);
+    g.Save("graphview-test.snapshot");
+
+    {
+        GraphView view("graphview-test.snapshot");
+        cout << "Nodes: " << view.NumberOfNodes() << ", arcs: " << view.NumberOfArcs()
+             << ", directed: " << view.IsDirected() << ", weighted: " << view.IsWeighted() << endl;
+        cout << "Position of node 30: " << view.IndexOf(30) << ", node 25 exists: " << view.ExistsNode(25) << endl;
+
+        cout << "Neighbors of 40:";
+        for (int v : view.Neighbors(40))
+            cout << " " << v;
+        cout << endl;
+
+        // Arcs come sorted by position, with their weights, straight from the mapping.
+        Neighborhood arcs = view.OutArcs(view.IndexOf(30));
+        cout << "Arcs of 30:";
+        for (int k = 0; k < arcs.size; k++)
+            cout << " " << view.NodeId(arcs.target[k]) << "(" << arcs.weight[k] << ")";
+        cout << endl;
+
+        assert(view.ExistsEdge(10, 40) && view.ExistsEdge(40, 10) && !view.ExistsEdge(10, 20));
+        assert(view.Weight(30, 10) == 1 && view.Weight(20, 20) == 7);
+        try
+        {
+            view.Weight(10, 20);
+        }
+        catch (const out_of_range& e)
+        {
+            cout << "Exception: " << e.what() << endl;
+        }
+
+        // Reloading gives back the same nodes and edges (in (u, v) order).
+        Graph back = Graph::Load("graphview-test.snapshot");
+        assert(back.Nodes() == g.Nodes() && back.NumberOfEdges() == g.NumberOfEdges());
+        assert(back.ExistsEdge(40, 10) && back.ExistsEdge(10, 30) && back.ExistsEdge(30, 40) && back.ExistsEdge(20, 20));
+        cout << "Reloaded graph:" << endl << back << endl;
+    }
+
+    // ---------------------------------------------------------------
+    // A random directed graph: every arc and in-arc of the view matches the CSR.
+    // ---------------------------------------------------------------
+    srand(5);
+    EdgeArray edges;
+    edges.numNodes = 500;
+    for (int i = 0; i < 5000; i++)
+    {
+        edges.source.push_back(rand() % 500);
+        edges.target.push_back(rand() % 500);
+        edges.weight.push_back(rand() % 100);
+    }
+    Graph d = Graph::FromEdges(edges, true);
+    d.Save("graphview-test.snapshot");
+    {
+        GraphView view("graphview-test.snapshot");
+        const CSRGraph& csr = d.Compressed();
+        assert(view.NumberOfArcs() == csr.NumberOfArcs());
+        for (int u = 0; u < csr.NumberOfNodes(); u++)
+        {
+            assert(view.OutDegree(u) == csr.OutDegree(u) && view.InDegree(u) == csr.InDegree(u));
+            for (int j = csr.Offsets()[u]; j < csr.Offsets()[u + 1]; j++)
+                assert(view.Weight(u, csr.Targets()[j]) == csr.Weights()[j]);
+            Neighborhood in = view.InArcs(u);
+            for (int k = 0; k < in.size; k++)
+                assert(view.ExistsEdge(in.target[k], u));
+        }
+        assert(Graph::Load("graphview-test.snapshot") == d);
+
+        CSRGraph copy = view.ToCSR();
+        assert(copy.NumberOfArcs() == csr.NumberOfArcs() && copy.IsDirected());
+        cout << "Directed snapshot of " << view.NumberOfNodes() << " nodes and "
+             << view.NumberOfArcs() << " arcs checked." << endl;
+    }
+
+    // ---------------------------------------------------------------
+    // Files that are not snapshots, or are cut short, are rejected.
+    // ---------------------------------------------------------------
+    {
+        ofstream out("graphview-test.snapshot", ios::binary);
+        out << "not a graph";
+    }
+    try
+    {
+        GraphView view("graphview-test.snapshot");
+    }
+    catch (const runtime_error& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+
+    g.Save("graphview-test.snapshot");
+    {
+        ifstream in("graphview-test.snapshot", ios::binary);
+        vector<char> bytes((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+        ofstream out("graphview-test.snapshot", ios::binary | ios::trunc);
+        out.write(bytes.data(), bytes.size() - 64);
+    }
+    try
+    {
+        GraphView view("graphview-test.snapshot");
+    }
+    catch (const runtime_error& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    remove("graphview-test.snapshot");
+    return 0;
+}
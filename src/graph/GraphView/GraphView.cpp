@@ -0,0 +1,401 @@
+#include "GraphView.hpp"
+#include "../Parallel/Parallel.hpp"
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <cstdio>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+// Sections in file order; absent sections have offset and length 0.
+enum SnapshotSection
+{
+    NODES, ORDER, OFFSETS, TARGETS, WEIGHTS, IN_OFFSETS, SOURCES, IN_WEIGHTS
+};
+
+static const char SNAPSHOT_MAGIC[8] = {'M', 'O', 'R', 'T', 'I', 'S', 'G', 'V'};
+static const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+static const std::uint64_t SECTION_ALIGNMENT = 64;
+
+static std::uint64_t alignUp(std::uint64_t x)
+{
+    return (x + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+// =======================================================
+// Writing
+// =======================================================
+
+// Copy the arcs of every vertex sorted by (head, weight): heads go to tgt, weights to w.
+static void sortedArcs(int n, const std::vector<int>& offset, const std::vector<int>& head,
+                       const std::vector<double>& weight, std::vector<int>& tgt, std::vector<double>& w)
+{
+    tgt.resize(head.size());
+    w.resize(head.size());
+    Parallel::ForBlocks(0, n, [&](size_t lo, size_t hi, size_t)
+    {
+        std::vector<std::pair<int, double>> arcs;
+        for (size_t u = lo; u < hi; u++)
+        {
+            arcs.clear();
+            for (int j = offset[u]; j < offset[u + 1]; j++)
+                arcs.push_back({head[j], weight[j]});
+            std::sort(arcs.begin(), arcs.end());
+            for (size_t k = 0; k < arcs.size(); k++)
+            {
+                tgt[offset[u] + k] = arcs[k].first;
+                w[offset[u] + k] = arcs[k].second;
+            }
+        }
+    }, 1 << 10);
+}
+
+static std::vector<std::int64_t> wideOffsets(const std::vector<int>& offset)
+{
+    return std::vector<std::int64_t>(offset.begin(), offset.end());
+}
+
+void GraphView::Write(const std::string& path, const std::vector<int>& nodes, const CSRGraph& g, bool weighted)
+{
+    int n = g.NumberOfNodes();
+    if (static_cast<int>(nodes.size()) != n)
+        throw std::invalid_argument("Need one node identifier per vertex.");
+
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](int a, int b) { return nodes[a] < nodes[b]; });
+    for (int i = 1; i < n; i++)
+        if (nodes[order[i - 1]] == nodes[order[i]])
+            throw std::invalid_argument("Node identifiers must be unique.");
+
+    bool directed = g.IsDirected();
+    std::vector<int> target, source;
+    std::vector<double> weight, inWeight;
+    sortedArcs(n, g.Offsets(), g.Targets(), g.Weights(), target, weight);
+    if (directed)
+        sortedArcs(n, g.InOffsets(), g.Sources(), g.InWeights(), source, inWeight);
+    std::vector<std::int64_t> offset = wideOffsets(g.Offsets());
+    std::vector<std::int64_t> inOffset;
+    if (directed)
+        inOffset = wideOffsets(g.InOffsets());
+
+    // Every section as {data, bytes}; nullptr marks an absent section.
+    std::uint64_t m = target.size();
+    std::pair<const void*, std::uint64_t> data[8] = {
+        {nodes.data(), 4ull * n},
+        {order.data(), 4ull * n},
+        {offset.data(), 8ull * (n + 1)},
+        {target.data(), 4 * m},
+        {weighted ? weight.data() : nullptr, weighted ? 8 * m : 0},
+        {directed ? inOffset.data() : nullptr, directed ? 8ull * (n + 1) : 0},
+        {directed ? source.data() : nullptr, directed ? 4 * m : 0},
+        {directed && weighted ? inWeight.data() : nullptr, directed && weighted ? 8 * m : 0}
+    };
+
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.flags = (directed ? SNAPSHOT_DIRECTED : 0) | (weighted ? SNAPSHOT_WEIGHTED : 0);
+    header.numNodes = n;
+    header.numArcs = m;
+    std::uint64_t position = alignUp(sizeof(SnapshotHeader));
+    for (int s = 0; s < 8; s++)
+    {
+        if (data[s].first == nullptr)
+            continue;
+        header.section[s][0] = position;
+        header.section[s][1] = data[s].second;
+        position = alignUp(position + data[s].second);
+    }
+
+    // Write a temporary file and rename it over path, so readers never map a partial snapshot.
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("Cannot open file for writing: " + temporary);
+        const char padding[SECTION_ALIGNMENT] = {};
+        std::uint64_t written = 0;
+        auto put = [&](const void* bytes, std::uint64_t length)
+        {
+            out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(length));
+            written += length;
+        };
+        put(&header, sizeof(header));
+        for (int s = 0; s < 8; s++)
+        {
+            if (data[s].first == nullptr)
+                continue;
+            put(padding, header.section[s][0] - written);
+            put(data[s].first, data[s].second);
+        }
+        put(padding, position - written);
+        if (!out.flush())
+        {
+            out.close();
+            std::remove(temporary.c_str());
+            throw std::runtime_error("Cannot write file: " + temporary);
+        }
+    }
+    if (std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporary.c_str());
+        throw std::runtime_error("Cannot replace file: " + path);
+    }
+}
+
+// =======================================================
+// Constructors and Destructor
+// =======================================================
+
+GraphView::GraphView(const std::string& path)
+    : file(path, false), n(0), m(0), isDirected(false), isWeighted(false), nodes(nullptr), order(nullptr),
+      offset(nullptr), target(nullptr), weight(nullptr), inOffset(nullptr), source(nullptr), inWeight(nullptr)
+{
+    if (file.Size() < sizeof(SnapshotHeader))
+        throw std::runtime_error("Not a graph snapshot: " + path);
+    SnapshotHeader header;
+    std::memcpy(&header, file.Data(), sizeof(header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0)
+        throw std::runtime_error("Not a graph snapshot: " + path);
+    if (header.byteOrder != BYTE_ORDER_MARK)
+        throw std::runtime_error("Graph snapshot has a different byte order: " + path);
+    if (header.version != VERSION)
+        throw std::runtime_error("Unsupported graph snapshot version " + std::to_string(header.version) + ": " + path);
+    if (header.numNodes > static_cast<std::uint64_t>(std::numeric_limits<int>::max()) || header.numArcs > file.Size())
+        throw std::runtime_error("Corrupt or truncated graph snapshot: " + path);
+
+    n = static_cast<int>(header.numNodes);
+    m = static_cast<std::int64_t>(header.numArcs);
+    isDirected = header.flags & SNAPSHOT_DIRECTED;
+    isWeighted = header.flags & SNAPSHOT_WEIGHTED;
+
+    // Every present section must lie inside the file, be aligned and have the expected size.
+    std::uint64_t nodeBytes = 4 * header.numNodes, offsetBytes = 8 * (header.numNodes + 1);
+    std::uint64_t expected[8] = {
+        nodeBytes, nodeBytes, offsetBytes, 4 * header.numArcs,
+        isWeighted ? 8 * header.numArcs : 0,
+        isDirected ? offsetBytes : 0,
+        isDirected ? 4 * header.numArcs : 0,
+        isDirected && isWeighted ? 8 * header.numArcs : 0
+    };
+    const void* section[8];
+    for (int s = 0; s < 8; s++)
+    {
+        std::uint64_t start = header.section[s][0], length = header.section[s][1];
+        if (length != expected[s] || start % 8 != 0 || start > file.Size() || length > file.Size() - start)
+            throw std::runtime_error("Corrupt or truncated graph snapshot: " + path);
+        section[s] = length > 0 ? file.Data() + start : nullptr;
+    }
+
+    nodes = static_cast<const int*>(section[NODES]);
+    order = static_cast<const int*>(section[ORDER]);
+    offset = static_cast<const std::int64_t*>(section[OFFSETS]);
+    target = static_cast<const int*>(section[TARGETS]);
+    weight = static_cast<const double*>(section[WEIGHTS]);
+    if (isDirected)
+    {
+        inOffset = static_cast<const std::int64_t*>(section[IN_OFFSETS]);
+        source = static_cast<const int*>(section[SOURCES]);
+        inWeight = static_cast<const double*>(section[IN_WEIGHTS]);
+    }
+    else
+    {
+        inOffset = offset;
+        source = target;
+        inWeight = weight;
+    }
+    if (offset[n] != m || inOffset[n] != m)
+        throw std::runtime_error("Corrupt or truncated graph snapshot: " + path);
+}
+
+GraphView::~GraphView()
+{
+    // file unmaps itself.
+}
+
+// =======================================================
+// Accessor Methods (Properties)
+// =======================================================
+
+int GraphView::NumberOfNodes() const
+{
+    return n;
+}
+
+std::int64_t GraphView::NumberOfArcs() const
+{
+    return m;
+}
+
+bool GraphView::IsDirected() const
+{
+    return isDirected;
+}
+
+bool GraphView::IsWeighted() const
+{
+    return isWeighted;
+}
+
+int GraphView::NodeId(int index) const
+{
+    if (index < 0 || index >= n)
+        throw std::out_of_range("Index out of range.");
+    return nodes[index];
+}
+
+int GraphView::IndexOf(int node) const
+{
+    const int* pos = std::lower_bound(order, order + n, node, [&](int p, int id) { return nodes[p] < id; });
+    if (pos == order + n || nodes[*pos] != node)
+        return -1;
+    return *pos;
+}
+
+bool GraphView::ExistsNode(int node) const
+{
+    return IndexOf(node) >= 0;
+}
+
+int GraphView::OutDegree(int index) const
+{
+    return static_cast<int>(offset[index + 1] - offset[index]);
+}
+
+int GraphView::InDegree(int index) const
+{
+    return static_cast<int>(inOffset[index + 1] - inOffset[index]);
+}
+
+// =======================================================
+// Queries
+// =======================================================
+
+Neighborhood GraphView::OutArcs(int index) const
+{
+    if (index < 0 || index >= n)
+        throw std::out_of_range("Index out of range.");
+    return {target + offset[index], weight ? weight + offset[index] : nullptr, OutDegree(index)};
+}
+
+Neighborhood GraphView::InArcs(int index) const
+{
+    if (index < 0 || index >= n)
+        throw std::out_of_range("Index out of range.");
+    return {source + inOffset[index], inWeight ? inWeight + inOffset[index] : nullptr, InDegree(index)};
+}
+
+std::vector<int> GraphView::Neighbors(int node) const
+{
+    int u = IndexOf(node);
+    if (u < 0)
+        throw std::out_of_range("Node does not exist.");
+    std::vector<int> result;
+    result.reserve(OutDegree(u));
+    for (std::int64_t j = offset[u]; j < offset[u + 1]; j++)
+        result.push_back(nodes[target[j]]);
+    return result;
+}
+
+std::int64_t GraphView::findArc(int u, int v) const
+{
+    const int* first = target + offset[u];
+    const int* last = target + offset[u + 1];
+    const int* pos = std::lower_bound(first, last, v);
+    if (pos == last || *pos != v)
+        return -1;
+    return pos - target;
+}
+
+bool GraphView::ExistsEdge(int u, int v) const
+{
+    int a = IndexOf(u), b = IndexOf(v);
+    return a >= 0 && b >= 0 && findArc(a, b) >= 0;
+}
+
+double GraphView::Weight(int u, int v) const
+{
+    int a = IndexOf(u), b = IndexOf(v);
+    std::int64_t j = (a >= 0 && b >= 0) ? findArc(a, b) : -1;
+    if (j < 0)
+        throw std::out_of_range("Edge does not exist.");
+    return weight ? weight[j] : 1.0;
+}
+
+// =======================================================
+// Raw Arrays
+// =======================================================
+
+const int* GraphView::NodeIds() const
+{
+    return nodes;
+}
+
+const std::int64_t* GraphView::Offsets() const
+{
+    return offset;
+}
+
+const int* GraphView::Targets() const
+{
+    return target;
+}
+
+const double* GraphView::Weights() const
+{
+    return weight;
+}
+
+const std::int64_t* GraphView::InOffsets() const
+{
+    return inOffset;
+}
+
+const int* GraphView::Sources() const
+{
+    return source;
+}
+
+const double* GraphView::InWeights() const
+{
+    return inWeight;
+}
+
+EdgeArray GraphView::Edges() const
+{
+    // One edge per directed arc. An undirected edge is kept at its smaller endpoint;
+    // a self-loop is stored as two arcs u -> u, of which every second one is kept.
+    EdgeArray edges;
+    edges.numNodes = n;
+    edges.symmetric = !isDirected;
+    for (int u = 0; u < n; u++)
+    {
+        int loops = 0;
+        for (std::int64_t j = offset[u]; j < offset[u + 1]; j++)
+        {
+            int v = target[j];
+            if (!isDirected && (v < u || (v == u && loops++ % 2 == 1)))
+                continue;
+            edges.source.push_back(u);
+            edges.target.push_back(v);
+            if (weight)
+                edges.weight.push_back(weight[j]);
+        }
+    }
+    return edges;
+}
+
+CSRGraph GraphView::ToCSR() const
+{
+    if (m > std::numeric_limits<int>::max())
+        throw std::length_error("Too many arcs for a CSRGraph.");
+    EdgeArray edges = Edges();
+    if (edges.weight.empty())
+        edges.weight.assign(edges.source.size(), 1.0);
+    return CSRGraph(n, edges.source, edges.target, edges.weight, isDirected);
+}
@@ -0,0 +1,206 @@
+#ifndef GRAPHVIEW
+#define GRAPHVIEW
+
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#include "../CSRGraph/CSRGraph.hpp"
+#include "../GraphLoader/GraphLoader.hpp"
+
+/**
+ * @brief Read-only graph queried directly from a memory-mapped snapshot file.
+ *
+ * A snapshot stores a graph in the layout the queries need, so opening one maps
+ * the file and checks its header but copies nothing: the node table and the
+ * compressed adjacency are read straight from the mapping, and the operating
+ * system loads pages on first touch and shares them between all processes that
+ * open the same file.
+ *
+ * File format, version 1 (little-endian, every section 64-byte aligned):
+ *
+ *   header      SnapshotHeader: magic "MORTISGV", version, byte order mark,
+ *               flags (directed, weighted), n, m and the offset and length of
+ *               every section
+ *   nodes       int32[n]    node identifier of every position
+ *   order       int32[n]    positions sorted by node identifier
+ *   offsets     int64[n+1]  out-arc offsets
+ *   targets     int32[m]    out-arc heads, ascending within every vertex
+ *   weights     float64[m]  out-arc weights (weighted graphs only)
+ *   inOffsets   int64[n+1]  in-arc offsets (directed graphs only)
+ *   sources     int32[m]    in-arc tails, ascending within every vertex (directed graphs only)
+ *   inWeights   float64[m]  in-arc weights (directed, weighted graphs only)
+ *
+ * As in CSRGraph, m counts arcs, so an undirected edge is stored in both
+ * directions. Because the arcs of every vertex are sorted, edge lookups are
+ * binary searches.
+ */
+
+// Arcs of one vertex: size heads and, for weighted graphs, their weights.
+struct Neighborhood
+{
+    const int* target;      // Positions of the heads (tails for in-arcs), ascending.
+    const double* weight;   // Weights, or nullptr if the graph is unweighted (all weights 1).
+    int size;               // Number of arcs.
+};
+
+// Fixed-size header at the start of a snapshot file.
+struct SnapshotHeader
+{
+    char magic[8];                  // "MORTISGV".
+    std::uint32_t version;          // Format version.
+    std::uint32_t byteOrder;        // 0x01020304 as written by the producing machine.
+    std::uint32_t flags;            // SNAPSHOT_DIRECTED | SNAPSHOT_WEIGHTED.
+    std::uint32_t reserved;
+    std::uint64_t numNodes;
+    std::uint64_t numArcs;
+    std::uint64_t section[8][2];    // {byte offset, byte length} of every section, in file order.
+};
+
+class GraphView
+{
+    private:
+        MappedFile file;
+        int n;                          // Number of vertices.
+        std::int64_t m;                 // Number of out-arcs.
+        bool isDirected;
+        bool isWeighted;
+        const int* nodes;               // Node identifier per position.
+        const int* order;               // Positions sorted by node identifier.
+        const std::int64_t* offset;     // Out-arc offsets, n+1 entries.
+        const int* target;              // Out-arc heads.
+        const double* weight;           // Out-arc weights, nullptr if unweighted.
+        const std::int64_t* inOffset;   // In-arc offsets; aliases offset for undirected graphs.
+        const int* source;              // In-arc tails; aliases target for undirected graphs.
+        const double* inWeight;         // In-arc weights; aliases weight for undirected graphs.
+
+        // Position of the arc u -> v in the sorted out-arcs of u, or -1.
+        std::int64_t findArc(int u, int v) const;
+
+    public:
+        static const std::uint32_t VERSION = 1;             // Version written by Write().
+        static const std::uint32_t SNAPSHOT_DIRECTED = 1;   // Header flag bits.
+        static const std::uint32_t SNAPSHOT_WEIGHTED = 2;
+
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        /**
+         * @brief Map a snapshot file.
+         *
+         * Only the header is validated; the sections are used in place.
+         *
+         * @param path Snapshot written by Write() or Graph::Save().
+         * @throws std::runtime_error if the file cannot be opened, is not a snapshot,
+         *         has another version or byte order, or is truncated.
+         */
+        explicit GraphView(const std::string& path);
+
+        /**
+         * @brief Destructor. Unmaps the file.
+         */
+        ~GraphView();
+
+        GraphView(const GraphView&) = delete;
+        GraphView& operator=(const GraphView&) = delete;
+
+        /**
+         * @brief Write a snapshot of a compressed adjacency.
+         *
+         * The file is written next to path and renamed over it when complete, so
+         * processes that open path see either the old or the new snapshot in full.
+         *
+         * @param path Output file.
+         * @param nodes Node identifier of every CSR vertex; must be unique.
+         * @param g The adjacency.
+         * @param weighted If false, no weights are stored and all read back as 1.
+         * @throws std::invalid_argument if nodes does not match g or repeats an identifier.
+         * @throws std::runtime_error if the file cannot be written.
+         */
+        static void Write(const std::string& path, const std::vector<int>& nodes, const CSRGraph& g, bool weighted);
+
+        // ==================================================
+        // Accessor Methods (Properties)
+        // ==================================================
+
+        int NumberOfNodes() const;          // Number of vertices.
+        std::int64_t NumberOfArcs() const;  // Number of stored out-arcs (2m for undirected graphs).
+        bool IsDirected() const;
+        bool IsWeighted() const;
+
+        int NodeId(int index) const;        // Node identifier at a position; throws std::out_of_range.
+        int IndexOf(int node) const;        // Position of a node identifier, or -1. O(log n).
+        bool ExistsNode(int node) const;
+
+        int OutDegree(int index) const;     // Number of out-arcs at a position.
+        int InDegree(int index) const;      // Number of in-arcs at a position.
+
+        // ==================================================
+        // Queries
+        // ==================================================
+
+        // Out-arcs and in-arcs of the vertex at a position, pointing into the mapping.
+        Neighborhood OutArcs(int index) const;
+        Neighborhood InArcs(int index) const;
+
+        /**
+         * @brief Get the neighbors of a node.
+         *
+         * @param node Node identifier.
+         * @return The identifiers of the heads of its out-arcs, in position order.
+         * @throws std::out_of_range if the node does not exist.
+         */
+        std::vector<int> Neighbors(int node) const;
+
+        /**
+         * @brief Check whether an edge exists. O(log n + log degree).
+         *
+         * @param u The source node.
+         * @param v The destination node.
+         * @return True if the edge exists; false if it does not or a node is missing.
+         */
+        bool ExistsEdge(int u, int v) const;
+
+        /**
+         * @brief Get the weight of an edge; the smallest one if there are parallel edges.
+         *
+         * @param u The source node.
+         * @param v The destination node.
+         * @return The weight, 1 for unweighted graphs.
+         * @throws std::out_of_range if the edge does not exist.
+         */
+        double Weight(int u, int v) const;
+
+        // ==================================================
+        // Raw Arrays
+        // ==================================================
+
+        // Sections of the mapping, laid out as described above. Weights() and
+        // InWeights() are nullptr for unweighted graphs.
+        const int* NodeIds() const;
+        const std::int64_t* Offsets() const;
+        const int* Targets() const;
+        const double* Weights() const;
+        const std::int64_t* InOffsets() const;
+        const int* Sources() const;
+        const double* InWeights() const;
+
+        /**
+         * @brief Copy the edges out of the snapshot.
+         *
+         * Endpoints are positions (numNodes is set), every undirected edge appears
+         * once, and the weights are empty for unweighted graphs. Used to rebuild a
+         * mutable Graph (see Graph::Load()).
+         */
+        EdgeArray Edges() const;
+
+        /**
+         * @brief Copy the adjacency into a CSRGraph for the analytics kernels.
+         *
+         * @throws std::length_error if the graph has more arcs than a CSRGraph can index.
+         */
+        CSRGraph ToCSR() const;
+};
+
+#endif
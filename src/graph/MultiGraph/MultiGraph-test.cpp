@@ -1,14 +1,58 @@
 // MultiGraph-test.cpp
 // Compile with (for example):
-// g++ -std=c++17 MultiGraph.cpp MultiGraph-test.cpp ../../array/GeneralArray/GeneralArray.cpp -o test
+// g++ -std=c++17 -pthread MultiGraph.cpp MultiGraph-test.cpp\
+    ../Graph/Graph.cpp\
+    ../CSRGraph/CSRGraph.cpp\
+    ../VertexQueue/VertexQueue.cpp\
+    ../Parallel/Parallel.cpp\
+    ../GraphLoader/GraphLoader.cpp\
+    ../DistanceMatrix/DistanceMatrix.cpp\
+    ../UnionFind/UnionFind.cpp\
+    ../GraphView/GraphView.cpp\
+    ../EdgeStore/EdgeStore.cpp\
+    ../EdgeLog/EdgeLog.cpp\
+    ../GraphAnalytics/GraphAnalytics.cpp\
+    ../GraphOrdering/GraphOrdering.cpp\
+    ../GraphPartitioner/GraphPartitioner.cpp\
+    ../FlowNetwork/FlowNetwork.cpp\
+    ../../array/GeneralArray/GeneralArray.cpp\
+    ../../array/SparseMatrix/SparseMatrix.cpp\
+    ../../chain/Node/Node.cpp\
+    ../../chain/DoubleNode/DoubleNode.cpp\
+    ../../chain/ChainIterator/ChainIterator.cpp\
+    ../../chain/DLIterator/DLIterator.cpp\
+    ../../chain/DoublyLinkedList/DoublyLinkedList.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedMatrixTerm.cpp\
+    ../../chain/LinkedSparseMatrix/LinkedSparseMatrix.cpp -o test
 
 #include <iostream>
 #include <vector>
+#include <map>
 #include <cassert>
+#include <cstdlib>
+#include <algorithm>
+#include <stdexcept>
 #include "MultiGraph.hpp"
 
 using namespace std;
 
+// True if walk takes every edge of g exactly once.
+static bool UsesEveryEdge(const MultiGraph& g, const vector<int>& walk, bool directed)
+{
+    if (static_cast<int>(walk.size()) != g.NumberOfEdges() + 1)
+        return false;
+    map<pair<int, int>, int> taken;
+    for (size_t i = 0; i + 1 < walk.size(); i++)
+    {
+        pair<int, int> edge(walk[i], walk[i + 1]);
+        if (!directed && edge.first > edge.second)
+            swap(edge.first, edge.second);
+        if (++taken[edge] > g.EdgeCount(edge.first, edge.second))
+            return false;
+    }
+    return true;
+}
+
 int main() 
 {
     try {
@@ -84,6 +128,202 @@ int main()
         }
         cout << "mg3 edges after removal:" << endl << mg3 << endl;
         
+        // --- Test Parallel Edges and Degree Counters ---
+        // Two parallel edges 0-1, a self-loop on 1 and an edge 1-2: every degree is even.
+        MultiGraph mg5(3);
+        mg5.AddEdge(0, 1);
+        mg5.AddEdge(1, 0);
+        mg5.AddEdge(1, 1);
+        mg5.AddEdge(1, 2);
+        mg5.AddEdge(2, 1);
+        assert(mg5.EdgeCount(0, 1) == 2 && mg5.EdgeCount(1, 0) == 2 && mg5.EdgeCount(1, 1) == 1);
+        assert(mg5.Degree(0) == 2 && mg5.Degree(1) == 6 && mg5.Degree(2) == 2);
+        assert(mg5.isEulerian());
+        mg5.RemoveEdge(1, 2);
+        assert(mg5.EdgeCount(2, 1) == 1 && !mg5.isEulerian());
+        mg5.RemoveNode(0);
+        assert(mg5.Degree(1) == 3 && mg5.EdgeCount(0, 1) == 0 && mg5.NumberOfEdges() == 2);
+        cout << "\nmg5 after removing node 0: " << mg5 << endl;
+
+        // Directed: EdgeCount follows the direction, in-degree and out-degree are separate.
+        MultiGraph mg6(3, false, true);
+        mg6.AddEdge(0, 1);
+        mg6.AddEdge(0, 1);
+        mg6.AddEdge(1, 2);
+        mg6.AddEdge(2, 0);
+        assert(mg6.EdgeCount(0, 1) == 2 && mg6.EdgeCount(1, 0) == 0);
+        assert(mg6.OutDegree(0) == 2 && mg6.InDegree(1) == 2 && mg6.Degree(0) == 3);
+        assert(!mg6.isEulerian());
+        mg6.AddEdge(1, 2);
+        mg6.AddEdge(2, 0);
+        assert(mg6.isEulerian());
+        mg6.RemoveNode(2);
+        assert(mg6.OutDegree(1) == 0 && mg6.InDegree(0) == 0 && mg6.NumberOfEdges() == 2);
+        try
+        {
+            mg6.RemoveEdge(1, 0);
+            assert(false);
+        }
+        catch (const std::invalid_argument& e)
+        {
+            cout << "Caught expected exception on missing RemoveEdge: " << e.what() << endl;
+        }
+
+        // --- Test Eulerian Circuits and Paths ---
+        // A triangle with a doubled side and a self-loop: every degree is even.
+        MultiGraph tour(4);
+        for (auto edge : vector<pair<int, int>>{{0, 1}, {1, 2}, {2, 0}, {0, 1}, {1, 0}, {2, 2}})
+            tour.AddEdge(edge.first, edge.second);
+        vector<int> circuit = tour.EulerianCircuit();
+        cout << "\nEulerian circuit:";
+        for (int node : circuit)
+            cout << " " << node;
+        cout << endl;
+        assert(tour.isEulerian() && circuit.front() == circuit.back() && UsesEveryEdge(tour, circuit, false));
+
+        // A second component breaks the circuit although the degrees stay even.
+        MultiGraph split = tour;
+        split.AddNode(4);
+        split.AddNode(5);
+        split.AddEdge(4, 5);
+        split.AddEdge(5, 4);
+        assert(!split.isEulerian() && split.EulerianCircuit().empty() && split.EulerianPath().empty());
+
+        // One extra edge leaves two odd nodes: a path but no circuit.
+        tour.AddEdge(0, 3);
+        vector<int> path = tour.EulerianPath();
+        assert(!tour.isEulerian() && tour.EulerianCircuit().empty());
+        assert(UsesEveryEdge(tour, path, false) && (path.front() == 0 || path.front() == 3));
+
+        // Directed: the path starts where out-degree exceeds in-degree.
+        MultiGraph route(3, false, true);
+        for (auto edge : vector<pair<int, int>>{{0, 1}, {1, 2}, {2, 0}, {0, 1}, {1, 0}, {0, 2}})
+            route.AddEdge(edge.first, edge.second);
+        path = route.EulerianPath();
+        assert(path.front() == 0 && path.back() == 2 && UsesEveryEdge(route, path, true));
+        route.AddEdge(2, 0);
+        circuit = route.EulerianCircuit();
+        assert(route.isEulerian() && UsesEveryEdge(route, circuit, true));
+
+        // Random unions of closed walks are Eulerian; the tour must take every edge.
+        srand(5);
+        for (bool directed : {false, true})
+        {
+            MultiGraph big(200, false, directed);
+            for (int walk = 0; walk < 50; walk++)
+            {
+                int first = rand() % 200, at = first;
+                for (int step = 0; step < 100; step++)
+                {
+                    int next = rand() % 200;
+                    big.AddEdge(at, next);
+                    at = next;
+                }
+                big.AddEdge(at, first);
+            }
+            circuit = big.EulerianCircuit();
+            assert(big.isEulerian() && UsesEveryEdge(big, circuit, directed));
+        }
+
+        // --- Test Collapse ---
+        // Three parallel edges 5-7 (one stored as 7-5), one edge 7-9 and an isolated node 11.
+        MultiGraph roads(vector<int>{5, 7, 9, 11}, true, false);
+        roads.AddEdge(5, 7, 2.0);
+        roads.AddEdge(7, 5, 4.0);
+        roads.AddEdge(7, 9, 3.0);
+        roads.AddEdge(5, 7, 1.0);
+        EdgeAggregator aggregators[] = {EdgeAggregator::MIN, EdgeAggregator::MAX, EdgeAggregator::SUM, EdgeAggregator::COUNT};
+        double expected[] = {4.0, 7.0, 10.0, 4.0};
+        cout << "\nCollapsed distance 5 -> 9 (min, max, sum, count):";
+        for (int k = 0; k < 4; k++)
+        {
+            Graph simple = roads.Collapse(aggregators[k]);
+            assert(simple.Nodes() == vector<int>({5, 7, 9, 11}) && simple.NumberOfEdges() == 2);
+            double distance = simple.Dijkstra(5).distance[simple.IndexOf(9)];
+            cout << " " << distance;
+            assert(distance == expected[k]);
+        }
+        cout << endl;
+
+        // Parallel edges add their capacities to a flow; edge 7-5 carries it against its orientation.
+        FlowResult flow = roads.MaxFlow(5, 7);
+        assert(flow.value == 7 && flow.flow[0] - flow.flow[1] + flow.flow[3] == 7 && flow.sourceSide == vector<int>({5}));
+        assert(roads.MaxFlow(5, 9, FlowAlgorithm::DINIC).value == 3 && roads.MaxFlow(5, 11).value == 0);
+
+        // Directed edges keep their direction; unweighted ones stay unweighted under MIN.
+        Graph oneWay = route.Collapse();
+        assert(oneWay.NumberOfEdges() == 5 && oneWay.ExistsEdge(1, 0) && !oneWay.ExistsEdge(2, 1));
+        assert(oneWay == route.Collapse(EdgeAggregator::MAX));
+
+        // --- Test Streaming Ingestion ---
+        // Calls between phone numbers, kept for 10 time units; numbers appear as they call.
+        MultiGraph calls(0, false, true);
+        calls.SetWindow(10);
+        calls.Ingest(1, 2, 0);
+        calls.Ingest(2, 3, 1);
+        calls.Ingest(1, 2, 5);
+        calls.Ingest(3, 1, 12);
+        cout << "\nCalls in the window ending at " << calls.Now() << ": " << calls << endl;
+        assert(calls.NumberOfNodes() == 3 && calls.NumberOfEdges() == 2);
+        assert(calls.EdgeCount(1, 2) == 1 && calls.EdgeCount(2, 3) == 0 && calls.Degree(1) == 2 && calls.Degree(2) == 1);
+        calls.AddEdge(2, 3);    // Stamped 12.
+        assert(calls.ExpireBefore(6) == 1 && calls.NumberOfEdges() == 2 && calls.OutDegree(1) == 0);
+        calls.SetWindow(0);
+        assert(calls.NumberOfEdges() == 2);
+        try
+        {
+            calls.Ingest(1, 3, 11);
+        }
+        catch (const invalid_argument& e)
+        {
+            cout << "Exception: " << e.what() << endl;
+        }
+
+        // Random streams against a recount of the edges still in the window.
+        for (bool directed : {false, true})
+        {
+            MultiGraph stream(0, true, directed);
+            stream.SetWindow(40);
+            vector<pair<pair<int, int>, double>> events;
+            double t = 0;
+            for (int i = 0; i < 3000; i++)
+            {
+                t += rand() % 3;
+                int u = rand() % 30, v = rand() % 30;
+                stream.Ingest(u, v, t, rand() % 5);
+                events.push_back({{u, v}, t});
+                if (i % 250 != 0)
+                    continue;
+                map<pair<int, int>, int> count;
+                map<int, int> degree;
+                int live = 0;
+                for (auto& event : events)
+                {
+                    if (event.second < t - 40)
+                        continue;
+                    int a = event.first.first, b = event.first.second;
+                    if (!directed && a > b)
+                        swap(a, b);
+                    count[{a, b}]++;
+                    degree[a]++;
+                    degree[b]++;
+                    live++;
+                }
+                assert(stream.NumberOfEdges() == live);
+                for (int a = 0; a < 30; a++)
+                {
+                    if (degree.count(a))
+                        assert(stream.Degree(a) == degree[a]);
+                    for (int b = 0; b < 30; b++)
+                    {
+                        int parallel = count[directed || a <= b ? make_pair(a, b) : make_pair(b, a)];
+                        assert(stream.EdgeCount(a, b) == parallel);
+                    }
+                }
+            }
+            assert(stream.Collapse(EdgeAggregator::COUNT).NumberOfEdges() <= stream.NumberOfEdges());
+        }
+
         // --- Test Input Operator ---
         // (For demonstration, we'll simulate input using istringstream.)
         /*
@@ -1,4 +1,9 @@
 #include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <cmath>
 #include "MultiGraph.hpp"
 
 // ================================
@@ -6,12 +11,14 @@
 // ================================
 
 // Default constructor: creates an empty unweighted, undirected multigraph.
-MultiGraph::MultiGraph(): n(0), e(0), isWeighted(false), isDirected(false), nodeVector(), edgelist() {}
+MultiGraph::MultiGraph(): n(0), e(0), isWeighted(false), isDirected(false), nodeVector(), nodeIndex(), edgelist(false), pairs(0),
+                          now(-std::numeric_limits<double>::infinity()), window(std::numeric_limits<double>::infinity()) {}
 
 // Constructor with a specified number of nodes.
 // Initializes nodeVector with nodes 0, 1, ..., numNodes-1.
 MultiGraph::MultiGraph(int numNodes, bool weighted, bool directed): n(numNodes), e(0), 
-                       isWeighted(weighted), isDirected(directed), nodeVector(), edgelist() 
+                       isWeighted(weighted), isDirected(directed), nodeVector(), nodeIndex(), edgelist(weighted), pairs(0), 
+                       now(-std::numeric_limits<double>::infinity()), window(std::numeric_limits<double>::infinity()) 
 {
     // Create nodes 0 through numNodes-1.
     nodeVector.resize(n);
@@ -19,15 +26,143 @@ MultiGraph::MultiGraph(int numNodes, bool weighted, bool directed): n(numNodes),
     {
         nodeVector[i] = i;
     }
+    compactIndex(0);
+    resizeCounters();
     // edgelist remains empty.
 }
 
 // Constructor from a vector of node identifiers.
 MultiGraph::MultiGraph(const std::vector<int>& nodes, bool weighted, bool directed)
-    : n(nodes.size()), e(0), isWeighted(weighted), isDirected(directed), nodeVector(nodes), edgelist() {}
+    : n(nodes.size()), e(0), isWeighted(weighted), isDirected(directed), nodeVector(nodes), nodeIndex(), edgelist(weighted), pairs(0), 
+      now(-std::numeric_limits<double>::infinity()), window(std::numeric_limits<double>::infinity()) 
+{
+    compactIndex(0);
+    if (static_cast<int>(nodeIndex.size()) != n)
+        throw std::invalid_argument("Node identifiers must be unique.");
+    resizeCounters();
+}
 
 // Destructor.
-MultiGraph::~MultiGraph() {}    // Standard containers (nodeVector, edgelist) clean themselves up.
+MultiGraph::~MultiGraph() {}    // Standard containers (nodeVector, nodeIndex, edgelist) clean themselves up.
+
+// Position of a node identifier in nodeVector, or -1 if it does not exist.
+int MultiGraph::indexOf(int node) const 
+{
+    // Nodes that are their own position, as MultiGraph(numNodes) creates them, need no hash lookup.
+    if (node >= 0 && node < n && nodeVector[node] == node)
+        return node;
+    auto it = nodeIndex.find(node);
+    if (it == nodeIndex.end())
+        return -1;
+    return it->second;
+}
+
+// Compaction step: renumber the nodes from position 'from' on after nodeVector changed.
+void MultiGraph::compactIndex(int from) 
+{
+    if (from == 0)
+        nodeIndex.reserve(nodeVector.size());
+    for (int i = from; i < static_cast<int>(nodeVector.size()); i++)
+        nodeIndex[nodeVector[i]] = i;
+}
+
+// Degree counters for every position; new positions start without edges.
+void MultiGraph::resizeCounters() 
+{
+    outDegree.resize(n, 0);
+    if (isDirected)
+        inDegree.resize(n, 0);
+}
+
+// An undirected pair is keyed with its smaller identifier first.
+unsigned long long MultiGraph::pairOf(int u, int v) const 
+{
+    if (!isDirected && u > v)
+        std::swap(u, v);
+    return static_cast<unsigned long long>(static_cast<unsigned int>(u)) << 32 | static_cast<unsigned int>(v);
+}
+
+// Home slot of a key (the finalizer of MurmurHash3), then linear probing.
+static std::size_t pairHome(unsigned long long key, std::size_t mask)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<std::size_t>(key) & mask;
+}
+
+int MultiGraph::findPair(unsigned long long key) const 
+{
+    std::size_t mask = pairKey.size() - 1;
+    std::size_t slot = pairHome(key, mask);
+    while (pairCount[slot] != 0 && pairKey[slot] != key)
+        slot = (slot + 1) & mask;
+    return static_cast<int>(slot);
+}
+
+// The table stays at most half full, doubling as it grows. A pair whose count
+// drops to 0 is removed by shifting the rest of its probe run back, so a sliding
+// window leaves no tombstones behind.
+void MultiGraph::bumpPair(unsigned long long key, int delta) 
+{
+    if (delta > 0 && 2 * (pairs + 1) > static_cast<int>(pairKey.size()))
+    {
+        std::vector<unsigned long long> oldKey(std::max<std::size_t>(16, 2 * pairKey.size()));
+        std::vector<int> oldCount(oldKey.size(), 0);
+        oldKey.swap(pairKey);
+        oldCount.swap(pairCount);
+        for (std::size_t i = 0; i < oldKey.size(); i++)
+        {
+            if (oldCount[i] == 0)
+                continue;
+            int slot = findPair(oldKey[i]);
+            pairKey[slot] = oldKey[i];
+            pairCount[slot] = oldCount[i];
+        }
+    }
+
+    std::size_t slot = findPair(key);
+    if (pairCount[slot] == 0)
+    {
+        pairKey[slot] = key;
+        pairs++;
+    }
+    pairCount[slot] += delta;
+    if (pairCount[slot] != 0)
+        return;
+
+    pairs--;
+    std::size_t mask = pairKey.size() - 1;
+    std::size_t next = slot;
+    while (true)
+    {
+        next = (next + 1) & mask;
+        if (pairCount[next] == 0)
+            break;
+        // Keep the entry at next where it is if its home lies cyclically in (slot, next].
+        std::size_t home = pairHome(pairKey[next], mask);
+        if (slot <= next ? (slot < home && home <= next) : (slot < home || home <= next))
+            continue;
+        pairKey[slot] = pairKey[next];
+        pairCount[slot] = pairCount[next];
+        pairCount[next] = 0;
+        slot = next;
+    }
+}
+
+// Add (delta > 0) or remove (delta < 0) |delta| edges from position iu to position
+// iv in the pair counts and degree counters.
+void MultiGraph::countEdge(int iu, int iv, int delta) 
+{
+    bumpPair(pairOf(nodeVector[iu], nodeVector[iv]), delta);
+    outDegree[iu] += delta;
+    if (isDirected)
+        inDegree[iv] += delta;
+    else
+        outDegree[iv] += delta;     // A self-loop adds 2 to the degree.
+}
 
 // ================================
 // Modification Methods
@@ -36,39 +171,45 @@ MultiGraph::~MultiGraph() {}    // Standard containers (nodeVector, edgelist) cl
 // AddNode: adds a new node. If it already exists, throw an error.
 void MultiGraph::AddNode(int node) 
 {
-    if (std::find(nodeVector.begin(), nodeVector.end(), node) != nodeVector.end())
+    if (nodeIndex.count(node))
         throw std::invalid_argument("Node already exists.");
     
+    nodeIndex[node] = n;
     nodeVector.push_back(node);
     n++;    // (edgelist remains unchanged.)
+    resizeCounters();
 }
 
 // RemoveNode: remove the node and all incident edges.
 void MultiGraph::RemoveNode(int node) 
 {
-    // Remove node from nodeVector.
-    auto it = std::find(nodeVector.begin(), nodeVector.end(), node);
-    if (it == nodeVector.end())
+    int index = indexOf(node);
+    if (index == -1)
         throw std::invalid_argument("Node does not exist.");
-    nodeVector.erase(it);
-    n--;
-
-    // Rebuild edgelist without any edge incident to 'node'.
-    GeneralArray<std::vector<MIXED_TYPE>> newEdgeList;
 
+    // Uncount every edge incident to 'node' while the positions are still valid.
+    std::vector<char> incident(edgelist.Length(), 0);
     for (int i = 0; i < edgelist.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        // Get endpoints using a helper (here we assume that the endpoints are stored as ints).
-        // We use std::get<int> safely since our graph stores integer node IDs.
-        int u = std::get<int>(edge[0]);
-        int v = std::get<int>(edge[1]);
-        if (u == node || v == node)
-            continue; // skip this edge
-        newEdgeList.Push_back(edge);
+        int a = edgelist.Source(i);
+        int b = edgelist.Target(i);
+        if (a != node && b != node)
+            continue;
+        incident[i] = 1;
+        countEdge(indexOf(a), indexOf(b), -1);
     }
+    outDegree.erase(outDegree.begin() + index);
+    if (isDirected)
+        inDegree.erase(inDegree.begin() + index);
 
-    edgelist = newEdgeList;
+    // Remove node from nodeVector.
+    nodeVector.erase(nodeVector.begin() + index);
+    nodeIndex.erase(node);
+    n--;
+    compactIndex(index);
+
+    // Drop the incident edges from the log.
+    edgelist.Compact(incident);
     e = edgelist.Length();
 }
 
@@ -76,8 +217,9 @@ void MultiGraph::RemoveNode(int node)
 void MultiGraph::AddEdge(int u, int v, double w) 
 {
     // Verify that both nodes exist.
-    if (std::find(nodeVector.begin(), nodeVector.end(), u) == nodeVector.end() ||
-        std::find(nodeVector.begin(), nodeVector.end(), v) == nodeVector.end())
+    int iu = indexOf(u);
+    int iv = indexOf(v);
+    if (iu == -1 || iv == -1)
     {
         throw std::invalid_argument("One or both nodes do not exist.");
     }
@@ -85,32 +227,27 @@ void MultiGraph::AddEdge(int u, int v, double w)
     if (!isWeighted)
         w = 1;
     
-    // Build the edge vector.
-    std::vector<MIXED_TYPE> edgeVec;
-    edgeVec.push_back(u);
-    edgeVec.push_back(v);
-    if (isWeighted)
-        edgeVec.push_back(w);
-    
-    // Append the edge to the edgelist.
-    edgelist.Push_back(edgeVec);
+    // Append the edge to the edgelist, stamped with the current time.
+    edgelist.Push(u, v, w, now);
     e++;
+    countEdge(iu, iv, 1);
 }
 
 // RemoveEdge: remove one occurrence of an edge from u to v.
 // (For an undirected multigraph, an edge (u,v) is considered identical to (v,u).)
 void MultiGraph::RemoveEdge(int u, int v) 
 {
-    // We do not need to verify existence of nodes here because we simply remove matching edges.
-    // Rebuild edgelist excluding the first occurrence of an edge connecting u and v.
-    bool removed = false;
-    GeneralArray<std::vector<MIXED_TYPE>> newEdgeList;
+    // The pair counts tell in O(1) whether there is anything to remove.
+    if (EdgeCount(u, v) == 0)
+        throw std::invalid_argument("Edge does not exist.");
+
+    // Drop the first occurrence of an edge connecting u and v.
+    std::vector<char> removed(edgelist.Length(), 0);
 
     for (int i = 0; i < edgelist.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        int a = std::get<int>(edge[0]);
-        int b = std::get<int>(edge[1]);
+        int a = edgelist.Source(i);
+        int b = edgelist.Target(i);
         bool match = false;
 
         if (isDirected) 
@@ -123,22 +260,86 @@ void MultiGraph::RemoveEdge(int u, int v)
             if ((a == u && b == v) || (a == v && b == u))
                 match = true;
         }
-        if (match && !removed) 
+        if (match) 
         {
-            removed = true;  // remove only one occurrence
-            continue;
+            removed[i] = 1;  // remove only one occurrence
+            edgelist.Compact(removed);
+            e = edgelist.Length();
+            countEdge(indexOf(a), indexOf(b), -1);
+            return;
         }
-        newEdgeList.Push_back(edge);
     }
-    if (removed) 
+    throw std::invalid_argument("Edge does not exist.");
+}
+
+// ================================
+// Streaming Ingestion
+// ================================
+
+// Timestamps never decrease along the log, so the expired edges are a prefix of it.
+int MultiGraph::expire(double before) 
+{
+    int k = 0;
+    while (k < e && edgelist.Time(k) < before) 
+    {
+        countEdge(indexOf(edgelist.Source(k)), indexOf(edgelist.Target(k)), -1);
+        k++;
+    }
+    edgelist.PopFront(k);
+    e -= k;
+    return k;
+}
+
+// Ingest: add the missing endpoints, append the edge and move the window to t.
+void MultiGraph::Ingest(int u, int v, double t, double w) 
+{
+    if (!std::isfinite(t) || t < now)
+        throw std::invalid_argument("Timestamps must be finite and must not decrease.");
+    int iu = indexOf(u);
+    if (iu == -1)
     {
-        edgelist = newEdgeList;
-        e = edgelist.Length();
-    } 
-    else 
+        AddNode(u);
+        iu = n - 1;
+    }
+    int iv = indexOf(v);
+    if (iv == -1)
     {
-        throw std::invalid_argument("Edge does not exist.");
+        AddNode(v);
+        iv = n - 1;
     }
+    if (!isWeighted)
+        w = 1;
+
+    now = t;
+    edgelist.Push(u, v, w, t);
+    e++;
+    countEdge(iu, iv, 1);
+    if (window != std::numeric_limits<double>::infinity())
+        expire(now - window);
+}
+
+void MultiGraph::SetWindow(double width) 
+{
+    if (!(width >= 0))
+        throw std::invalid_argument("Window width must be non-negative.");
+    window = width;
+    if (window != std::numeric_limits<double>::infinity())
+        expire(now - window);
+}
+
+int MultiGraph::ExpireBefore(double time) 
+{
+    return expire(time);
+}
+
+double MultiGraph::Now() const 
+{
+    return now;
+}
+
+double MultiGraph::Window() const 
+{
+    return window;
 }
 
 // ================================
@@ -151,46 +352,21 @@ bool MultiGraph::IsEmpty() const
     return nodeVector.empty();
 }
 
-// Additional functions: isEulerian and isHamilton.
-// (These are usually NP-hard; here we implement simple criteria.)
-
 // isEulerian: For undirected graph, Eulerian if every node has even degree.
 // For directed graph, Eulerian if for every node, indegree equals outdegree.
+// In both cases all edges must also lie in one connected component.
+// The degree test is O(V) on the cached counters; the connectivity test is O(V + E).
 bool MultiGraph::isEulerian() const 
 {
     if (IsEmpty())
         return false;
     
-    if (!isDirected) 
-    {
-        // Check that every node has even degree.
-        for (int node : nodeVector) 
-        {
-            if (Degree(node) % 2 != 0)
-                return false;
-        }
-        return true;
-    } 
-    else 
+    for (int i = 0; i < n; i++) 
     {
-        // For directed: compute indegree and outdegree.
-        std::vector<int> indegree(n, 0), outdegree(n, 0);
-
-        for (int i = 0; i < edgelist.Length(); i++) 
-        {
-            std::vector<MIXED_TYPE> edge = edgelist[i];
-            int u = std::get<int>(edge[0]);
-            int v = std::get<int>(edge[1]);
-            outdegree[u]++;
-            indegree[v]++;
-        }
-        for (int i = 0; i < n; i++) 
-        {
-            if (indegree[i] != outdegree[i])
-                return false;
-        }
-        return true;
+        if (isDirected ? inDegree[i] != outDegree[i] : outDegree[i] % 2 != 0)
+            return false;
     }
+    return e == 0 || !EulerianCircuit().empty();
 }
 
 int MultiGraph::NumberOfNodes() const 
@@ -211,57 +387,212 @@ int MultiGraph::NumberOfEdges() const
 // For directed graphs, degree is outdegree + indegree.
 int MultiGraph::Degree(int u) const 
 {
-    // Verify that u exists.
-    if (std::find(nodeVector.begin(), nodeVector.end(), u) == nodeVector.end())
+    int index = indexOf(u);
+    if (index == -1)
         throw std::invalid_argument("Node does not exist.");
+    return isDirected ? outDegree[index] + inDegree[index] : outDegree[index];
+}
 
-    int deg = 0;
+int MultiGraph::InDegree(int u) const 
+{
+    int index = indexOf(u);
+    if (index == -1)
+        throw std::invalid_argument("Node does not exist.");
+    return isDirected ? inDegree[index] : outDegree[index];
+}
 
-    for (int i = 0; i < edgelist.Length(); i++) 
+int MultiGraph::OutDegree(int u) const 
+{
+    int index = indexOf(u);
+    if (index == -1)
+        throw std::invalid_argument("Node does not exist.");
+    return outDegree[index];
+}
+
+// EdgeCount: returns the number of edges between u and v, 0 if either node does not exist.
+// For undirected graphs, count both (u,v) and (v,u) as the same.
+int MultiGraph::EdgeCount(int u, int v) const 
+{
+    // Pairs of missing nodes are never in the table.
+    if (pairs == 0)
+        return 0;
+    return pairCount[findPair(pairOf(u, v))];
+}
+
+// ================================
+// Eulerian Tours
+// ================================
+
+// Hierholzer's algorithm from position start, over the edges reachable from it.
+// Returns the node identifiers of the walk; it uses every edge exactly when its
+// length is e + 1, so a short result means the edges are not connected.
+std::vector<int> MultiGraph::hierholzer(int start) const 
+{
+    // Nodes built by MultiGraph(numNodes) are their own positions; then the
+    // endpoints need no hash lookups.
+    bool identity = true;
+    for (int v = 0; v < n && identity; v++)
+        identity = nodeVector[v] == v;
+    auto position = [&](int node) { return identity ? node : nodeIndex.at(node); };
+
+    // Incidence lists per position as (edge id, other endpoint): the out-edges of
+    // every node, and for undirected multigraphs the edge at both endpoints (a
+    // self-loop once).
+    std::vector<int> from(e), to(e);
+    std::vector<int> offset(n + 1, 0);
+    for (int i = 0; i < e; i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        int a = std::get<int>(edge[0]);
-        int b = std::get<int>(edge[1]);
-        if (isDirected) 
+        from[i] = position(edgelist.Source(i));
+        to[i] = position(edgelist.Target(i));
+        offset[from[i] + 1]++;
+        if (!isDirected && to[i] != from[i])
+            offset[to[i] + 1]++;
+    }
+    for (int v = 0; v < n; v++)
+        offset[v + 1] += offset[v];
+    std::vector<std::pair<int, int>> incident(offset[n]);
+    std::vector<int> cursor(offset.begin(), offset.end() - 1);
+    for (int i = 0; i < e; i++) 
+    {
+        incident[cursor[from[i]]++] = {i, to[i]};
+        if (!isDirected && to[i] != from[i])
+            incident[cursor[to[i]]++] = {i, from[i]};
+    }
+    cursor.assign(offset.begin(), offset.end() - 1);
+
+    // Follow unused edges until stuck, then back up and emit the nodes. Cursors
+    // only move forward, so each incidence entry is looked at once. A directed
+    // edge sits in one list only and needs no used flag.
+    std::vector<char> used(isDirected ? 0 : e, 0);
+    std::vector<int> stack(1, start);
+    std::vector<int> walk;
+    walk.reserve(e + 1);
+    while (!stack.empty()) 
+    {
+        int v = stack.back();
+        if (!isDirected)
         {
-            if (a == u) deg++;       // out edge
-            if (b == u) deg++;       // in edge
-        } 
-        else 
+            while (cursor[v] < offset[v + 1] && used[incident[cursor[v]].first])
+                cursor[v]++;
+        }
+        if (cursor[v] == offset[v + 1]) 
         {
-            if (a == u || b == u)
-                deg++; // each edge incident to u
+            walk.push_back(nodeVector[v]);
+            stack.pop_back();
+            continue;
         }
+        const std::pair<int, int>& next = incident[cursor[v]++];
+        if (!isDirected)
+            used[next.first] = 1;
+        stack.push_back(next.second);
     }
-
-    return deg;
+    std::reverse(walk.begin(), walk.end());
+    return walk;
 }
 
-// EdgeCount: returns the number of edges between u and v.
-// For undirected graphs, count both (u,v) and (v,u) as the same.
-int MultiGraph::EdgeCount(int u, int v) const 
+// EulerianCircuit: every degree even (in-degree == out-degree if directed) and one
+// walk from any node with edges covers all of them.
+std::vector<int> MultiGraph::EulerianCircuit() const 
 {
-    int count = 0;
-
-    for (int i = 0; i < edgelist.Length(); i++) 
+    int start = -1;
+    for (int i = 0; i < n; i++) 
     {
-        std::vector<MIXED_TYPE> edge = edgelist[i];
-        int a = std::get<int>(edge[0]);
-        int b = std::get<int>(edge[1]);
+        if (isDirected ? inDegree[i] != outDegree[i] : outDegree[i] % 2 != 0)
+            return {};
+        if (start == -1 && outDegree[i] > 0)
+            start = i;
+    }
+    if (start == -1)
+        return {};
+    std::vector<int> walk = hierholzer(start);
+    if (static_cast<int>(walk.size()) != e + 1)
+        return {};
+    return walk;
+}
 
-        if (isDirected)
+// EulerianPath: at most two odd nodes (undirected), or one node with one more
+// out-edge and one with one more in-edge (directed); the walk starts at the first.
+std::vector<int> MultiGraph::EulerianPath() const 
+{
+    int start = -1, odd = 0, surplus = 0, deficit = 0;
+    for (int i = 0; i < n; i++) 
+    {
+        if (isDirected) 
         {
-            if (a == u && b == v)
-                count++;
+            int balance = outDegree[i] - inDegree[i];
+            if (balance == 1)
+            {
+                surplus++;
+                start = i;
+            }
+            else if (balance == -1)
+                deficit++;
+            else if (balance != 0)
+                return {};
         } 
-        else 
+        else if (outDegree[i] % 2 != 0) 
         {
-            if ((a == u && b == v) || (a == v && b == u))
-                count++;
+            if (odd++ == 0)
+                start = i;
         }
     }
+    if (odd > 2 || surplus > 1 || deficit > 1 || surplus != deficit)
+        return {};
+    if (start == -1)
+        return EulerianCircuit();
+    std::vector<int> walk = hierholzer(start);
+    if (static_cast<int>(walk.size()) != e + 1)
+        return {};
+    return walk;
+}
+
+// ================================
+// Flows
+// ================================
+
+FlowResult MultiGraph::MaxFlow(int source, int sink, FlowAlgorithm algorithm) const 
+{
+    int s = indexOf(source);
+    int t = indexOf(sink);
+    if (s == -1 || t == -1)
+        throw std::invalid_argument("Node does not exist.");
+
+    std::vector<int> src(e), dst(e);
+    std::vector<double> capacity(isWeighted ? e : 0);     // Empty if unweighted: capacity 1.
+    for (int i = 0; i < e; i++) 
+    {
+        src[i] = nodeIndex.at(edgelist.Source(i));
+        dst[i] = nodeIndex.at(edgelist.Target(i));
+        if (isWeighted)
+            capacity[i] = edgelist.Weight(i);
+    }
+    FlowNetwork network(n, src, dst, capacity, isDirected);
+    FlowResult result = network.MaxFlow(s, t, algorithm);
+    for (int& v : result.sourceSide)
+        v = nodeVector[v];
+    return result;
+}
 
-    return count;
+// ================================
+// Conversion
+// ================================
+
+// Collapse: copy the edges out of the log and let the bulk path of Graph sort,
+// group and aggregate them.
+Graph MultiGraph::Collapse(EdgeAggregator aggregate) const 
+{
+    EdgeArray edges;
+    edges.source.resize(e);
+    edges.target.resize(e);
+    edges.weight.resize(isWeighted ? e : 0);     // Empty if unweighted.
+    for (int i = 0; i < e; i++) 
+    {
+        edges.source[i] = edgelist.Source(i);
+        edges.target[i] = edgelist.Target(i);
+        if (isWeighted)
+            edges.weight[i] = edgelist.Weight(i);
+    }
+    return Graph::FromEdges(nodeVector, std::move(edges), isDirected, aggregate);
 }
 
 // ================================
@@ -277,7 +608,15 @@ MultiGraph& MultiGraph::operator=(const MultiGraph& other)
         isWeighted = other.isWeighted;
         isDirected = other.isDirected;
         nodeVector = other.nodeVector;
+        nodeIndex = other.nodeIndex;
         edgelist = other.edgelist;
+        pairKey = other.pairKey;
+        pairCount = other.pairCount;
+        pairs = other.pairs;
+        outDegree = other.outDegree;
+        inDegree = other.inDegree;
+        now = other.now;
+        window = other.window;
     }
 
     return *this;
@@ -306,11 +645,10 @@ std::ostream& operator<<(std::ostream& out, const MultiGraph& mg)
 
     for (int i = 0; i < mg.edgelist.Length(); i++) 
     {
-        std::vector<MIXED_TYPE> edge = mg.edgelist[i];
         out << "{";
-        out << std::get<int>(edge[0]) << ", " << std::get<int>(edge[1]);
-        if (mg.isWeighted && edge.size() >= 3)
-            out << ", " << std::get<double>(edge[2]);
+        out << mg.edgelist.Source(i) << ", " << mg.edgelist.Target(i);
+        if (mg.isWeighted)
+            out << ", " << mg.edgelist.Weight(i);
         out << "} ";
     }
 
@@ -2,8 +2,11 @@
 #define MULTIGRAPH
 
 #include <vector>
+#include <unordered_map>
 
 #include "../../array/GeneralArray/GeneralArray.hpp"
+#include "../EdgeLog/EdgeLog.hpp"
+#include "../Graph/Graph.hpp"
 
 using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
 
@@ -17,6 +20,19 @@ using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
  *
  * The multigraph can operate in both weighted and unweighted modes, and can be either directed or undirected.
  * In an undirected multigraph, the edge {u, v, w} is considered identical to {v, u, w}.
+ *
+ * Besides the edge list, the multigraph keeps the number of parallel edges of every
+ * connected pair of nodes in one open-addressing hash table, and cached degree
+ * counters. Degree, InDegree, OutDegree and EdgeCount are O(1) (one hash lookup).
+ * isEulerian runs its degree test in O(V) on the counters, then O(V + E) for the
+ * connectivity walk. In an undirected multigraph a self-loop adds 2 to the degree
+ * of its node.
+ *
+ * The edge list is an EdgeLog: appending never moves the edges already stored,
+ * and every edge carries a timestamp. Ingest() feeds the multigraph from a stream
+ * of timestamped edges, and SetWindow() keeps only the edges of a sliding time
+ * window; expired edges leave from the front of the log and from the counters,
+ * so ingestion costs O(1) per edge however long the stream.
  */
 
 using MIXED_TYPE = std::variant<int, char, float, bool, double, std::string>;
@@ -27,9 +43,27 @@ class MultiGraph
         int n;                       // Number of vertices.
         int e;                       // Number of edges.
         std::vector<int> nodeVector; // List of node identifiers.
-        GeneralArray<std::vector<MIXED_TYPE>> edgelist;
+        std::unordered_map<int, int> nodeIndex;  // Node identifier -> position in nodeVector.
+        EdgeLog edgelist;            // Edges as node identifiers, in insertion order, with their timestamps.
         bool isWeighted;  // If true, edges carry weights (otherwise, weight is forced to 1).
         bool isDirected;  // If true, the multigraph is directed; otherwise, it is undirected.
+        std::vector<unsigned long long> pairKey;    // Hash table slots: node identifiers u, v of a pair (u <= v if undirected).
+        std::vector<int> pairCount;  // Number of edges of the pair in every slot; 0 marks an empty slot.
+        int pairs;                   // Occupied slots.
+        std::vector<int> outDegree;  // Out-degree per position; the degree if undirected.
+        std::vector<int> inDegree;   // In-degree per position (directed only).
+        double now;                  // Latest timestamp seen; -infinity before the first.
+        double window;               // Width of the time window; infinity keeps every edge.
+
+        int indexOf(int node) const;    // Position of a node identifier, or -1 if it does not exist. O(1).
+        void compactIndex(int from);    // Renumber nodeIndex for nodeVector[from..].
+        void resizeCounters();          // Give every position in nodeVector its (zero) degree counters.
+        unsigned long long pairOf(int u, int v) const;      // Hash table key of the pair of node identifiers u, v.
+        int findPair(unsigned long long key) const;         // Slot holding key, or the empty slot where it would go.
+        void bumpPair(unsigned long long key, int delta);   // Add delta to the count of a pair; pairs dropping to 0 are removed.
+        void countEdge(int iu, int iv, int delta);  // Add delta edges from position iu to position iv to the pair counts and degrees.
+        int expire(double before);                  // Drop the edges stamped before the given time from the front of the log.
+        std::vector<int> hierholzer(int start) const;   // Walk from position start using every reachable edge once. O(V + E).
 
     public:
         // Constructors and Destructor
@@ -44,19 +78,114 @@ class MultiGraph
         void AddEdge(int u, int v, double w = 1);   // Add an edge to the multigraph. w The weight (default is 1).
         void RemoveEdge(int u, int v);              // Remove an edge from the multigraph.
 
+        // Streaming Ingestion
+        /**
+         * @brief Append an edge of a stream: edge {u, v, w} seen at time t.
+         *
+         * Nodes that do not exist yet are added. Then the edges that fell out of the
+         * time window (stamped before t - width) are expired. Amortized O(1): a hash
+         * lookup per endpoint and one pair count update, for the new edge and for
+         * every expired one.
+         *
+         * @param t Timestamp; not below the latest timestamp seen, and finite.
+         * @param w The weight (ignored by unweighted multigraphs).
+         * @throws std::invalid_argument if t is not finite or below Now().
+         */
+        void Ingest(int u, int v, double t, double w = 1);
+
+        /**
+         * @brief Keep only the edges stamped in [Now() - width, Now()].
+         *
+         * Edges outside the window are expired at once and from then on whenever
+         * Ingest() moves the clock. Edges added by AddEdge() carry the timestamp
+         * Now() had when they were added. The default width, infinity, keeps every edge.
+         *
+         * @throws std::invalid_argument if width is negative or NaN.
+         */
+        void SetWindow(double width);
+
+        /**
+         * @brief Drop every edge stamped before the given time, whatever the window.
+         *
+         * The nodes stay. O(1) per dropped edge.
+         *
+         * @return The number of edges dropped.
+         */
+        int ExpireBefore(double time);
+
+        double Now() const;         // Latest timestamp passed to Ingest(); -infinity before the first.
+        double Window() const;      // Width of the time window.
+
         // Global Properties
         bool IsEmpty() const;                 // True if there are no nodes in the multigraph
-        bool isEulerian() const;              // if a multigraph is Eulerian
+        bool isEulerian() const;              // True if the multigraph has an Eulerian circuit (degree test, then connectivity).
         int NumberOfNodes() const;            // Get the total number of nodes
         int NumberOfEdges() const;            // Get the total number of edges
 
         // Local Properties
-        int Degree(int u) const;              // Get the degree of node u
-        int EdgeCount(int u, int v) const;    // Number of edges from node u to node v
+        int Degree(int u) const;              // Get the degree of node u (in-degree + out-degree if directed). O(1).
+        int InDegree(int u) const;            // Number of edges into node u; the degree if undirected. O(1).
+        int OutDegree(int u) const;           // Number of edges out of node u; the degree if undirected. O(1).
+        int EdgeCount(int u, int v) const;    // Number of edges from node u to node v. O(1).
+
+        // Eulerian Tours
+        /**
+         * @brief Eulerian circuit by Hierholzer's algorithm: a closed walk using every edge exactly once.
+         *
+         * Every edge is taken once through per-node cursors over an incidence list built from
+         * the edge list, so the whole walk is O(V + E). For directed multigraphs the walk
+         * follows edge directions. Nodes without edges may be anywhere.
+         *
+         * @return The node identifiers along the circuit, NumberOfEdges() + 1 of them with the
+         *         first equal to the last; empty if there is no edge or no Eulerian circuit
+         *         (a node of odd degree, in-degree != out-degree, or edges in several components).
+         */
+        std::vector<int> EulerianCircuit() const;
+
+        /**
+         * @brief Eulerian path by Hierholzer's algorithm: a walk using every edge exactly once.
+         *
+         * The path starts at a node of odd degree (undirected) or with one more outgoing than
+         * incoming edge (directed) if there is one; otherwise it is a circuit. O(V + E).
+         *
+         * @return The node identifiers along the path, NumberOfEdges() + 1 of them; empty if
+         *         there is no edge or no Eulerian path.
+         */
+        std::vector<int> EulerianPath() const;
+
+        // Flows
+        /**
+         * @brief Maximum flow and minimum cut between two nodes.
+         *
+         * Edge weights are the capacities (1 if unweighted), so parallel edges add up;
+         * undirected edges carry flow either way. See FlowNetwork for the algorithms;
+         * build a FlowNetwork once to solve many source and sink pairs.
+         *
+         * @return The flow value; flow[i] is the flow on the i-th edge in insertion order;
+         *         sourceSide holds node identifiers.
+         * @throws std::invalid_argument if a node does not exist, source == sink or a weight is negative.
+         */
+        FlowResult MaxFlow(int source, int sink, FlowAlgorithm algorithm = FlowAlgorithm::PUSH_RELABEL) const;
+
+        // Conversion
+        /**
+         * @brief Collapse parallel edges into a simple Graph.
+         *
+         * Every group of parallel edges (both orientations if undirected) becomes one
+         * edge weighted by the MIN, MAX or SUM of the group's weights, or by its COUNT.
+         * The edges are sort-grouped in parallel and the graph is built through the
+         * bulk path of Graph::FromEdges(), in O(E log E) overall. The graph has the
+         * same nodes in the same order and the same directedness; it is weighted if
+         * the multigraph is or aggregate is SUM or COUNT.
+         *
+         * @param aggregate How parallel edges are merged (default MIN, for shortest paths).
+         * @return The simple graph.
+         */
+        Graph Collapse(EdgeAggregator aggregate = EdgeAggregator::MIN) const;
 
         // Operator Overloads
         MultiGraph& operator=(const MultiGraph& other); // Assignment operator (deep copy)
-        bool operator==(const MultiGraph& other) const; // equal if they have the same structure and edge weights
+        bool operator==(const MultiGraph& other) const; // equal if they have the same structure, edge weights and edge timestamps
         bool operator!=(const MultiGraph& other) const; // True if the multigraphs are not identical.
         friend std::ostream& operator<<(std::ostream& out, const MultiGraph& multigraph);   // printed as a list of edge triplets {u, v, w}
         friend std::istream& operator>>(std::istream& in, MultiGraph& multigraph);          // input in the form of edge triplets {u, v, w}
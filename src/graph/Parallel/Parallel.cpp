@@ -0,0 +1,19 @@
+#include "Parallel.hpp"
+#include <stdexcept>
+
+int Parallel::threadCount = 0;
+
+int Parallel::ThreadCount()
+{
+    if (threadCount > 0)
+        return threadCount;
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware == 0 ? 1 : static_cast<int>(hardware);
+}
+
+void Parallel::SetThreadCount(int count)
+{
+    if (count < 0)
+        throw std::invalid_argument("Thread count must be non-negative.");
+    threadCount = count;
+}
@@ -0,0 +1,147 @@
+#ifndef PARALLEL
+#define PARALLEL
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+
+/**
+ * @brief Minimal fork-join helpers shared by the graph algorithms.
+ *
+ * Work is split into one contiguous block per worker and run on std::thread;
+ * the calling thread takes the first block. Ranges shorter than the grain size
+ * run inline, so small inputs never pay for thread creation. An exception thrown
+ * inside a block is propagated to the caller once every block has finished.
+ *
+ * The number of workers defaults to std::thread::hardware_concurrency() and can
+ * be changed with SetThreadCount() (1 makes every helper sequential).
+ */
+
+class Parallel
+{
+    private:
+        static int threadCount;     // 0 means "use the hardware concurrency".
+
+    public:
+        static int ThreadCount();               // Number of workers used by the helpers (at least 1).
+        static void SetThreadCount(int count);  // Set the number of workers; 0 restores the default.
+
+        /**
+         * @brief Split [begin, end) into at most ThreadCount() blocks and run body(lo, hi, block) on each.
+         *
+         * @param begin First index.
+         * @param end One past the last index.
+         * @param body Callable taking (size_t lo, size_t hi, int block).
+         * @param grain Minimum number of indices per block.
+         * @return The number of blocks used; block ids are 0 .. result-1.
+         */
+        template <class Body>
+        static int ForBlocks(size_t begin, size_t end, Body body, size_t grain = 4096);
+
+        /**
+         * @brief Run body(i) for every i in [begin, end), in parallel.
+         */
+        template <class Body>
+        static void For(size_t begin, size_t end, Body body, size_t grain = 4096);
+
+        /**
+         * @brief Sort a vector in parallel: every block is sorted on its own thread,
+         * then the sorted runs are merged pairwise, also in parallel.
+         */
+        template <class T, class Compare>
+        static void Sort(std::vector<T>& data, Compare less);
+};
+
+template <class Body>
+int Parallel::ForBlocks(size_t begin, size_t end, Body body, size_t grain)
+{
+    if (end <= begin)
+        return 0;
+
+    size_t count = end - begin;
+    size_t blocks = std::min<size_t>(ThreadCount(), (count + grain - 1) / std::max<size_t>(grain, 1));
+    blocks = std::max<size_t>(blocks, 1);
+    if (blocks == 1)
+    {
+        body(begin, end, 0);
+        return 1;
+    }
+
+    // An exception thrown by any block is rethrown on the calling thread after all blocks finished.
+    std::vector<std::exception_ptr> error(blocks);
+    auto run = [&](size_t b)
+    {
+        try
+        {
+            body(begin + count * b / blocks, begin + count * (b + 1) / blocks, static_cast<int>(b));
+        }
+        catch (...)
+        {
+            error[b] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(blocks - 1);
+    for (size_t b = 1; b < blocks; b++)
+        workers.emplace_back(run, b);
+    run(0);
+    for (std::thread& t : workers)
+        t.join();
+    for (const std::exception_ptr& e : error)
+        if (e)
+            std::rethrow_exception(e);
+    return static_cast<int>(blocks);
+}
+
+template <class Body>
+void Parallel::For(size_t begin, size_t end, Body body, size_t grain)
+{
+    ForBlocks(begin, end, [&body](size_t lo, size_t hi, int)
+    {
+        for (size_t i = lo; i < hi; i++)
+            body(i);
+    }, grain);
+}
+
+template <class T, class Compare>
+void Parallel::Sort(std::vector<T>& data, Compare less)
+{
+    const size_t grain = 1 << 16;
+    size_t count = data.size();
+    size_t blocks = std::min<size_t>(ThreadCount(), (count + grain - 1) / grain);
+    if (blocks <= 1)
+    {
+        std::sort(data.begin(), data.end(), less);
+        return;
+    }
+
+    // Run boundaries: run b is [bound[b], bound[b+1]).
+    std::vector<size_t> bound(blocks + 1);
+    for (size_t b = 0; b <= blocks; b++)
+        bound[b] = count * b / blocks;
+
+    For(0, blocks, [&](size_t b)
+    {
+        std::sort(data.begin() + bound[b], data.begin() + bound[b + 1], less);
+    }, 1);
+
+    // Merge neighboring runs until a single run remains.
+    for (size_t width = 1; width < blocks; width *= 2)
+    {
+        size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+        For(0, pairs, [&](size_t p)
+        {
+            size_t lo = 2 * width * p;
+            size_t mid = std::min(lo + width, blocks);
+            size_t hi = std::min(lo + 2 * width, blocks);
+            if (mid < hi)
+                std::inplace_merge(data.begin() + bound[lo], data.begin() + bound[mid],
+                                   data.begin() + bound[hi], less);
+        }, 1);
+    }
+}
+
+#endif
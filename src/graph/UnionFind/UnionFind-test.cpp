@@ -0,0 +1,92 @@
+// UnionFind-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 -O2 -pthread UnionFind.cpp UnionFind-test.cpp\
+    ../Parallel/Parallel.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include "UnionFind.hpp"
+#include "../Parallel/Parallel.hpp"
+
+using namespace std;
+
+// Sequential reference: plain parent array with path compression.
+static int Root(vector<int>& parent, int x)
+{
+    while (parent[x] != x)
+        x = parent[x] = parent[parent[x]];
+    return x;
+}
+
+int main()
+{
+    UnionFind uf(8);
+    uf.Unite(0, 1);
+    uf.Unite(2, 3);
+    uf.Unite(1, 3);
+    uf.Unite(5, 6);
+    cout << "Sets: " << uf.NumberOfSets() << endl;
+    cout << "0 and 2 connected: " << uf.Connected(0, 2) << endl;
+    cout << "0 and 5 connected: " << uf.Connected(0, 5) << endl;
+    cout << "Uniting 0 and 3 again: " << uf.Unite(0, 3) << endl;
+    cout << "Representatives:";
+    for (int r : uf.Representatives())
+        cout << " " << r;
+    cout << endl;
+    try
+    {
+        uf.Find(8);
+    }
+    catch (const out_of_range& e)
+    {
+        cout << "Exception: " << e.what() << endl;
+    }
+    UnionFind copy = uf;
+    copy.Unite(4, 7);
+    cout << "Sets in the copy after one more union: " << copy.NumberOfSets() << ", original: " << uf.NumberOfSets() << endl << endl;
+
+    // Random pairs united concurrently on four threads, checked against a sequential run.
+    Parallel::SetThreadCount(4);
+    srand(5);
+    for (int trial = 0; trial < 10; trial++)
+    {
+        int n = 1000 + rand() % 50000;
+        vector<int> a, b;
+        for (int i = 0; i < n; i++)
+        {
+            a.push_back(rand() % n);
+            b.push_back(rand() % n);
+        }
+
+        vector<int> parent(n);
+        for (int i = 0; i < n; i++)
+            parent[i] = i;
+        long long expected = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int ra = Root(parent, a[i]), rb = Root(parent, b[i]);
+            if (ra != rb)
+            {
+                parent[ra] = rb;
+                expected++;
+            }
+        }
+
+        UnionFind concurrent(n);
+        assert(concurrent.UniteAll(a, b) == expected);
+        assert(concurrent.NumberOfSets() == n - expected);
+        vector<int> rep = concurrent.Representatives();
+        for (int i = 0; i < n; i++)
+        {
+            int j = rand() % n;
+            assert((rep[i] == rep[j]) == (Root(parent, i) == Root(parent, j)));
+            assert(concurrent.Find(i) == rep[i]);
+        }
+    }
+    cout << "Concurrent unions agree with the sequential reference." << endl;
+    Parallel::SetThreadCount(0);
+    return 0;
+}
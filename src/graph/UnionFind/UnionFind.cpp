@@ -0,0 +1,173 @@
+#include "UnionFind.hpp"
+#include <stdexcept>
+#include "../Parallel/Parallel.hpp"
+
+// ================================
+// Constructors and Destructor
+// ================================
+
+UnionFind::UnionFind(int n) : n(0), node(), sets(0)
+{
+    Reset(n);
+}
+
+UnionFind::UnionFind(const UnionFind& other) : n(0), node(), sets(0)
+{
+    *this = other;
+}
+
+UnionFind& UnionFind::operator=(const UnionFind& other)
+{
+    if (this == &other)
+        return *this;
+    n = other.n;
+    node.reset(new std::atomic<std::uint64_t>[n]);
+    Parallel::For(0, n, [&](size_t i)
+    {
+        node[i].store(other.node[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }, 1 << 16);
+    sets.store(other.sets.load());
+    return *this;
+}
+
+UnionFind::~UnionFind() {}
+
+void UnionFind::Reset(int count)
+{
+    if (count < 0)
+        throw std::invalid_argument("Number of elements must be non-negative.");
+    n = count;
+    node.reset(new std::atomic<std::uint64_t>[n]);
+    Parallel::For(0, n, [&](size_t i) { node[i].store(pack(0, static_cast<int>(i)), std::memory_order_relaxed); }, 1 << 16);
+    sets.store(n);
+}
+
+// ================================
+// Queries and Updates
+// ================================
+
+int UnionFind::Size() const
+{
+    return n;
+}
+
+int UnionFind::NumberOfSets() const
+{
+    return sets.load();
+}
+
+// Path halving: every visited element is pointed at its grandparent. A failed CAS
+// only means another thread already shortened the path.
+int UnionFind::find(int x)
+{
+    while (true)
+    {
+        std::uint64_t word = node[x].load(std::memory_order_acquire);
+        int parent = parentOf(word);
+        if (parent == x)
+            return x;
+        int grandparent = parentOf(node[parent].load(std::memory_order_acquire));
+        if (grandparent != parent)
+            node[x].compare_exchange_weak(word, pack(rankOf(word), grandparent), std::memory_order_acq_rel);
+        x = grandparent;
+    }
+}
+
+bool UnionFind::unite(int a, int b)
+{
+    while (true)
+    {
+        a = find(a);
+        b = find(b);
+        if (a == b)
+            return false;
+        std::uint64_t wordA = node[a].load(std::memory_order_acquire);
+        std::uint64_t wordB = node[b].load(std::memory_order_acquire);
+        if (parentOf(wordA) != a || parentOf(wordB) != b)
+            continue;   // One of them was linked meanwhile.
+
+        // Link a below b: a has the lower rank, or the same rank and the larger index.
+        std::uint32_t rankA = rankOf(wordA), rankB = rankOf(wordB);
+        if (rankA > rankB || (rankA == rankB && a < b))
+        {
+            std::swap(a, b);
+            std::swap(wordA, wordB);
+            std::swap(rankA, rankB);
+        }
+        if (!node[a].compare_exchange_strong(wordA, pack(rankA, b), std::memory_order_acq_rel))
+            continue;
+        // The rank is only a balancing hint; losing this CAS to another link is harmless.
+        if (rankA == rankB)
+            node[b].compare_exchange_strong(wordB, pack(rankB + 1, b), std::memory_order_acq_rel);
+        sets.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+}
+
+int UnionFind::Find(int x)
+{
+    if (x < 0 || x >= n)
+        throw std::out_of_range("Element out of range.");
+    return find(x);
+}
+
+bool UnionFind::Unite(int a, int b)
+{
+    if (a < 0 || a >= n || b < 0 || b >= n)
+        throw std::out_of_range("Element out of range.");
+    return unite(a, b);
+}
+
+bool UnionFind::Connected(int a, int b)
+{
+    if (a < 0 || a >= n || b < 0 || b >= n)
+        throw std::out_of_range("Element out of range.");
+    // Retry while a's root changes: then a and b may have been joined meanwhile.
+    while (true)
+    {
+        int ra = find(a), rb = find(b);
+        if (ra == rb)
+            return true;
+        if (parentOf(node[ra].load(std::memory_order_acquire)) == ra)
+            return false;
+    }
+}
+
+long long UnionFind::UniteAll(const std::vector<int>& a, const std::vector<int>& b)
+{
+    if (a.size() != b.size())
+        throw std::invalid_argument("Element arrays must have the same length.");
+    for (size_t i = 0; i < a.size(); i++)
+        if (a[i] < 0 || a[i] >= n || b[i] < 0 || b[i] >= n)
+            throw std::out_of_range("Element out of range.");
+
+    std::vector<long long> joined(Parallel::ThreadCount(), 0);
+    int blocks = Parallel::ForBlocks(0, a.size(), [&](size_t lo, size_t hi, int block)
+    {
+        long long count = 0;
+        for (size_t i = lo; i < hi; i++)
+            count += unite(a[i], b[i]);
+        joined[block] = count;
+    }, 1 << 14);
+
+    long long total = 0;
+    for (int i = 0; i < blocks; i++)
+        total += joined[i];
+    return total;
+}
+
+std::vector<int> UnionFind::Representatives()
+{
+    std::vector<int> root(n);
+    Parallel::For(0, n, [&](size_t i)
+    {
+        int x = static_cast<int>(i);
+        int r = find(x);
+        root[i] = r;
+        // Point x straight at its root. A failed CAS means another thread shortened the path.
+        std::uint64_t word = node[x].load(std::memory_order_acquire);
+        if (parentOf(word) != x && parentOf(word) != r)
+            node[x].compare_exchange_strong(word, pack(rankOf(word), r), std::memory_order_acq_rel);
+    }, 1 << 14);
+    return root;
+}
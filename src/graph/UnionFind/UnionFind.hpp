@@ -0,0 +1,102 @@
+#ifndef UNIONFIND
+#define UNIONFIND
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @brief Disjoint sets over the elements 0 .. n-1, safe for concurrent use.
+ *
+ * Every element keeps one 64-bit word holding its parent and its rank. Find()
+ * follows the parents to the root and halves the path on the way; Unite() links
+ * the root of lower rank below the other one (ties go below the smaller index)
+ * with a single compare-and-swap on the word of the linked root. Every link goes
+ * from a smaller to a larger (rank, -index) pair and the rank of an element is
+ * frozen once it has a parent, so concurrent links cannot form a cycle.
+ *
+ * Find(), Unite(), Connected() and UniteAll() may run concurrently from any
+ * number of threads. A CAS that fails because another thread changed the same
+ * root makes the operation retry, so the structure is lock-free: some thread
+ * always makes progress. Copying and Reset() must not overlap with other calls.
+ *
+ * With union by rank and path halving, m operations on n elements take
+ * O(m α(n)) time sequentially.
+ */
+class UnionFind
+{
+    private:
+        int n;
+        std::unique_ptr<std::atomic<std::uint64_t>[]> node;  // rank << 32 | parent, per element.
+        std::atomic<int> sets;                                // Number of disjoint sets.
+
+        static int parentOf(std::uint64_t word) { return static_cast<int>(word & 0xffffffffu); }
+        static std::uint32_t rankOf(std::uint64_t word) { return static_cast<std::uint32_t>(word >> 32); }
+        static std::uint64_t pack(std::uint32_t rank, int parent) { return (std::uint64_t(rank) << 32) | std::uint32_t(parent); }
+
+        // Unchecked versions of Find() and Unite().
+        int find(int x);
+        bool unite(int a, int b);
+
+    public:
+        // ==================================================
+        // Constructors and Destructor
+        // ==================================================
+
+        explicit UnionFind(int n = 0);           // n singleton sets.
+        UnionFind(const UnionFind& other);       // Copy of the current partition.
+        UnionFind& operator=(const UnionFind& other);
+        ~UnionFind();
+
+        void Reset(int n);                       // Start over with n singleton sets.
+
+        // ==================================================
+        // Queries and Updates (thread-safe)
+        // ==================================================
+
+        int Size() const;                        // Number of elements.
+        int NumberOfSets() const;                // Number of disjoint sets.
+
+        /**
+         * @brief Representative of the set containing x.
+         *
+         * The representative of a set stays the same until the set is united with another one.
+         * @throws std::out_of_range if x is not an element.
+         */
+        int Find(int x);
+
+        /**
+         * @brief Join the sets containing a and b.
+         *
+         * @return True if a and b were in different sets, false if nothing changed.
+         * @throws std::out_of_range if a or b is not an element.
+         */
+        bool Unite(int a, int b);
+
+        /**
+         * @brief True if a and b are in the same set.
+         *
+         * Exact when no Unite() runs concurrently; otherwise the answer was true at
+         * some moment during the call.
+         */
+        bool Connected(int a, int b);
+
+        /**
+         * @brief Unite a[i] with b[i] for every i, in parallel.
+         *
+         * @return The number of pairs that joined two different sets.
+         * @throws std::invalid_argument if the arrays differ in length.
+         * @throws std::out_of_range if an element does not exist.
+         */
+        long long UniteAll(const std::vector<int>& a, const std::vector<int>& b);
+
+        /**
+         * @brief Representative of every element, computed in parallel.
+         *
+         * Also compresses every path to length one, so later Find() calls return at once.
+         */
+        std::vector<int> Representatives();
+};
+
+#endif
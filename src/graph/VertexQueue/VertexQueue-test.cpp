@@ -0,0 +1,75 @@
+// VertexQueue-test.cpp
+// Compile with (for example):
+// g++ -std=c++17 VertexQueue.cpp VertexQueue-test.cpp -o test
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdlib>
+#include "VertexQueue.hpp"
+
+using namespace std;
+
+// Push n vertices with pseudo-random integer keys, lower every third key,
+// then pop everything and check that the keys come out in order.
+template <class Queue>
+void CheckQueue(const char* name, int n)
+{
+    Queue pq(n);
+    vector<double> expected(n);
+    srand(12345);
+    for (int v = 0; v < n; v++)
+    {
+        expected[v] = rand() % 1000;
+        pq.Push(v, expected[v]);
+    }
+    for (int v = 0; v < n; v += 3)
+    {
+        expected[v] = static_cast<int>(expected[v]) / 2;
+        pq.Push(v, expected[v]);      // decrease-key
+        pq.Push(v, expected[v] + 10); // a larger key is ignored
+    }
+    assert(pq.Size() == n);
+    assert(pq.Key(0) == expected[0]);
+
+    double previous = -1;
+    int popped = 0;
+    while (!pq.IsEmpty())
+    {
+        auto [key, v] = pq.Pop();
+        assert(key >= previous);
+        assert(key == expected[v]);
+        assert(!pq.Contains(v));
+        previous = key;
+        popped++;
+    }
+    assert(popped == n);
+    cout << name << ": popped " << popped << " vertices in key order." << endl;
+}
+
+int main()
+{
+    cout << "=== VertexQueue Test Program ===" << endl << endl;
+
+    CheckQueue<DaryHeap<2>>("Binary heap", 1000);
+    CheckQueue<DaryHeap<4>>("4-ary heap", 1000);
+    CheckQueue<PairingHeap>("Pairing heap", 1000);
+    CheckQueue<RadixHeap>("Radix heap", 1000);
+
+    // A radix heap is monotone: keys below the last popped key are rejected.
+    RadixHeap radix(3);
+    radix.Push(0, 5);
+    radix.Pop();
+    try
+    {
+        radix.Push(1, 4);
+        assert(false);
+    }
+    catch (const std::invalid_argument& ex)
+    {
+        cout << endl << "Caught expected exception: " << ex.what() << endl;
+    }
+
+    cout << endl << "=== End of VertexQueue Test Program ===" << endl;
+    return 0;
+}
@@ -0,0 +1,418 @@
+#include "VertexQueue.hpp"
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+// =======================================================
+// DaryHeap
+// =======================================================
+
+template <int D>
+DaryHeap<D>::DaryHeap(int capacity) : heap(), position(capacity, -1)
+{
+    if (capacity < 0)
+        throw std::invalid_argument("Capacity must be non-negative.");
+}
+
+template <int D>
+DaryHeap<D>::~DaryHeap() {}
+
+// Move the entry at i towards the root until its parent is not larger.
+template <int D>
+void DaryHeap<D>::siftUp(int i)
+{
+    Entry item = heap[i];
+    while (i > 0)
+    {
+        int parent = (i - 1) / D;
+        if (heap[parent].key <= item.key)
+            break;
+        heap[i] = heap[parent];
+        position[heap[i].vertex] = i;
+        i = parent;
+    }
+    heap[i] = item;
+    position[item.vertex] = i;
+}
+
+// Move the entry at i towards the leaves until no child is smaller.
+template <int D>
+void DaryHeap<D>::siftDown(int i)
+{
+    int count = static_cast<int>(heap.size());
+    Entry item = heap[i];
+    while (true)
+    {
+        int first = D * i + 1;
+        if (first >= count)
+            break;
+        int last = std::min(first + D, count);
+        int best = first;
+        for (int c = first + 1; c < last; c++)
+            if (heap[c].key < heap[best].key)
+                best = c;
+        if (heap[best].key >= item.key)
+            break;
+        heap[i] = heap[best];
+        position[heap[i].vertex] = i;
+        i = best;
+    }
+    heap[i] = item;
+    position[item.vertex] = i;
+}
+
+template <int D>
+bool DaryHeap<D>::IsEmpty() const
+{
+    return heap.empty();
+}
+
+template <int D>
+int DaryHeap<D>::Size() const
+{
+    return static_cast<int>(heap.size());
+}
+
+template <int D>
+bool DaryHeap<D>::Contains(int vertex) const
+{
+    return position[vertex] != -1;
+}
+
+template <int D>
+double DaryHeap<D>::Key(int vertex) const
+{
+    if (position[vertex] == -1)
+        throw std::out_of_range("Vertex is not in the heap.");
+    return heap[position[vertex]].key;
+}
+
+// Insert the vertex, or lower its key if it is already queued with a larger one.
+template <int D>
+void DaryHeap<D>::Push(int vertex, double key)
+{
+    int pos = position[vertex];
+    if (pos == -1)
+    {
+        heap.push_back({key, vertex});
+        siftUp(static_cast<int>(heap.size()) - 1);
+    }
+    else if (key < heap[pos].key)
+    {
+        heap[pos].key = key;
+        siftUp(pos);
+    }
+}
+
+template <int D>
+std::pair<double, int> DaryHeap<D>::Top() const
+{
+    if (heap.empty())
+        throw std::underflow_error("Heap is empty.");
+    return {heap[0].key, heap[0].vertex};
+}
+
+template <int D>
+std::pair<double, int> DaryHeap<D>::Pop()
+{
+    if (heap.empty())
+        throw std::underflow_error("Heap is empty.");
+
+    Entry top = heap[0];
+    position[top.vertex] = -1;
+    Entry back = heap.back();
+    heap.pop_back();
+    if (!heap.empty())
+    {
+        heap[0] = back;
+        position[back.vertex] = 0;
+        siftDown(0);
+    }
+    return {top.key, top.vertex};
+}
+
+template <int D>
+void DaryHeap<D>::Clear()
+{
+    for (const Entry& item : heap)
+        position[item.vertex] = -1;
+    heap.clear();
+}
+
+template class DaryHeap<2>;
+template class DaryHeap<4>;
+
+// =======================================================
+// PairingHeap
+// =======================================================
+
+PairingHeap::PairingHeap(int capacity)
+    : node(capacity, {0.0, -1, -1, -1}), queued(capacity, 0), scratch(), root(-1), size(0)
+{
+    if (capacity < 0)
+        throw std::invalid_argument("Capacity must be non-negative.");
+}
+
+PairingHeap::~PairingHeap() {}
+
+// Link two heap-ordered trees; the root with the larger key becomes the leftmost child.
+int PairingHeap::meld(int a, int b)
+{
+    if (a == -1)
+        return b;
+    if (b == -1)
+        return a;
+    if (node[b].key < node[a].key)
+        std::swap(a, b);
+
+    node[b].sibling = node[a].child;
+    if (node[a].child != -1)
+        node[node[a].child].prev = b;
+    node[b].prev = a;
+    node[a].child = b;
+    return a;
+}
+
+// Standard two-pass pairing of a sibling list: meld pairs left to right,
+// then meld the results right to left.
+int PairingHeap::mergePairs(int first)
+{
+    scratch.clear();
+    int i = first;
+    while (i != -1)
+    {
+        int a = i;
+        int b = node[a].sibling;
+        i = (b != -1) ? node[b].sibling : -1;
+
+        node[a].sibling = node[a].prev = -1;
+        if (b != -1)
+            node[b].sibling = node[b].prev = -1;
+        scratch.push_back(meld(a, b));
+    }
+    if (scratch.empty())
+        return -1;
+
+    int result = scratch.back();
+    for (int j = static_cast<int>(scratch.size()) - 2; j >= 0; j--)
+        result = meld(scratch[j], result);
+    return result;
+}
+
+bool PairingHeap::IsEmpty() const
+{
+    return size == 0;
+}
+
+int PairingHeap::Size() const
+{
+    return size;
+}
+
+bool PairingHeap::Contains(int vertex) const
+{
+    return queued[vertex] != 0;
+}
+
+double PairingHeap::Key(int vertex) const
+{
+    if (!queued[vertex])
+        throw std::out_of_range("Vertex is not in the heap.");
+    return node[vertex].key;
+}
+
+// Insert is a single meld. Decrease-key cuts the subtree of the vertex and melds it with the root.
+void PairingHeap::Push(int vertex, double key)
+{
+    Node& x = node[vertex];
+    if (!queued[vertex])
+    {
+        x = {key, -1, -1, -1};
+        queued[vertex] = 1;
+        size++;
+        root = meld(root, vertex);
+        return;
+    }
+    if (key >= x.key)
+        return;
+
+    x.key = key;
+    if (vertex == root)
+        return;
+
+    // Detach vertex (with its subtree) from its parent or left sibling.
+    if (node[x.prev].child == vertex)
+        node[x.prev].child = x.sibling;
+    else
+        node[x.prev].sibling = x.sibling;
+    if (x.sibling != -1)
+        node[x.sibling].prev = x.prev;
+    x.sibling = x.prev = -1;
+
+    root = meld(root, vertex);
+}
+
+std::pair<double, int> PairingHeap::Top() const
+{
+    if (size == 0)
+        throw std::underflow_error("Heap is empty.");
+    return {node[root].key, root};
+}
+
+std::pair<double, int> PairingHeap::Pop()
+{
+    if (size == 0)
+        throw std::underflow_error("Heap is empty.");
+
+    int top = root;
+    root = mergePairs(node[top].child);
+    if (root != -1)
+        node[root].prev = -1;
+
+    node[top].child = -1;
+    queued[top] = 0;
+    size--;
+    return {node[top].key, top};
+}
+
+void PairingHeap::Clear()
+{
+    while (size > 0)
+        Pop();
+}
+
+// =======================================================
+// RadixHeap
+// =======================================================
+
+RadixHeap::RadixHeap(int capacity)
+    : bucket(65), key(capacity, 0), queued(capacity, 0), last(0), size(0)
+{
+    if (capacity < 0)
+        throw std::invalid_argument("Capacity must be non-negative.");
+}
+
+RadixHeap::~RadixHeap() {}
+
+// Index of the highest bit in which k differs from last, plus one (0 if k == last).
+int RadixHeap::bucketOf(std::uint64_t k) const
+{
+    std::uint64_t diff = k ^ last;
+    if (diff == 0)
+        return 0;
+#if defined(__GNUC__) || defined(__clang__)
+    return 64 - __builtin_clzll(diff);
+#else
+    int b = 0;
+    while (diff != 0)
+    {
+        diff >>= 1;
+        b++;
+    }
+    return b;
+#endif
+}
+
+bool RadixHeap::IsEmpty() const
+{
+    return size == 0;
+}
+
+int RadixHeap::Size() const
+{
+    return size;
+}
+
+bool RadixHeap::Contains(int vertex) const
+{
+    return queued[vertex] != 0;
+}
+
+double RadixHeap::Key(int vertex) const
+{
+    if (!queued[vertex])
+        throw std::out_of_range("Vertex is not in the heap.");
+    return static_cast<double>(key[vertex]);
+}
+
+// A decrease-key simply files a new entry; the old one becomes stale.
+void RadixHeap::Push(int vertex, double k)
+{
+    if (k < 0 || k != std::floor(k) || k >= 9.2e18)
+        throw std::invalid_argument("Radix heap requires non-negative integer keys.");
+
+    std::uint64_t ik = static_cast<std::uint64_t>(k);
+    if (ik < last)
+        throw std::invalid_argument("Radix heap keys must not decrease below the last popped key.");
+
+    if (queued[vertex])
+    {
+        if (ik >= key[vertex])
+            return;
+    }
+    else
+    {
+        queued[vertex] = 1;
+        size++;
+    }
+    key[vertex] = ik;
+    bucket[bucketOf(ik)].push_back({ik, vertex});
+}
+
+std::pair<double, int> RadixHeap::Pop()
+{
+    if (size == 0)
+        throw std::underflow_error("Heap is empty.");
+
+    while (true)
+    {
+        // Drop stale entries from the front bucket.
+        std::vector<std::pair<std::uint64_t, int>>& front = bucket[0];
+        while (!front.empty())
+        {
+            auto [k, v] = front.back();
+            front.pop_back();
+            if (queued[v] && key[v] == k)
+            {
+                queued[v] = 0;
+                size--;
+                return {static_cast<double>(k), v};
+            }
+        }
+
+        // Refill bucket 0: advance last to the smallest live key of the first
+        // non-empty bucket and redistribute that bucket.
+        int b = 1;
+        while (b < 65 && bucket[b].empty())
+            b++;
+        if (b == 65)
+            throw std::logic_error("Radix heap is inconsistent.");
+
+        std::uint64_t smallest = UINT64_MAX;
+        for (const auto& [k, v] : bucket[b])
+            if (queued[v] && key[v] == k && k < smallest)
+                smallest = k;
+
+        std::vector<std::pair<std::uint64_t, int>> moved;
+        moved.swap(bucket[b]);
+        if (smallest == UINT64_MAX)
+            continue;   // The whole bucket was stale.
+
+        last = smallest;
+        for (const auto& [k, v] : moved)
+            if (queued[v] && key[v] == k)
+                bucket[bucketOf(k)].push_back({k, v});
+    }
+}
+
+void RadixHeap::Clear()
+{
+    for (auto& entries : bucket)
+    {
+        for (const auto& entry : entries)
+            queued[entry.second] = 0;
+        entries.clear();
+    }
+    last = 0;
+    size = 0;
+}
@@ -0,0 +1,113 @@
+#ifndef VERTEXQUEUE
+#define VERTEXQUEUE
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief Addressable priority queues over graph vertices.
+ *
+ * Every queue holds at most one entry per vertex 0 .. capacity-1 and supports
+ * Push() as "insert, or decrease the key if the vertex is already queued", which
+ * is exactly what label-setting algorithms such as Dijkstra and Prim need.
+ * Pop() removes and returns the entry with the smallest key as {key, vertex}.
+ *
+ * - DaryHeap<2>: binary heap.
+ * - DaryHeap<4>: 4-ary heap (shallower, better cache behavior on large graphs).
+ * - PairingHeap: O(1) insert and amortized o(log n) decrease-key.
+ * - RadixHeap:   monotone queue for non-negative integer keys; the key pushed
+ *                must never be smaller than the last key popped.
+ */
+
+// Selects the priority queue used by the shortest-path algorithms.
+enum class HeapType
+{
+    BINARY,     // DaryHeap<2>
+    FOUR_ARY,   // DaryHeap<4>
+    PAIRING,    // PairingHeap
+    RADIX       // RadixHeap (integer weights only)
+};
+
+template <int D>
+class DaryHeap
+{
+    private:
+        struct Entry { double key; int vertex; };
+
+        std::vector<Entry> heap;    // Implicit D-ary tree, keys stored inline.
+        std::vector<int> position;  // Position of each vertex in heap, -1 if absent.
+
+        void siftUp(int i);
+        void siftDown(int i);
+
+    public:
+        explicit DaryHeap(int capacity);
+        ~DaryHeap();
+
+        bool IsEmpty() const;               // True if no vertex is queued.
+        int Size() const;                   // Number of queued vertices.
+        bool Contains(int vertex) const;    // True if vertex is queued.
+        double Key(int vertex) const;       // Current key of a queued vertex.
+        void Push(int vertex, double key);  // Insert, or decrease the key of a queued vertex.
+        std::pair<double, int> Top() const; // The minimum as {key, vertex}, without removing it.
+        std::pair<double, int> Pop();       // Remove the minimum, returned as {key, vertex}.
+        void Clear();                       // Empty the queue in O(size).
+};
+
+class PairingHeap
+{
+    private:
+        // One node per vertex. prev is the parent for a leftmost child and the left sibling otherwise.
+        struct Node { double key; int child; int sibling; int prev; };
+
+        std::vector<Node> node;
+        std::vector<char> queued;   // 1 if the vertex is in the heap.
+        std::vector<int> scratch;   // Reused by mergePairs().
+        int root;
+        int size;
+
+        int meld(int a, int b);
+        int mergePairs(int first);
+
+    public:
+        explicit PairingHeap(int capacity);
+        ~PairingHeap();
+
+        bool IsEmpty() const;
+        int Size() const;
+        bool Contains(int vertex) const;
+        double Key(int vertex) const;
+        void Push(int vertex, double key);
+        std::pair<double, int> Top() const;
+        std::pair<double, int> Pop();
+        void Clear();
+};
+
+class RadixHeap
+{
+    private:
+        // Bucket 0 holds keys equal to last; bucket b > 0 holds keys whose highest
+        // bit differing from last is bit b-1. Stale entries are skipped lazily.
+        std::vector<std::vector<std::pair<std::uint64_t, int>>> bucket;
+        std::vector<std::uint64_t> key;
+        std::vector<char> queued;
+        std::uint64_t last;         // Last key popped.
+        int size;
+
+        int bucketOf(std::uint64_t k) const;
+
+    public:
+        explicit RadixHeap(int capacity);
+        ~RadixHeap();
+
+        bool IsEmpty() const;
+        int Size() const;
+        bool Contains(int vertex) const;
+        double Key(int vertex) const;
+        void Push(int vertex, double key);  // key must be a non-negative integer >= the last popped key.
+        std::pair<double, int> Pop();
+        void Clear();
+};
+
+#endif